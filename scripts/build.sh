@@ -26,6 +26,7 @@ if [ -z "$CROSS_PREFIX" ] && [ ! -f "/.dockerenv" ]; then
     docker run --rm \
         -v "$REPO_ROOT:/build" \
         -u "$(id -u):$(id -g)" \
+        -e PGO_GENERATE -e PGO_PROFILE -e EXTRA_FLAGS \
         -w /build \
         "$IMAGE_NAME" \
         ./scripts/build.sh
@@ -47,13 +48,31 @@ echo "Cross prefix: $CROSS_PREFIX"
 mkdir -p build
 mkdir -p dist/obxd
 
+# Profile-guided optimization (see scripts/pgo.sh):
+#   PGO_GENERATE=1     instrumented build for training on the device
+#   PGO_PROFILE=FILE   rebuild using a .gcda collected from that build
+PGO_FLAGS=""
+if [ -n "$PGO_GENERATE" ]; then
+    PGO_FLAGS="-fprofile-generate -fprofile-update=single"
+elif [ -n "$PGO_PROFILE" ]; then
+    # The .gcda is looked up next to the object file
+    cat "$PGO_PROFILE" > build/obxd_plugin.gcda
+    PGO_FLAGS="-fprofile-use -fprofile-correction -Wno-coverage-mismatch"
+fi
+
+# Extra engine options, e.g. EXTRA_FLAGS="-DOBXD_BLEP_FP16" (see README)
+EXTRA_FLAGS="${EXTRA_FLAGS:-}"
+
 # Compile DSP plugin
 echo "Compiling DSP plugin..."
-${CROSS_PREFIX}g++ -g -O3 -shared -fPIC -std=c++14 \
-    src/dsp/obxd_plugin.cpp \
+${CROSS_PREFIX}g++ -g -O3 -fPIC -std=c++14 $PGO_FLAGS $EXTRA_FLAGS \
+    -c src/dsp/obxd_plugin.cpp \
+    -o build/obxd_plugin.o \
+    -Isrc/dsp
+${CROSS_PREFIX}g++ -shared $PGO_FLAGS \
+    build/obxd_plugin.o \
     -o build/dsp.so \
-    -Isrc/dsp \
-    -lm
+    -lm -lpthread
 
 # Copy files to dist (use cat to avoid ExtFS deallocation issues with Docker)
 echo "Packaging..."
@@ -69,6 +88,15 @@ if [ -d "src/presets" ]; then
     for f in src/presets/*.fxb; do
         cat "$f" > "dist/obxd/presets/$(basename "$f")"
     done
+    # Preset cost index from ./scripts/harness.sh cost-survey, if one was generated
+    if [ -f src/presets/cost_index.tsv ]; then
+        cat src/presets/cost_index.tsv > dist/obxd/presets/cost_index.tsv
+    fi
+    # Preset previews from ./scripts/harness.sh preview, if they were rendered
+    if [ -f src/presets/previews/manifest.json ]; then
+        rm -rf dist/obxd/presets/previews
+        cp -r src/presets/previews dist/obxd/presets/previews
+    fi
 fi
 
 # Create tarball for release
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+# Build dsp.so and the test harness for the host machine, then run the harness
+#
+# Usage: ./scripts/harness.sh <command> [args]   (see tools/harness/obxd_harness.cpp)
+#
+# Uses the same compile flags as scripts/build.sh so measurements match the
+# shipped code, minus the cross compiler. Set CXX to override the compiler,
+# EXTRA_FLAGS for engine options as in build.sh.
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+REPO_ROOT="$(dirname "$SCRIPT_DIR")"
+CXX="${CXX:-g++}"
+OUT="build/native"
+
+cd "$REPO_ROOT"
+mkdir -p "$OUT"
+
+${CXX} -g -O3 -shared -fPIC -std=c++14 $EXTRA_FLAGS \
+    src/dsp/obxd_plugin.cpp \
+    -o "$OUT/dsp.so" \
+    -Isrc/dsp \
+    -lm -lpthread
+
+# -O3 like dsp.so, the DSP micro-benchmarks compile the engine kernels in.
+# -rdynamic: dsp.so must bind to the rtcheck interposers in the executable.
+${CXX} -g -O3 -std=c++14 -rdynamic $EXTRA_FLAGS \
+    tools/harness/*.cpp \
+    -o "$OUT/obxd_harness" \
+    -Isrc/dsp \
+    -ldl -lm -lpthread
+
+exec "$OUT/obxd_harness" --plugin "$OUT/dsp.so" --module-dir src "$@"
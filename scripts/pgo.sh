@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+# Profile-guided build of dsp.so for the host machine, trained by the harness
+#
+# Usage: ./scripts/pgo.sh
+#
+#   1. Builds an instrumented dsp.so (-fprofile-generate) and the harness
+#   2. Trains it: every preset of every bank through the cost-survey note
+#      pattern, MIDI storms under every allocation mode, held-chord renders
+#   3. Rebuilds dsp.so with -fprofile-use into build/pgo/dsp.so
+#   4. Reports the speedup over the plain -O3 build with `harness compare`
+#
+# The profile is left in build/pgo/obxd_plugin.gcda. For the Move build,
+# train an instrumented aarch64 dsp.so on the device and pass the resulting
+# .gcda to scripts/build.sh as PGO_PROFILE; a profile from another
+# architecture only approximately matches the aarch64 code.
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+REPO_ROOT="$(dirname "$SCRIPT_DIR")"
+CXX="${CXX:-g++}"
+OUT="build/pgo"
+
+cd "$REPO_ROOT"
+mkdir -p "$OUT" build/native
+
+# Compile and link separately: the .gcda is named after the object file,
+# so both passes must use the same object path.
+build_dsp() {
+    local flags="$1" out="$2"
+    ${CXX} -g -O3 -fPIC -std=c++14 $flags $EXTRA_FLAGS \
+        -c src/dsp/obxd_plugin.cpp \
+        -o "$OUT/obxd_plugin.o" \
+        -Isrc/dsp
+    ${CXX} -shared $flags "$OUT/obxd_plugin.o" -o "$out" -lm -lpthread
+}
+
+echo "=== Instrumented build ==="
+rm -f "$OUT"/*.gcda
+build_dsp "-fprofile-generate -fprofile-update=single" "$OUT/dsp_instrumented.so"
+
+# Baseline -O3 dsp.so and the harness, as scripts/harness.sh builds them
+${CXX} -g -O3 -shared -fPIC -std=c++14 $EXTRA_FLAGS src/dsp/obxd_plugin.cpp -o build/native/dsp.so -Isrc/dsp -lm -lpthread
+${CXX} -g -O3 -std=c++14 -rdynamic $EXTRA_FLAGS tools/harness/*.cpp -o build/native/obxd_harness -Isrc/dsp -ldl -lm -lpthread
+HARNESS="build/native/obxd_harness --module-dir src"
+
+echo "=== Training ==="
+$HARNESS --plugin "$OUT/dsp_instrumented.so" cost-survey --seconds 0.5 --repeats 1 --out "$OUT/train_cost.tsv" > /dev/null
+$HARNESS --plugin "$OUT/dsp_instrumented.so" storm --seconds 0.5 > /dev/null
+$HARNESS --plugin "$OUT/dsp_instrumented.so" bench --seconds 5 --voices 6 > /dev/null
+
+echo "=== Optimized build ==="
+build_dsp "-fprofile-use -fprofile-correction" "$OUT/dsp.so"
+
+echo "=== Speedup over -O3 ==="
+$HARNESS compare build/native/dsp.so "$OUT/dsp.so" "$@"
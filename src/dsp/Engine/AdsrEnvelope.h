@@ -33,6 +33,16 @@ private:
         int state;//1 - attack 2- decay 3 - sustain 4 - release 5-silence
 		float SampleRate;
 		float uf;
+		//Precomputed so note-on and the attack to decay turn need no log()
+		float attackCoef, decayCoef;
+		void updateAttackCoef()
+		{
+			attackCoef = (float)((log(0.001) - log(1.3)) / (SampleRate * (attack)/1000 ));
+		}
+		void updateDecayCoef()
+		{
+			decayCoef = (float)((log(jmin(sustain + 0.0001, 0.99)) - log(1.0)) / (SampleRate * (decay) / 1000));
+		}
 public:
 	AdsrEnvelope()
 	{
@@ -43,6 +53,8 @@ public:
 		coef = 0;
 		state = 5;
 		SampleRate = 44000;
+		updateAttackCoef();
+		updateDecayCoef();
 	}
 	void ResetEnvelopeState()
 	{
@@ -52,6 +64,8 @@ public:
 	void setSampleRate(float sr)
 	{
 		SampleRate = sr;
+		updateAttackCoef();
+		updateDecayCoef();
 	}
 	void setUniqueDeriviance(float der)
 	{
@@ -65,6 +79,7 @@ public:
 	{
 		ua = atk;
 		attack = atk*uf;
+		updateAttackCoef();
 		if(state == 1)
 			coef = (float)((log(0.001) - log(1.3)) / (SampleRate * (atk) / 1000));
 	}
@@ -72,6 +87,7 @@ public:
 	{
 		ud = dec;
 		decay = dec*uf;
+		updateDecayCoef();
 		if(state == 2)
 			coef = (float)((log(jmin(sustain + 0.0001,0.99)) - log(1.0)) / (SampleRate * (dec) / 1000));
 	}
@@ -79,8 +95,9 @@ public:
 	{
 		us = sust;
 		sustain = sust;
+		updateDecayCoef();
 		if(state == 2)
-			coef = (float)((log(jmin(sustain + 0.0001,0.99)) - log(1.0)) / (SampleRate * (decay) / 1000));
+			coef = decayCoef;
 	}
 	void setRelease(float rel)
 	{
@@ -93,7 +110,7 @@ public:
         {
             state = 1;
             //Value = Value +0.00001f;
-            coef = (float)((log(0.001) - log(1.3)) / (SampleRate * (attack)/1000 ));
+            coef = attackCoef;
         }
     void triggerRelease()
         {
@@ -114,7 +131,7 @@ public:
                     {
                         Value = jmin(Value, 0.99f);
                         state = 2;
-                        coef = (float)((log(jmin(sustain + 0.0001, 0.99)) - log(1.0)) / (SampleRate * (decay) / 1000));
+                        coef = decayCoef;
 						goto dec;
                     }
 					else
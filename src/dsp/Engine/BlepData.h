@@ -22,14 +22,124 @@
 	==============================================================================
  */
 #pragma once
-//Bleps and blamps
-//const float blep[] = {-0.00000000000000000647905f,-0.00000000001273982f,-0.0000000001160013f,-0.0000000004646626f,-0.000000001288395f,-0.000000002894978f,-0.00000000566087f,-0.00000001003746f,-0.00000001653689f,-0.00000002573661f,-0.00000003827332f,-0.00000005483587f,-0.00000007616185f,-0.000000103025f,-0.0000001362388f,-0.0000001766452f,-0.0000002251071f,-0.0000002824967f,-0.0000003497017f,-0.0000004275869f,-0.0000005170289f,-0.0000006188667f,-0.0000007339223f,-0.0000008629681f,-0.00000100674f,-0.000001165909f,-0.000001341089f,-0.000001532813f,-0.000001741532f,-0.000001967613f,-0.000002211317f,-0.000002472799f,-0.000002752102f,-0.000003049145f,-0.000003363705f,-0.000003695441f,-0.000004043864f,-0.000004408338f,-0.000004788075f,-0.000005182125f,-0.000005589381f,-0.000006008591f,-0.000006438312f,-0.000006876962f,-0.000007322767f,-0.000007773819f,-0.000008228023f,-0.000008683131f,-0.000009136737f,-0.000009586283f,-0.00001002906f,-0.00001046221f,-0.00001088277f,-0.0000112876f,-0.00001167348f,-0.00001203706f,-0.00001237489f,-0.00001268345f,-0.00001295913f,-0.00001319825f,-0.00001339708f,-0.00001355188f,-0.00001365886f,-0.00001371423f,-0.00001371423f,-0.00001365511f,-0.00001353318f,-0.00001334478f,-0.00001308638f,-0.00001275451f,-0.00001234585f,-0.00001185719f,-0.00001128549f,-0.00001062789f,-0.000009881717f,-0.000009044513f,-0.000008114053f,-0.000007088366f,-0.000005965746f,-0.000004744777f,-0.000003424346f,-0.000002003661f,-0.0000004822616f,0.000001139949f,0.000002862707f,0.000004685374f,0.000006606911f,0.000008625878f,0.00001074042f,0.00001294826f,0.00001524669f,0.00001763257f,0.0000201023f,0.00002265185f,0.00002527673f,0.00002797199f,0.00003073227f,0.00003355173f,0.00003642408f,0.00003934265f,0.00004230027f,0.0000452894f,0.00004830205f,0.00005132989f,0.00005436417f,0.00005739578f,0.00006041526f,0.00006341286f,0.00006637849f,0.00006930178f,0.00007217213f,0.00007497869f,0.00007771041f,0.0000803561f,0.00008290438f,0.00008534381f,0.00008766285f,0.00008984995f,0.00009189351f,0.00009378204f,0.00009550405f,0.00009704823f,0.00009840337f,0.0000995585f,0.0001005029f,0.000101226f,0.0001017177f,0.0001019683f,0.0001019683f,0.0001017089f,0.0001011814f,0.0001003782f,0.00009929171f,0.00009791533f,0.00009624296f,0.0000942692f,0.00009198939f,0.00008939965f,0.00008649687f,0.00008327877f,0.00007974397f,0.00007589195f,0.00007172312f,0.00006723884f,0.00006244142f,0.00005733419f,0.00005192146f,0.00004620857f,0.00004020192f,0.00003390891f,0.00002733804f,0.00002049886f,0.00001340195f,0.000006058992f,-0.000001517315f,-0.000009313229f,-0.00001731395f,-0.00002550369f,-0.00003386565f,-0.00004238205f,-0.00005103418f,-0.00005980239f,-0.00006866614f,-0.00007760408f,-0.00008659399f,-0.00009561296f,-0.0001046373f,-0.0001136426f,-0.0001226039f,-0.0001314958f,-0.0001402922f,-0.0001489666f,-0.0001574922f,-0.0001658417f,-0.000173988f,-0.0001819032f,-0.00018956f,-0.0001969304f,-0.0002039871f,-0.0002107025f,-0.0002170494f,-0.0002230009f,-0.0002285305f,-0.0002336121f,-0.0002382203f,-0.0002423302f,-0.0002459178f,-0.0002489599f,-0.000251434f,-0.0002533187f,-0.000254594f,-0.0002552405f,-0.0002552406f,-0.0002545775f,-0.0002532362f,-0.000251203f,-0.0002484658f,-0.0002450141f,-0.0002408391f,-0.0002359337f,-0.0002302928f,-0.0002239128f,-0.0002167925f,-0.0002089323f,-0.0002003348f,-0.0001910045f,-0.0001809482f,-0.0001701747f,-0.000158695f,-0.0001465221f,-0.0001336714f,-0.0001201603f,-0.0001060085f,-0.0000912379f,-0.00007587241f,-0.00005993822f,-0.00004346364f,-0.00002647906f,-0.000009016921f,0.000008888309f,0.00002720019f,0.00004588038f,0.00006488869f,0.00008418313f,0.00010372f,0.0001234541f,0.0001433384f,0.0001633248f,0.0001833635f,0.0002034039f,0.0002233938f,0.0002432803f,0.0002630094f,0.0002825267f,0.0003017767f,0.0003207039f,0.000339252f,0.0003573648f,0.0003749859f,0.000392059f,0.0004085281f,0.0004243375f,0.0004394322f,0.0004537578f,0.0004672609f,0.0004798889f,0.0004915908f,0.0005023165f,0.0005120176f,0.0005206478f,0.0005281619f,0.0005345173f,0.0005396733f,0.0005435915f,0.0005462359f,0.0005475735f,0.0005475735f,0.0005462083f,0.0005434533f,0.0005392868f,0.0005336907f,0.0005266501f,0.0005181535f,0.0005081931f,0.0004967647f,0.0004838678f,0.0004695059f,0.0004536861f,0.0004364196f,0.0004177217f,0.0003976117f,0.0003761127f,0.000353252f,0.0003290613f,0.0003035759f,0.0002768353f,0.0002488833f,0.0002197673f,0.0001895388f,0.0001582533f,0.00012597f,0.00009275173f,0.00005866511f,0.0000237802f,-0.0000118295f,-0.00004808725f,-0.00008491318f,-0.0001222244f,-0.0001599352f,-0.0001979572f,-0.0002361997f,-0.0002745696f,-0.0003129717f,-0.0003513091f,-0.0003894831f,-0.0004273935f,-0.0004649392f,-0.000502018f,-0.000538527f,-0.0005743632f,-0.0006094227f,-0.0006436026f,-0.0006767996f,-0.0007089116f,-0.000739837f,-0.0007694759f,-0.0007977294f,-0.0008245007f,-0.0008496949f,-0.0008732195f,-0.0008949846f,-0.0009149033f,-0.0009328918f,-0.0009488696f,-0.0009627602f,-0.0009744911f,-0.0009839938f,-0.0009912044f,-0.0009960639f,-0.0009985182f,-0.0009985184f,-0.0009960209f,-0.0009909876f,-0.0009833866f,-0.0009731922f,-0.0009603841f,-0.000944949f,-0.0009268797f,-0.0009061761f,-0.0008828441f,-0.0008568972f,-0.0008283553f,-0.0007972454f,-0.0007636016f,-0.0007274649f,-0.0006888835f,-0.0006479127f,-0.0006046146f,-0.0005590585f,-0.0005113207f,-0.000461484f,-0.0004096383f,-0.00035588f,-0.0003003121f,-0.0002430436f,-0.0001841902f,-0.000123873f,-0.00006221938f,0.0000006382491f,0.00006456191f,0.0001294087f,0.000195031f,0.0002612768f,0.0003279899f,0.0003950105f,0.0004621752f,0.0005293178f,0.0005962692f,0.000662858f,0.0007289113f,0.0007942542f,0.0008587113f,0.000922106f,0.0009842622f,0.001045004f,0.001104155f,0.001161542f,0.001216992f,0.001270335f,0.001321403f,0.001370031f,0.001416059f,0.001459328f,0.001499688f,0.001536989f,0.001571089f,0.001601853f,0.00162915f,0.001652856f,0.001672856f,0.00168904f,0.001701309f,0.001709568f,0.001713736f,0.001713736f,0.001709503f,0.001700983f,0.001688128f,0.001670905f,0.001649287f,0.00162326f,0.001592822f,0.001557979f,0.001518751f,0.001475169f,0.001427273f,0.001375118f,0.001318768f,0.001258299f,0.0011938f,0.00112537f,0.00105312f,0.0009771726f,0.0008976605f,0.0008147284f,0.0007285316f,0.0006392356f,0.0005470168f,0.000452061f,0.0003545642f,0.0002547312f,0.0001527762f,0.00004892161f,-0.00005660188f,-0.000163556f,-0.0002716954f,-0.000380768f,-0.0004905157f,-0.0006006749f,-0.0007109772f,-0.0008211494f,-0.0009309154f,-0.001039995f,-0.001148107f,-0.001254968f,-0.001360293f,-0.001463796f,-0.001565194f,-0.001664203f,-0.001760541f,-0.00185393f,-0.001944095f,-0.002030763f,-0.002113669f,-0.002192552f,-0.002267156f,-0.002337236f,-0.00240255f,-0.002462867f,-0.002517967f,-0.002567636f,-0.002611674f,-0.00264989f,-0.002682106f,-0.002708156f,-0.002727888f,-0.002741163f,-0.002747855f,-0.002747855f,-0.002741068f,-0.002727415f,-0.002706833f,-0.002679275f,-0.002644712f,-0.00260313f,-0.002554536f,-0.00249895f,-0.002436413f,-0.002366984f,-0.002290738f,-0.00220777f,-0.002118192f,-0.002022136f,-0.001919748f,-0.001811197f,-0.001696666f,-0.001576357f,-0.001450488f,-0.001319296f,-0.001183032f,-0.001041965f,-0.0008963801f,-0.0007465753f,-0.000592865f,-0.0004355772f,-0.0002750531f,-0.0001116469f,0.00005427531f,0.0002223361f,0.0003921479f,0.0005633132f,0.0007354259f,0.0009080721f,0.001080831f,0.001253275f,0.001424974f,0.001595491f,0.001764388f,0.001931224f,0.002095558f,0.00225695f,0.00241496f,0.002569152f,0.002719092f,0.002864352f,0.003004511f,0.003139153f,0.003267872f,0.003390269f,0.003505959f,0.003614566f,0.003715728f,0.003809096f,0.003894335f,0.003971129f,0.004039176f,0.004098192f,0.004147914f,0.004188097f,0.004218515f,0.004238968f,0.004249273f,0.004249273f,0.004238834f,0.004217846f,0.004186225f,0.00414391f,0.004090867f,0.00402709f,0.003952597f,0.003867435f,0.003771675f,0.00366542f,0.003548795f,0.003421957f,0.003285088f,0.003138398f,0.002982124f,0.002816529f,0.002641904f,0.002458566f,0.002266856f,0.002067143f,0.001859817f,0.001645294f,0.001424013f,0.001196436f,0.0009630446f,0.0007243421f,0.0004808514f,0.0002331134f,-0.00001831326f,-0.000272854f,-0.0005299192f,-0.0007889057f,-0.001049198f,-0.001310169f,-0.001571184f,-0.001831598f,-0.00209076f,-0.002348016f,-0.002602705f,-0.002854168f,-0.003101744f,-0.003344772f,-0.003582596f,-0.003814565f,-0.004040034f,-0.004258365f,-0.004468931f,-0.004671118f,-0.004864322f,-0.005047955f,-0.005221447f,-0.005384244f,-0.005535814f,-0.005675644f,-0.005803246f,-0.005918153f,-0.006019928f,-0.006108159f,-0.006182461f,-0.006242482f,-0.0062879f,-0.006318424f,-0.006333798f,-0.006333798f,-0.006318239f,-0.006286968f,-0.006239872f,-0.006176876f,-0.006097942f,-0.006003071f,-0.005892304f,-0.005765723f,-0.005623448f,-0.005465641f,-0.005292502f,-0.005104274f,-0.00490124f,-0.004683721f,-0.00445208f,-0.004206716f,-0.003948072f,-0.003676623f,-0.003392886f,-0.003097412f,-0.00279079f,-0.002473641f,-0.00214662f,-0.001810416f,-0.001465747f,-0.001113361f,-0.0007540347f,-0.0003885695f,-0.00001779301f,0.000357445f,0.0007362733f,0.001117802f,0.001501123f,0.001885314f,0.002269439f,0.002652552f,0.003033698f,0.003411914f,0.003786236f,0.004155695f,0.004519326f,0.004876164f,0.00522525f,0.005565635f,0.005896378f,0.006216552f,0.006525244f,0.006821561f,0.007104627f,0.00737359f,0.007627625f,0.00786593f,0.008087734f,0.008292301f,0.008478923f,0.008646932f,0.008795699f,0.008924631f,0.00903318f,0.009120842f,0.009187156f,0.009231713f,0.009254147f,0.009254147f,0.009231452f,0.009185852f,0.009117195f,0.009025384f,0.008910371f,0.008772171f,0.008610857f,0.008426555f,0.008219452f,0.007989793f,0.007737883f,0.007464082f,0.00716881f,0.006852544f,0.00651582f,0.006159228f,0.005783415f,0.005389084f,0.004976989f,0.004547938f,0.00410279f,0.003642453f,0.003167883f,0.002680082f,0.002180097f,0.001669016f,0.001147967f,0.000618115f,0.00008066116f,-0.0004631616f,-0.00101209f,-0.001564835f,-0.002120081f,-0.002676494f,-0.00323272f,-0.00378739f,-0.004339125f,-0.004886533f,-0.005428222f,-0.005962793f,-0.006488854f,-0.007005013f,-0.00750989f,-0.008002114f,-0.008480331f,-0.008943205f,-0.009389425f,-0.009817701f,-0.01022678f,-0.01061543f,-0.01098246f,-0.01132673f,-0.01164713f,-0.01194259f,-0.01221212f,-0.01245473f,-0.01266954f,-0.01285569f,-0.0130124f,-0.01313895f,-0.01323467f,-0.01329898f,-0.01333135f,-0.01333135f,-0.0132986f,-0.01323281f,-0.01313375f,-0.01300128f,-0.01283535f,-0.01263598f,-0.01240328f,-0.01213742f,-0.01183868f,-0.01150742f,-0.01114408f,-0.01074916f,-0.0103233f,-0.009867154f,-0.009381512f,-0.008867221f,-0.008325211f,-0.007756494f,-0.007162155f,-0.006543357f,-0.005901337f,-0.005237399f,-0.004552921f,-0.003849343f,-0.003128172f,-0.002390971f,-0.001639365f,-0.0008750302f,-0.00009969395f,0.000684869f,0.001476841f,0.002274366f,0.00307555f,0.003878473f,0.004681183f,0.00548171f,0.006278063f,0.007068242f,0.007850235f,0.008622028f,0.00938161f,0.01012697f,0.01085613f,0.01156709f,0.0122579f,0.01292663f,0.01357138f,0.01419029f,0.01478154f,0.01534335f,0.01587399f,0.0163718f,0.01683516f,0.01726254f,0.01765246f,0.01800352f,0.01831439f,0.01858385f,0.01881073f,0.01899397f,0.01913261f,0.01922577f,0.01927269f,0.01927269f,0.01922522f,0.01912981f,0.01898614f,0.01879397f,0.0185532f,0.01826382f,0.01792597f,0.01753988f,0.01710593f,0.01662459f,0.01609648f,0.01552231f,0.01490294f,0.01423935f,0.01353261f,0.01278393f,0.01199463f,0.01116617f,0.01030008f,0.009398025f,0.008461781f,0.007493218f,0.006494315f,0.005467145f,0.004413877f,0.003336768f,0.002238165f,0.001120494f,-0.00001374411f,-0.001161974f,-0.002321556f,-0.003489789f,-0.004663918f,-0.005841139f,-0.007018605f,-0.00819343f,-0.009362706f,-0.01052349f,-0.01167283f,-0.01280777f,-0.01392534f,-0.01502257f,-0.01609652f,-0.01714425f,-0.01816287f,-0.01914949f,-0.02010128f,-0.02101547f,-0.02188932f,-0.02272017f,-0.02350541f,-0.02424254f,-0.0249291f,-0.02556275f,-0.02614125f,-0.02666244f,-0.0271243f,-0.0275249f,-0.02786244f,-0.02813526f,-0.02834182f,-0.02848073f,-0.02855073f,-0.02855073f,-0.02847978f,-0.02833709f,-0.02812204f,-0.02783416f,-0.02747317f,-0.02703895f,-0.02653155f,-0.0259512f,-0.02529833f,-0.02457352f,-0.02377755f,-0.02291137f,-0.02197612f,-0.02097313f,-0.0199039f,-0.0187701f,-0.01757361f,-0.01631646f,-0.01500086f,-0.0136292f,-0.01220404f,-0.01072809f,-0.009204245f,-0.007635531f,-0.006025144f,-0.004376419f,-0.002692834f,-0.0009780014f,0.0007643371f,0.002530319f,0.004315969f,0.006117202f,0.007929836f,0.009749599f,0.01157214f,0.01339302f,0.01520776f,0.0170118f,0.01880056f,0.02056942f,0.02231371f,0.02402878f,0.02570995f,0.02735257f,0.02895199f,0.03050358f,0.03200279f,0.03344508f,0.03482598f,0.0361411f,0.03738614f,0.03855688f,0.03964922f,0.04065916f,0.04158286f,0.04241657f,0.04315674f,0.04379994f,0.04434294f,0.04478267f,0.04511627f,0.04534106f,0.04545458f,0.04545458f,0.04533904f,0.04510619f,0.04475449f,0.04428265f,0.04368963f,0.04297467f,0.04213728f,0.04117723f,0.0400946f,0.03888973f,0.03756326f,0.03611614f,0.03454959f,0.03286515f,0.03106467f,0.02915028f,0.02712444f,0.0249899f,0.02274973f,0.02040729f,0.01796626f,0.0154306f,0.01280459f,0.0100928f,0.007300086f,0.004431599f,0.00149277f,-0.001510693f,-0.004572812f,-0.007687343f,-0.01084779f,-0.0140474f,-0.01727918f,-0.02053593f,-0.02381019f,-0.02709431f,-0.03038045f,-0.03366055f,-0.03692642f,-0.04016965f,-0.0433817f,-0.04655391f,-0.04967746f,-0.05274343f,-0.05574282f,-0.05866651f,-0.06150533f,-0.06425006f,-0.06689143f,-0.06942014f,-0.0718269f,-0.0741024f,-0.0762374f,-0.07822263f,-0.08004894f,-0.08170721f,-0.08318842f,-0.08448366f,-0.08558414f,-0.08648119f,-0.08716629f,-0.08763114f,-0.08786753f,-0.08786753f,-0.08762339f,-0.08712758f,-0.08637285f,-0.08535216f,-0.08405878f,-0.08248625f,-0.0806284f,-0.07847939f,-0.0760337f,-0.07328612f,-0.07023184f,-0.06686636f,-0.06318557f,-0.05918573f,-0.0548635f,-0.05021592f,-0.04524045f,-0.03993496f,-0.03429772f,-0.02832745f,-0.02202329f,-0.0153848f,-0.008411995f,-0.001105332f,0.006534298f,0.01450555f,0.02280664f,0.03143534f,0.04038895f,0.04966436f,0.05925801f,0.06916586f,0.07938349f,0.08990602f,0.1007281f,0.1118441f,0.1232478f,0.1349327f,0.1468919f,0.1591179f,0.1716031f,0.1843393f,0.1973182f,0.210531f,0.2239684f,0.237621f,0.2514791f,0.2655325f,0.2797709f,0.2941837f,0.30876f,0.3234887f,0.3383583f,0.3533574f,0.3684742f,0.3836968f,0.3990131f,0.4144109f,0.4298779f,0.4454016f,0.4609695f,0.476569f,0.4921875f,0.5078124f,0.5234309f,0.5390304f,0.5545984f,0.5701221f,0.5855891f,0.6009868f,0.6163032f,0.6315258f,0.6466426f,0.6616417f,0.6765113f,0.69124f,0.7058163f,0.7202291f,0.7344675f,0.748521f,0.762379f,0.7760316f,0.7894691f,0.8026817f,0.8156607f,0.8283969f,0.8408821f,0.8531081f,0.8650672f,0.8767521f,0.8881558f,0.8992718f,0.910094f,0.9206165f,0.9308341f,0.940742f,0.9503356f,0.959611f,0.9685646f,0.9771933f,0.9854944f,0.9934657f,1.001105f,1.008412f,1.015385f,1.022023f,1.028327f,1.034298f,1.039935f,1.04524f,1.050216f,1.054863f,1.059186f,1.063185f,1.066866f,1.070232f,1.073286f,1.076034f,1.078479f,1.080628f,1.082486f,1.084059f,1.085352f,1.086373f,1.087128f,1.087623f,1.087867f,1.087867f,1.087631f,1.087166f,1.086481f,1.085584f,1.084484f,1.083188f,1.081707f,1.080049f,1.078223f,1.076237f,1.074102f,1.071827f,1.06942f,1.066891f,1.06425f,1.061505f,1.058666f,1.055743f,1.052743f,1.049677f,1.046554f,1.043382f,1.04017f,1.036926f,1.033661f,1.03038f,1.027094f,1.02381f,1.020536f,1.017279f,1.014047f,1.010848f,1.007687f,1.004573f,1.001511f,0.9985072f,0.9955684f,0.9926999f,0.9899071f,0.9871954f,0.9845694f,0.9820337f,0.9795927f,0.9772502f,0.9750101f,0.9728755f,0.9708497f,0.9689353f,0.9671348f,0.9654503f,0.9638838f,0.9624367f,0.9611102f,0.9599054f,0.9588227f,0.9578627f,0.9570253f,0.9563103f,0.9557173f,0.9552455f,0.9548938f,0.954661f,0.9545454f,0.9545454f,0.9546589f,0.9548837f,0.9552173f,0.955657f,0.9562f,0.9568432f,0.9575834f,0.9584171f,0.9593408f,0.9603508f,0.9614431f,0.9626138f,0.9638588f,0.965174f,0.9665549f,0.9679972f,0.9694964f,0.9710479f,0.9726474f,0.97429f,0.9759712f,0.9776862f,0.9794306f,0.9811994f,0.9829881f,0.9847922f,0.986607f,0.9884279f,0.9902503f,0.9920701f,0.9938828f,0.995684f,0.9974696f,0.9992356f,1.000978f,1.002693f,1.004376f,1.006025f,1.007635f,1.009204f,1.010728f,1.012204f,1.013629f,1.015001f,1.016316f,1.017574f,1.01877f,1.019904f,1.020973f,1.021976f,1.022911f,1.023777f,1.024573f,1.025298f,1.025951f,1.026531f,1.027039f,1.027473f,1.027834f,1.028122f,1.028337f,1.02848f,1.028551f,1.028551f,1.028481f,1.028342f,1.028135f,1.027862f,1.027525f,1.027124f,1.026662f,1.026141f,1.025563f,1.024929f,1.024243f,1.023505f,1.02272f,1.021889f,1.021015f,1.020101f,1.01915f,1.018163f,1.017144f,1.016096f,1.015023f,1.013925f,1.012808f,1.011673f,1.010523f,1.009363f,1.008193f,1.007019f,1.005841f,1.004664f,1.00349f,1.002321f,1.001162f,1.000014f,0.9988794f,0.9977618f,0.9966632f,0.9955861f,0.9945328f,0.9935057f,0.9925067f,0.9915382f,0.9906019f,0.9896999f,0.9888338f,0.9880053f,0.9872161f,0.9864674f,0.9857606f,0.985097f,0.9844776f,0.9839035f,0.9833754f,0.982894f,0.9824601f,0.982074f,0.9817362f,0.9814468f,0.981206f,0.9810138f,0.9808702f,0.9807748f,0.9807273f,0.9807273f,0.9807742f,0.9808674f,0.981006f,0.9811893f,0.9814162f,0.9816856f,0.9819965f,0.9823475f,0.9827375f,0.9831648f,0.9836282f,0.984126f,0.9846566f,0.9852184f,0.9858097f,0.9864286f,0.9870734f,0.9877421f,0.9884329f,0.9891438f,0.9898729f,0.9906183f,0.9913779f,0.9921497f,0.9929317f,0.9937219f,0.9945183f,0.9953188f,0.9961215f,0.9969244f,0.9977256f,0.9985231f,0.9993151f,1.0001f,1.000875f,1.001639f,1.002391f,1.003128f,1.003849f,1.004553f,1.005237f,1.005901f,1.006543f,1.007162f,1.007756f,1.008325f,1.008867f,1.009381f,1.009867f,1.010323f,1.010749f,1.011144f,1.011507f,1.011839f,1.012137f,1.012403f,1.012636f,1.012835f,1.013001f,1.013134f,1.013233f,1.013299f,1.013331f,1.013331f,1.013299f,1.013235f,1.013139f,1.013012f,1.012856f,1.012669f,1.012455f,1.012212f,1.011943f,1.011647f,1.011327f,1.010982f,1.010615f,1.010227f,1.009818f,1.009389f,1.008943f,1.00848f,1.008002f,1.00751f,1.007005f,1.006489f,1.005963f,1.005428f,1.004887f,1.004339f,1.003787f,1.003233f,1.002676f,1.00212f,1.001565f,1.001012f,1.000463f,0.9999193f,0.9993818f,0.998852f,0.998331f,0.9978198f,0.9973199f,0.9968321f,0.9963576f,0.9958972f,0.995452f,0.995023f,0.9946109f,0.9942166f,0.9938408f,0.9934841f,0.9931474f,0.9928312f,0.9925359f,0.9922621f,0.9920102f,0.9917805f,0.9915734f,0.9913891f,0.9912278f,0.9910896f,0.9909745f,0.9908828f,0.9908141f,0.9907685f,0.9907458f,0.9907458f,0.9907683f,0.9908128f,0.9908791f,0.9909668f,0.9910753f,0.9912043f,0.991353f,0.991521f,0.9917077f,0.9919122f,0.992134f,0.9923723f,0.9926264f,0.9928954f,0.9931784f,0.9934747f,0.9937834f,0.9941036f,0.9944344f,0.9947748f,0.9951238f,0.9954807f,0.9958443f,0.9962137f,0.9965881f,0.9969662f,0.9973474f,0.9977305f,0.9981146f,0.9984989f,0.9988822f,0.9992637f,0.9996425f,1.000018f,1.000389f,1.000754f,1.001113f,1.001466f,1.00181f,1.002147f,1.002474f,1.002791f,1.003097f,1.003393f,1.003677f,1.003948f,1.004207f,1.004452f,1.004684f,1.004901f,1.005104f,1.005293f,1.005466f,1.005623f,1.005766f,1.005892f,1.006003f,1.006098f,1.006177f,1.00624f,1.006287f,1.006318f,1.006334f,1.006334f,1.006318f,1.006288f,1.006243f,1.006182f,1.006108f,1.00602f,1.005918f,1.005803f,1.005676f,1.005536f,1.005384f,1.005221f,1.005048f,1.004864f,1.004671f,1.004469f,1.004258f,1.00404f,1.003815f,1.003583f,1.003345f,1.003102f,1.002854f,1.002603f,1.002348f,1.002091f,1.001832f,1.001571f,1.00131f,1.001049f,1.000789f,1.00053f,1.000273f,1.000018f,0.9997668f,0.9995191f,0.9992756f,0.9990369f,0.9988035f,0.9985759f,0.9983547f,0.9981402f,0.9979328f,0.9977331f,0.9975414f,0.997358f,0.9971834f,0.9970178f,0.9968615f,0.9967148f,0.996578f,0.9964512f,0.9963346f,0.9962283f,0.9961326f,0.9960474f,0.9959729f,0.9959091f,0.9958561f,0.9958138f,0.9957821f,0.9957612f,0.9957507f,0.9957507f,0.995761f,0.9957815f,0.9958119f,0.9958521f,0.9959018f,0.9959608f,0.9960288f,0.9961057f,0.9961909f,0.9962842f,0.9963855f,0.9964941f,0.9966097f,0.9967321f,0.9968608f,0.9969954f,0.9971356f,0.9972808f,0.9974308f,0.997585f,0.997743f,0.9979044f,0.9980687f,0.9982356f,0.9984044f,0.998575f,0.9987467f,0.9989191f,0.9990919f,0.9992645f,0.9994367f,0.9996078f,0.9997776f,0.9999457f,1.000112f,1.000275f,1.000436f,1.000593f,1.000746f,1.000896f,1.001042f,1.001183f,1.001319f,1.00145f,1.001576f,1.001697f,1.001811f,1.00192f,1.002022f,1.002118f,1.002208f,1.002291f,1.002367f,1.002436f,1.002499f,1.002555f,1.002603f,1.002645f,1.002679f,1.002707f,1.002727f,1.002741f,1.002748f,1.002748f,1.002741f,1.002728f,1.002708f,1.002682f,1.00265f,1.002612f,1.002568f,1.002518f,1.002463f,1.002403f,1.002337f,1.002267f,1.002192f,1.002114f,1.002031f,1.001944f,1.001854f,1.00176f,1.001664f,1.001565f,1.001464f,1.00136f,1.001255f,1.001148f,1.00104f,1.000931f,1.000821f,1.000711f,1.000601f,1.00049f,1.000381f,1.000272f,1.000164f,1.000057f,0.9999511f,0.9998472f,0.9997452f,0.9996454f,0.9995479f,0.9994529f,0.9993607f,0.9992715f,0.9991852f,0.9991023f,0.9990228f,0.9989468f,0.9988746f,0.9988062f,0.9987416f,0.9986812f,0.9986249f,0.9985727f,0.9985248f,0.9984812f,0.998442f,0.9984071f,0.9983767f,0.9983507f,0.998329f,0.9983118f,0.9982989f,0.9982904f,0.9982862f,0.9982862f,0.9982904f,0.9982986f,0.9983109f,0.9983271f,0.9983471f,0.9983708f,0.9983981f,0.9984289f,0.998463f,0.9985003f,0.9985406f,0.9985839f,0.9986299f,0.9986786f,0.9987296f,0.998783f,0.9988384f,0.9988958f,0.998955f,0.9990157f,0.9990779f,0.9991413f,0.9992057f,0.999271f,0.9993371f,0.9994037f,0.9994707f,0.9995378f,0.9996049f,0.999672f,0.9997387f,0.9998049f,0.9998705f,0.9999354f,0.9999993f,1.000062f,1.000124f,1.000184f,1.000243f,1.0003f,1.000356f,1.00041f,1.000461f,1.000511f,1.000559f,1.000605f,1.000648f,1.000689f,1.000727f,1.000764f,1.000797f,1.000828f,1.000857f,1.000883f,1.000906f,1.000927f,1.000945f,1.00096f,1.000973f,1.000983f,1.000991f,1.000996f,1.000998f,1.000998f,1.000996f,1.000991f,1.000984f,1.000974f,1.000963f,1.000949f,1.000933f,1.000915f,1.000895f,1.000873f,1.00085f,1.000824f,1.000798f,1.000769f,1.00074f,1.000709f,1.000677f,1.000644f,1.000609f,1.000574f,1.000538f,1.000502f,1.000465f,1.000427f,1.000389f,1.000351f,1.000313f,1.000275f,1.000236f,1.000198f,1.00016f,1.000122f,1.000085f,1.000048f,1.000012f,0.9999762f,0.9999413f,0.9999072f,0.999874f,0.9998417f,0.9998104f,0.9997802f,0.9997511f,0.9997231f,0.9996964f,0.9996709f,0.9996467f,0.9996238f,0.9996024f,0.9995822f,0.9995635f,0.9995463f,0.9995304f,0.9995161f,0.9995032f,0.9994918f,0.9994818f,0.9994733f,0.9994662f,0.9994607f,0.9994565f,0.9994537f,0.9994524f,0.9994524f,0.9994537f,0.9994563f,0.9994603f,0.9994655f,0.9994718f,0.9994793f,0.9994879f,0.9994977f,0.9995084f,0.9995201f,0.9995327f,0.9995462f,0.9995605f,0.9995756f,0.9995914f,0.9996079f,0.999625f,0.9996426f,0.9996607f,0.9996793f,0.9996982f,0.9997174f,0.999737f,0.9997567f,0.9997765f,0.9997966f,0.9998166f,0.9998366f,0.9998567f,0.9998765f,0.9998962f,0.9999158f,0.9999351f,0.9999541f,0.9999728f,0.9999911f,1.000009f,1.000026f,1.000043f,1.00006f,1.000076f,1.000091f,1.000106f,1.00012f,1.000134f,1.000147f,1.000159f,1.00017f,1.000181f,1.000191f,1.0002f,1.000209f,1.000217f,1.000224f,1.00023f,1.000236f,1.000241f,1.000245f,1.000248f,1.000251f,1.000253f,1.000255f,1.000255f,1.000255f,1.000255f,1.000253f,1.000251f,1.000249f,1.000246f,1.000242f,1.000238f,1.000234f,1.000229f,1.000223f,1.000217f,1.000211f,1.000204f,1.000197f,1.00019f,1.000182f,1.000174f,1.000166f,1.000157f,1.000149f,1.00014f,1.000131f,1.000123f,1.000114f,1.000105f,1.000096f,1.000087f,1.000078f,1.000069f,1.00006f,1.000051f,1.000042f,1.000034f,1.000026f,1.000017f,1.000009f,1.000001f,0.9999939f,0.9999866f,0.9999794f,0.9999726f,0.9999661f,0.9999598f,0.9999537f,0.999948f,0.9999427f,0.9999375f,0.9999327f,0.9999282f,0.9999241f,0.9999202f,0.9999167f,0.9999135f,0.9999106f,0.999908f,0.9999057f,0.9999037f,0.9999021f,0.9999007f,0.9998996f,0.9998988f,0.9998983f,0.999898f,0.999898f,0.9998983f,0.9998987f,0.9998994f,0.9999004f,0.9999015f,0.9999029f,0.9999045f,0.9999062f,0.9999081f,0.9999101f,0.9999123f,0.9999146f,0.9999171f,0.9999196f,0.9999223f,0.999925f,0.9999278f,0.9999307f,0.9999336f,0.9999366f,0.9999396f,0.9999425f,0.9999456f,0.9999486f,0.9999517f,0.9999547f,0.9999577f,0.9999606f,0.9999635f,0.9999664f,0.9999692f,0.999972f,0.9999747f,0.9999773f,0.9999799f,0.9999824f,0.9999847f,0.999987f,0.9999892f,0.9999913f,0.9999933f,0.9999952f,0.9999971f,0.9999988f,1.0f,1.000002f,1.000003f,1.000005f,1.000006f,1.000007f,1.000008f,1.000009f,1.00001f,1.000011f,1.000011f,1.000012f,1.000012f,1.000013f,1.000013f,1.000013f,1.000013f,1.000014f,1.000014f,1.000014f,1.000014f,1.000013f,1.000013f,1.000013f,1.000013f,1.000013f,1.000012f,1.000012f,1.000012f,1.000011f,1.000011f,1.00001f,1.00001f,1.00001f,1.000009f,1.000009f,1.000008f,1.000008f,1.000007f,1.000007f,1.000006f,1.000006f,1.000006f,1.000005f,1.000005f,1.000004f,1.000004f,1.000004f,1.000003f,1.000003f,1.000003f,1.000002f,1.000002f,1.000002f,1.000002f,1.000002f,1.000001f,1.000001f,1.000001f,1.000001f,1.000001f,1.000001f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f,1.0f};
-const float blep[] = {-0.00000000000000000323952f,-0.000000000006369915f,-0.00000000006437058f,-0.000000000290332f,-0.0000000008765287f,-0.000000002091686f,-0.000000004277924f,-0.000000007849166f,-0.00000001328717f,-0.00000002113675f,-0.00000003200497f,-0.0000000465546f,-0.00000006549886f,-0.00000008959341f,-0.0000001196319f,-0.000000156442f,-0.0000002008762f,-0.0000002538019f,-0.0000003160992f,-0.0000003886443f,-0.0000004723078f,-0.0000005679478f,-0.0000006763945f,-0.0000007984452f,-0.0000009348541f,-0.000001086325f,-0.000001253499f,-0.000001436951f,-0.000001637172f,-0.000001854572f,-0.000002089465f,-0.000002342058f,-0.00000261245f,-0.000002900623f,-0.000003206425f,-0.000003529573f,-0.000003869653f,-0.000004226101f,-0.000004598206f,-0.0000049851f,-0.000005385753f,-0.000005798986f,-0.000006223451f,-0.000006657637f,-0.000007099864f,-0.000007548293f,-0.00000800092f,-0.000008455577f,-0.000008909934f,-0.00000936151f,-0.00000980767f,-0.00001024564f,-0.00001067249f,-0.00001108518f,-0.00001148054f,-0.00001185527f,-0.00001220597f,-0.00001252917f,-0.00001282129f,-0.00001307869f,-0.00001329766f,-0.00001347448f,-0.00001360537f,-0.00001368655f,-0.00001371423f,-0.00001368467f,-0.00001359414f,-0.00001343898f,-0.00001321558f,-0.00001292044f,-0.00001255018f,-0.00001210152f,-0.00001157134f,-0.00001095669f,-0.00001025481f,-0.000009463115f,-0.000008579284f,-0.00000760121f,-0.000006527056f,-0.000005355262f,-0.000004084562f,-0.000002714004f,-0.000001242961f,0.0000003288437f,0.000002001328f,0.000003774041f,0.000005646143f,0.000007616395f,0.000009683151f,0.00001184434f,0.00001409748f,0.00001643963f,0.00001886744f,0.00002137708f,0.00002396428f,0.00002662436f,0.00002935213f,0.00003214199f,0.0000349879f,0.00003788336f,0.00004082146f,0.00004379483f,0.00004679573f,0.00004981598f,0.00005284703f,0.00005587997f,0.00005890552f,0.00006191406f,0.00006489567f,0.00006784013f,0.00007073695f,0.00007357541f,0.00007634455f,0.00007903325f,0.00008163023f,0.00008412409f,0.00008650334f,0.0000887564f,0.00009087173f,0.00009283778f,0.00009464304f,0.00009627614f,0.0000977258f,0.00009898093f,0.0001000307f,0.0001008644f,0.0001014719f,0.000101843f,0.0001019683f,0.0001018386f,0.0001014451f,0.0001007798f,0.00009983495f,0.00009860352f,0.00009707915f,0.00009525608f,0.0000931293f,0.00009069452f,0.00008794825f,0.00008488781f,0.00008151137f,0.00007781796f,0.00007380754f,0.00006948099f,0.00006484013f,0.00005988781f,0.00005462782f,0.00004906502f,0.00004320524f,0.00003705541f,0.00003062348f,0.00002391845f,0.00001695041f,0.000009730472f,0.000002270838f,-0.000005415272f,-0.00001331359f,-0.00002140882f,-0.00002968467f,-0.00003812385f,-0.00004670812f,-0.00005541828f,-0.00006423426f,-0.00007313511f,-0.00008209904f,-0.00009110347f,-0.0001001251f,-0.0001091399f,-0.0001181233f,-0.0001270499f,-0.000135894f,-0.0001446294f,-0.0001532294f,-0.0001616669f,-0.0001699148f,-0.0001779456f,-0.0001857316f,-0.0001932452f,-0.0002004588f,-0.0002073448f,-0.0002138759f,-0.0002200251f,-0.0002257657f,-0.0002310713f,-0.0002359162f,-0.0002402752f,-0.000244124f,-0.0002474388f,-0.0002501969f,-0.0002523763f,-0.0002539564f,-0.0002549172f,-0.0002552405f,-0.000254909f,-0.0002539068f,-0.0002522196f,-0.0002498344f,-0.0002467399f,-0.0002429266f,-0.0002383864f,-0.0002331132f,-0.0002271028f,-0.0002203527f,-0.0002128624f,-0.0002046336f,-0.0001956697f,-0.0001859764f,-0.0001755615f,-0.0001644349f,-0.0001526086f,-0.0001400968f,-0.0001269159f,-0.0001130844f,-0.00009862323f,-0.00008355515f,-0.00006790531f,-0.00005170093f,-0.00003497135f,-0.00001774799f,-0.00000006430653f,0.00001804425f,0.00003654029f,0.00005538454f,0.00007453591f,0.00009395158f,0.000113587f,0.0001333962f,0.0001533316f,0.0001733442f,0.0001933837f,0.0002133988f,0.000233337f,0.0002531448f,0.0002727681f,0.0002921517f,0.0003112403f,0.0003299779f,0.0003483084f,0.0003661753f,0.0003835224f,0.0004002935f,0.0004164328f,0.0004318848f,0.000446595f,0.0004605093f,0.0004735749f,0.0004857398f,0.0004969536f,0.000507167f,0.0005163327f,0.0005244049f,0.0005313397f,0.0005370954f,0.0005416324f,0.0005449138f,0.0005469047f,0.0005475735f,0.0005468909f,0.0005448308f,0.00054137f,0.0005364888f,0.0005301705f,0.0005224018f,0.0005131732f,0.0005024789f,0.0004903163f,0.0004766868f,0.0004615959f,0.0004450528f,0.0004270707f,0.0004076667f,0.0003868621f,0.0003646823f,0.0003411567f,0.0003163186f,0.0002902056f,0.0002628593f,0.0002343253f,0.0002046531f,0.0001738961f,0.0001421117f,0.0001093609f,0.00007570842f,0.00004122265f,0.000005975352f,-0.00002995838f,-0.00006650022f,-0.0001035688f,-0.0001410798f,-0.0001789462f,-0.0002170785f,-0.0002553847f,-0.0002937707f,-0.0003321405f,-0.0003703961f,-0.0004084383f,-0.0004461663f,-0.0004834786f,-0.0005202725f,-0.0005564451f,-0.000591893f,-0.0006265126f,-0.0006602011f,-0.0006928555f,-0.0007243743f,-0.0007546564f,-0.0007836026f,-0.0008111151f,-0.0008370978f,-0.0008614572f,-0.0008841021f,-0.000904944f,-0.0009238975f,-0.0009408806f,-0.0009558149f,-0.0009686257f,-0.0009792425f,-0.0009875991f,-0.0009936342f,-0.0009972911f,-0.0009985183f,-0.0009972695f,-0.0009935042f,-0.0009871871f,-0.0009782895f,-0.0009667881f,-0.0009526666f,-0.0009359143f,-0.0009165279f,-0.0008945101f,-0.0008698707f,-0.0008426263f,-0.0008128004f,-0.0007804235f,-0.0007455333f,-0.0007081743f,-0.0006683981f,-0.0006262636f,-0.0005818366f,-0.0005351896f,-0.0004864023f,-0.0004355611f,-0.0003827592f,-0.000328096f,-0.0002716779f,-0.0002136169f,-0.0001540316f,-0.00009304621f,-0.00003079056f,0.00003260008f,0.00009698531f,0.0001622199f,0.0002281539f,0.0002946334f,0.0003615002f,0.0004285929f,0.0004957465f,0.0005627935f,0.0006295636f,0.0006958846f,0.0007615827f,0.0008264827f,0.0008904086f,0.0009531841f,0.001014633f,0.001074579f,0.001132848f,0.001189267f,0.001243664f,0.001295869f,0.001345717f,0.001393045f,0.001437694f,0.001479508f,0.001518338f,0.001554039f,0.001586471f,0.001615502f,0.001641003f,0.001662856f,0.001680948f,0.001695174f,0.001705439f,0.001711652f,0.001713736f,0.001711619f,0.001705243f,0.001694556f,0.001679517f,0.001660096f,0.001636274f,0.001608041f,0.0015754f,0.001538365f,0.00149696f,0.001451221f,0.001401196f,0.001346943f,0.001288534f,0.00122605f,0.001159585f,0.001089245f,0.001015146f,0.0009374166f,0.0008561945f,0.00077163f,0.0006838836f,0.0005931262f,0.0004995389f,0.0004033126f,0.0003046477f,0.0002037537f,0.0001008489f,-0.000003840135f,-0.0001100789f,-0.0002176257f,-0.0003262317f,-0.0004356419f,-0.0005455953f,-0.0006558261f,-0.0007660633f,-0.0008760325f,-0.0009854554f,-0.001094051f,-0.001201538f,-0.00130763f,-0.001412044f,-0.001514495f,-0.001614698f,-0.001712372f,-0.001807236f,-0.001899013f,-0.001987429f,-0.002072216f,-0.002153111f,-0.002229854f,-0.002302196f,-0.002369893f,-0.002432708f,-0.002490417f,-0.002542802f,-0.002589655f,-0.002630782f,-0.002665998f,-0.002695131f,-0.002718022f,-0.002734525f,-0.002744508f,-0.002747855f,-0.002744461f,-0.002734241f,-0.002717124f,-0.002693054f,-0.002661994f,-0.002623921f,-0.002578833f,-0.002526743f,-0.002467681f,-0.002401698f,-0.002328861f,-0.002249254f,-0.002162981f,-0.002070164f,-0.001970942f,-0.001865473f,-0.001753932f,-0.001636512f,-0.001513423f,-0.001384892f,-0.001251164f,-0.001112499f,-0.0009691728f,-0.0008214777f,-0.0006697202f,-0.000514221f,-0.0003553151f,-0.00019335f,-0.0000286858f,0.0001383057f,0.000307242f,0.0004777306f,0.0006493696f,0.000821749f,0.0009944516f,0.001167053f,0.001339125f,0.001510232f,0.001679939f,0.001847806f,0.002013391f,0.002176254f,0.002335955f,0.002492056f,0.002644122f,0.002791722f,0.002934432f,0.003071832f,0.003203512f,0.003329071f,0.003448114f,0.003560263f,0.003665147f,0.003762412f,0.003851715f,0.003932732f,0.004005152f,0.004068684f,0.004123054f,0.004168006f,0.004203306f,0.004228741f,0.00424412f,0.004249273f,0.004244054f,0.00422834f,0.004202035f,0.004165067f,0.004117389f,0.004058979f,0.003989844f,0.003910016f,0.003819555f,0.003718547f,0.003607107f,0.003485376f,0.003353522f,0.003211743f,0.003060261f,0.002899326f,0.002729217f,0.002550235f,0.002362711f,0.002167f,0.00196348f,0.001752555f,0.001534654f,0.001310225f,0.00107974f,0.0008436934f,0.0006025967f,0.0003569824f,0.0001074001f,-0.0001455836f,-0.0004013866f,-0.0006594124f,-0.0009190518f,-0.001179684f,-0.001440677f,-0.001701391f,-0.001961179f,-0.002219388f,-0.00247536f,-0.002728437f,-0.002977956f,-0.003223258f,-0.003463684f,-0.003698581f,-0.0039273f,-0.004149199f,-0.004363648f,-0.004570025f,-0.00476772f,-0.004956138f,-0.005134701f,-0.005302846f,-0.005460029f,-0.005605729f,-0.005739445f,-0.005860699f,-0.00596904f,-0.006064043f,-0.00614531f,-0.006212472f,-0.006265192f,-0.006303162f,-0.006326111f,-0.006333798f,-0.006326018f,-0.006302603f,-0.00626342f,-0.006208374f,-0.006137409f,-0.006050506f,-0.005947688f,-0.005829014f,-0.005694586f,-0.005544544f,-0.005379071f,-0.005198388f,-0.005002757f,-0.00479248f,-0.004567901f,-0.004329398f,-0.004077394f,-0.003812347f,-0.003534754f,-0.003245149f,-0.002944101f,-0.002632215f,-0.002310131f,-0.001978518f,-0.001638082f,-0.001289554f,-0.0009336979f,-0.0005713021f,-0.0002031813f,0.000169826f,0.0005468592f,0.0009270375f,0.001309462f,0.001693218f,0.002077376f,0.002460995f,0.002843125f,0.003222806f,0.003599075f,0.003970966f,0.004337511f,0.004697745f,0.005050707f,0.005395443f,0.005731007f,0.006056465f,0.006370898f,0.006673403f,0.006963094f,0.007239109f,0.007500608f,0.007746777f,0.007976831f,0.008190016f,0.008385612f,0.008562927f,0.008721316f,0.008860164f,0.008978905f,0.009077011f,0.009153998f,0.009209435f,0.00924293f,0.009254147f,0.009242799f,0.009208652f,0.009151524f,0.009071289f,0.008967876f,0.008841271f,0.008691514f,0.008518705f,0.008323003f,0.008104622f,0.007863839f,0.007600983f,0.007316446f,0.007010677f,0.006684182f,0.006337524f,0.005971322f,0.00558625f,0.005183036f,0.004762464f,0.004325364f,0.003872621f,0.003405168f,0.002923983f,0.00243009f,0.001924557f,0.001408492f,0.0008830409f,0.0003493881f,-0.0001912502f,-0.0007376259f,-0.001288463f,-0.001842458f,-0.002398288f,-0.002954608f,-0.003510056f,-0.004063257f,-0.004612829f,-0.005157377f,-0.005695507f,-0.006225824f,-0.006746934f,-0.007257451f,-0.007756001f,-0.008241222f,-0.008711768f,-0.009166314f,-0.009603563f,-0.01002224f,-0.0104211f,-0.01079894f,-0.0111546f,-0.01148693f,-0.01179486f,-0.01207736f,-0.01233342f,-0.01256214f,-0.01276262f,-0.01293405f,-0.01307567f,-0.01318681f,-0.01326682f,-0.01331517f,-0.01333135f,-0.01331498f,-0.01326571f,-0.01318328f,-0.01306752f,-0.01291832f,-0.01273567f,-0.01251963f,-0.01227035f,-0.01198805f,-0.01167305f,-0.01132575f,-0.01094662f,-0.01053623f,-0.01009522f,-0.009624333f,-0.009124367f,-0.008596216f,-0.008040853f,-0.007459324f,-0.006852756f,-0.006222347f,-0.005569368f,-0.00489516f,-0.004201132f,-0.003488758f,-0.002759571f,-0.002015168f,-0.001257198f,-0.0004873621f,0.0002925875f,0.001080855f,0.001875603f,0.002674958f,0.003477011f,0.004279828f,0.005081446f,0.005879886f,0.006673152f,0.007459238f,0.008236132f,0.009001819f,0.009754293f,0.01049155f,0.01121161f,0.01191249f,0.01259226f,0.01324901f,0.01388084f,0.01448592f,0.01506244f,0.01560867f,0.01612289f,0.01660348f,0.01704885f,0.0174575f,0.01782799f,0.01815895f,0.01844912f,0.01869729f,0.01890235f,0.01906329f,0.01917919f,0.01924923f,0.01927269f,0.01924895f,0.01917751f,0.01905798f,0.01889006f,0.01867359f,0.01840851f,0.0180949f,0.01773293f,0.01732291f,0.01686526f,0.01636053f,0.01580939f,0.01521263f,0.01457115f,0.01388597f,0.01315827f,0.01238928f,0.0115804f,0.01073312f,0.009849051f,0.008929903f,0.007977499f,0.006993767f,0.00598073f,0.004940511f,0.003875322f,0.002787467f,0.001679329f,0.0005533748f,-0.000587859f,-0.001741765f,-0.002905672f,-0.004076854f,-0.005252528f,-0.006429872f,-0.007606018f,-0.008778068f,-0.009943098f,-0.01109816f,-0.0122403f,-0.01336655f,-0.01447395f,-0.01555954f,-0.01662038f,-0.01765356f,-0.01865618f,-0.01962538f,-0.02055838f,-0.0214524f,-0.02230475f,-0.02311279f,-0.02387397f,-0.02458582f,-0.02524593f,-0.025852f,-0.02640185f,-0.02689337f,-0.0273246f,-0.02769367f,-0.02799885f,-0.02823854f,-0.02841127f,-0.02851573f,-0.02855073f,-0.02851526f,-0.02840843f,-0.02822957f,-0.0279781f,-0.02765367f,-0.02725606f,-0.02678525f,-0.02624137f,-0.02562477f,-0.02493592f,-0.02417553f,-0.02334446f,-0.02244375f,-0.02147463f,-0.02043852f,-0.019337f,-0.01817186f,-0.01694503f,-0.01565866f,-0.01431503f,-0.01291662f,-0.01146607f,-0.009966169f,-0.008419888f,-0.006830337f,-0.005200781f,-0.003534626f,-0.001835418f,-0.0001068321f,0.001647328f,0.003423144f,0.005216585f,0.007023519f,0.008839717f,0.01066087f,0.01248258f,0.01430039f,0.01610978f,0.01790618f,0.01968499f,0.02144156f,0.02317124f,0.02486936f,0.02653126f,0.02815228f,0.02972778f,0.03125319f,0.03272393f,0.03413552f,0.03548354f,0.03676362f,0.03797151f,0.03910305f,0.04015419f,0.04112101f,0.04199971f,0.04278665f,0.04347834f,0.04407144f,0.04456281f,0.04494947f,0.04522866f,0.04539782f,0.04545458f,0.04539681f,0.04522262f,0.04493034f,0.04451857f,0.04398613f,0.04333215f,0.04255597f,0.04165725f,0.04063592f,0.03949216f,0.0382265f,0.0368397f,0.03533286f,0.03370737f,0.03196491f,0.03010748f,0.02813736f,0.02605717f,0.02386982f,0.02157851f,0.01918678f,0.01669843f,0.01411759f,0.01144869f,0.008696442f,0.005865842f,0.002962185f,-0.00000896148f,-0.003041753f,-0.006130077f,-0.009267565f,-0.01244759f,-0.01566329f,-0.01890755f,-0.02217305f,-0.02545225f,-0.02873738f,-0.0320205f,-0.03529349f,-0.03854803f,-0.04177567f,-0.0449678f,-0.04811568f,-0.05121044f,-0.05424313f,-0.05720466f,-0.06008592f,-0.0628777f,-0.06557074f,-0.06815578f,-0.07062352f,-0.07296465f,-0.0751699f,-0.07723001f,-0.07913579f,-0.08087808f,-0.08244782f,-0.08383604f,-0.08503391f,-0.08603267f,-0.08682375f,-0.08739872f,-0.08774933f,-0.08786753f,-0.08774547f,-0.08737548f,-0.08675022f,-0.08586251f,-0.08470547f,-0.08327252f,-0.08155733f,-0.07955389f,-0.07725655f,-0.07465991f,-0.07175899f,-0.0685491f,-0.06502596f,-0.06118565f,-0.05702461f,-0.05253971f,-0.04772818f,-0.0425877f,-0.03711634f,-0.03131259f,-0.02517537f,-0.01870404f,-0.0118984f,-0.004758664f,0.002714483f,0.01051993f,0.0186561f,0.02712099f,0.03591214f,0.04502666f,0.05446118f,0.06421193f,0.07427467f,0.08464476f,0.09531708f,0.1062861f,0.117546f,0.1290903f,0.1409123f,0.1530049f,0.1653605f,0.1779712f,0.1908288f,0.2039246f,0.2172496f,0.2307947f,0.24455f,0.2585058f,0.2726517f,0.2869773f,0.3014719f,0.3161243f,0.3309234f,0.3458578f,0.3609158f,0.3760855f,0.3913549f,0.406712f,0.4221444f,0.4376397f,0.4531856f,0.4687693f,0.4843783f,0.5f,0.4843783f,0.4687693f,0.4531856f,0.4376398f,0.4221444f,0.4067121f,0.391355f,0.3760855f,0.3609158f,0.3458579f,0.3309235f,0.3161244f,0.3014719f,0.2869774f,0.2726517f,0.2585058f,0.24455f,0.2307947f,0.2172497f,0.2039246f,0.1908288f,0.1779712f,0.1653605f,0.1530049f,0.1409123f,0.1290903f,0.117546f,0.1062862f,0.09531713f,0.08464479f,0.07427472f,0.06421196f,0.05446124f,0.04502666f,0.03591222f,0.02712101f,0.01865613f,0.01051992f,0.002714515f,-0.004758716f,-0.0118984f,-0.01870406f,-0.02517533f,-0.03131258f,-0.03711629f,-0.04258764f,-0.04772818f,-0.05253971f,-0.0570246f,-0.06118572f,-0.06502593f,-0.06854904f,-0.07175899f,-0.07465994f,-0.07725644f,-0.07955384f,-0.08155727f,-0.08327246f,-0.08470547f,-0.08586252f,-0.08675027f,-0.08737552f,-0.08774543f,-0.0878675f,-0.08774936f,-0.08739877f,-0.0868237f,-0.08603263f,-0.08503389f,-0.08383608f,-0.08244777f,-0.08087802f,-0.07913578f,-0.07722998f,-0.07516992f,-0.07296467f,-0.07062352f,-0.06815577f,-0.06557071f,-0.06287766f,-0.06008589f,-0.0572046f,-0.05424309f,-0.0512104f,-0.04811561f,-0.04496777f,-0.04177558f,-0.03854799f,-0.03529334f,-0.03202045f,-0.02873731f,-0.02545214f,-0.02217293f,-0.01890755f,-0.01566327f,-0.0124476f,-0.009267449f,-0.006130099f,-0.003041744f,-0.000008940697f,0.002962232f,0.005865872f,0.008696496f,0.01144868f,0.01411766f,0.01669848f,0.01918679f,0.02157855f,0.02386987f,0.02605718f,0.02813739f,0.03010756f,0.0319649f,0.03370738f,0.03533292f,0.03683978f,0.03822649f,0.03949219f,0.04063594f,0.04165727f,0.04255605f,0.04333222f,0.0439862f,0.04451865f,0.04493034f,0.04522264f,0.0453968f,0.04545456f,0.04539782f,0.04522866f,0.04494947f,0.04456282f,0.0440715f,0.04347837f,0.04278672f,0.04199976f,0.04112107f,0.04015422f,0.03910309f,0.0379715f,0.03676367f,0.0354836f,0.03413558f,0.03272396f,0.03125322f,0.02972782f,0.02815235f,0.02653128f,0.02486938f,0.02317131f,0.02144158f,0.01968503f,0.01790619f,0.01610982f,0.01430041f,0.01248258f,0.01066089f,0.008839786f,0.007023573f,0.005216599f,0.003423214f,0.001647353f,-0.0001068115f,-0.001835346f,-0.003534675f,-0.005200744f,-0.006830335f,-0.008419752f,-0.009966135f,-0.01146603f,-0.01291656f,-0.01431501f,-0.01565862f,-0.016945f,-0.01817191f,-0.01933706f,-0.02043855f,-0.0214746f,-0.02244365f,-0.0233444f,-0.02417552f,-0.02493584f,-0.02562475f,-0.0262413f,-0.02678525f,-0.02725601f,-0.02765357f,-0.02797806f,-0.02822959f,-0.02840841f,-0.02851522f,-0.02855074f,-0.0285157f,-0.02841127f,-0.02823853f,-0.02799881f,-0.02769363f,-0.02732456f,-0.02689338f,-0.02640176f,-0.02585196f,-0.0252459f,-0.02458572f,-0.02387393f,-0.02311277f,-0.02230465f,-0.02145231f,-0.02055824f,-0.01962543f,-0.01865613f,-0.01765358f,-0.0166204f,-0.01555955f,-0.01447392f,-0.01336646f,-0.01224029f,-0.01109815f,-0.009943008f,-0.008777976f,-0.00760591f,-0.006429911f,-0.005252481f,-0.004076838f,-0.002905607f,-0.001741767f,-0.000587821f,0.0005534291f,0.001679361f,0.00278753f,0.003875315f,0.00494051f,0.00598073f,0.00699383f,0.007977545f,0.008929968f,0.009849131f,0.01073313f,0.01158041f,0.0123893f,0.01315832f,0.01388603f,0.01457119f,0.01521266f,0.01580942f,0.01636058f,0.01686531f,0.0173229f,0.01773292f,0.0180949f,0.01840854f,0.0186736f,0.01889008f,0.01905799f,0.01917756f,0.01924896f,0.01927269f,0.01924926f,0.01917922f,0.01906329f,0.01890236f,0.01869732f,0.01844913f,0.01815897f,0.01782799f,0.01745749f,0.0170489f,0.01660353f,0.01612294f,0.01560873f,0.01506251f,0.01448596f,0.01388085f,0.01324904f,0.01259232f,0.01191252f,0.01121163f,0.01049155f,0.00975436f,0.009001851f,0.00823617f,0.007459283f,0.006673157f,0.005879939f,0.005081475f,0.004279852f,0.003477037f,0.002674997f,0.001875639f,0.001080871f,0.0002925992f,-0.0004873276f,-0.001257181f,-0.002015114f,-0.002759576f,-0.003488779f,-0.004201174f,-0.00489521f,-0.005569339f,-0.006222367f,-0.006852627f,-0.007459283f,-0.008040786f,-0.008596182f,-0.009124279f,-0.009624243f,-0.01009512f,-0.01053619f,-0.01094651f,-0.01132572f,-0.01167297f,-0.01198804f,-0.01227033f,-0.0125196f,-0.01273561f,-0.01291823f,-0.01306748f,-0.01318324f,-0.01326561f,-0.01331496f,-0.01333129f,-0.01331508f,-0.0132668f,-0.01318681f,-0.01307559f,-0.01293397f,-0.01276255f,-0.01256204f,-0.01233339f,-0.01207733f,-0.01179481f,-0.01148689f,-0.01115453f,-0.01079893f,-0.01042104f,-0.01002216f,-0.0096035f,-0.009166241f,-0.008711696f,-0.008241177f,-0.007755876f,-0.007257342f,-0.006747007f,-0.006225824f,-0.005695462f,-0.005157351f,-0.004612803f,-0.004063249f,-0.003509998f,-0.002954602f,-0.002398252f,-0.00184238f,-0.001288414f,-0.0007375479f,-0.0001912117f,0.0003494024f,0.0008831024f,0.001408517f,0.001924634f,0.002430141f,0.002924025f,0.003405213f,0.003872633f,0.00432539f,0.004762471f,0.005183041f,0.005586267f,0.005971372f,0.006337583f,0.006684244f,0.007010698f,0.00731647f,0.007601023f,0.007863879f,0.008104682f,0.008323073f,0.008518755f,0.008691549f,0.008841336f,0.008967936f,0.00907135f,0.009151578f,0.009208679f,0.009242833f,0.009254217f,0.009243011f,0.009209514f,0.009154081f,0.009077072f,0.008978963f,0.00886023f,0.008721352f,0.008562982f,0.008385658f,0.008190036f,0.00797689f,0.007746816f,0.007500648f,0.007239163f,0.006963134f,0.006673455f,0.006370902f,0.006056488f,0.005731046f,0.005395472f,0.005050719f,0.00469774f,0.004337549f,0.003970981f,0.003599107f,0.003222883f,0.002843201f,0.002461076f,0.002077401f,0.001693249f,0.001309514f,0.0009270906f,0.0005468726f,0.0001698732f,-0.0002031326f,-0.0005712509f,-0.0009336472f,-0.001289487f,-0.001638055f,-0.001978517f,-0.002310157f,-0.00263226f,-0.002944112f,-0.003245115f,-0.003534794f,-0.003812313f,-0.004077435f,-0.004329443f,-0.004567862f,-0.004792452f,-0.005002737f,-0.005198359f,-0.005379081f,-0.005544543f,-0.005694628f,-0.005828977f,-0.005947709f,-0.006050467f,-0.006137371f,-0.00620842f,-0.006263494f,-0.006302595f,-0.006326079f,-0.006333828f,-0.006326079f,-0.006303191f,-0.006265163f,-0.006212473f,-0.006145358f,-0.006064057f,-0.005969048f,-0.005860686f,-0.00573945f,-0.005605698f,-0.005460024f,-0.005302906f,-0.005134702f,-0.004956126f,-0.004767776f,-0.004570007f,-0.004363656f,-0.004149199f,-0.00392735f,-0.003698587f,-0.003463626f,-0.0032233f,-0.002977967f,-0.002728462f,-0.002475381f,-0.002219319f,-0.001961112f,-0.001701355f,-0.001440644f,-0.001179695f,-0.0009189844f,-0.0006593466f,-0.0004013777f,-0.0001455545f,0.0001074076f,0.0003570318f,0.0006026626f,0.0008437634f,0.001079798f,0.001310289f,0.0015347f,0.001752615f,0.001963556f,0.002167046f,0.002362788f,0.002550304f,0.002729297f,0.002899408f,0.003060341f,0.003211796f,0.003353596f,0.003485382f,0.003607094f,0.003718555f,0.003819585f,0.003910005f,0.003989875f,0.004059017f,0.00411737f,0.004165053f,0.004202068f,0.004228354f,0.004244089f,0.004249275f,0.004244149f,0.004228771f,0.00420332f,0.004168034f,0.004123092f,0.004068673f,0.004005134f,0.003932714f,0.003851712f,0.003762424f,0.003665149f,0.003560245f,0.003448129f,0.003329158f,0.003203571f,0.003071904f,0.002934515f,0.002791762f,0.002644181f,0.00249213f,0.002336025f,0.002176285f,0.002013445f,0.001847863f,0.001680017f,0.001510262f,0.001339197f,0.001167119f,0.0009945035f,0.0008217692f,0.0006493926f,0.0004777908f,0.0003072619f,0.0001383424f,-0.00002861023f,-0.0001933575f,-0.0003552437f,-0.0005141497f,-0.0006697178f,-0.0008214712f,-0.0009691715f,-0.001112461f,-0.001251101f,-0.001384854f,-0.001513362f,-0.001636505f,-0.001753926f,-0.001865506f,-0.001970887f,-0.002070189f,-0.002162933f,-0.002249241f,-0.002328873f,-0.00240171f,-0.002467632f,-0.00252676f,-0.002578855f,-0.002623916f,-0.002661943f,-0.002693057f,-0.002717137f,-0.002734184f,-0.002744436f,-0.002747893f,-0.002744555f,-0.002734542f,-0.002717972f,-0.002695084f,-0.002665997f,-0.002630711f,-0.002589583f,-0.002542734f,-0.002490401f,-0.002432704f,-0.002369881f,-0.00230217f,-0.00222981f,-0.002153039f,-0.002072215f,-0.001987457f,-0.001899004f,-0.001807213f,-0.001712322f,-0.00161469f,-0.001514435f,-0.001412034f,-0.001307607f,-0.00120151f,-0.001093984f,-0.000985384f,-0.0008759499f,-0.0007660389f,-0.0006557703f,-0.0005456209f,-0.0004355907f,-0.0003261566f,-0.000217557f,-0.0001100302f,-0.000003814697f,0.0001009107f,0.0002037883f,0.0003046989f,0.0004033446f,0.0004996061f,0.0005931854f,0.0006839037f,0.0007716417f,0.0008562207f,0.0009374619f,0.001015186f,0.001089275f,0.001159608f,0.001226068f,0.001288593f,0.001347005f,0.001401246f,0.001451254f,0.00149703f,0.001538396f,0.00157547f,0.001608074f,0.001636326f,0.001660168f,0.00167954f,0.00169462f,0.001705289f,0.001711667f,0.001713812f,0.001711726f,0.001705468f,0.001695216f,0.00168097f,0.00166291f,0.001641035f,0.001615524f,0.001586497f,0.001554072f,0.001518369f,0.001479566f,0.001437724f,0.00139308f,0.001345754f,0.001295924f,0.001243711f,0.001189291f,0.001132905f,0.001074612f,0.00101465f,0.0009532571f,0.0008904338f,0.0008265376f,0.0007616282f,0.0006959438f,0.0006296039f,0.0005628467f,0.0004957914f,0.000428617f,0.0003615618f,0.0002946854f,0.0002281666f,0.0001622438f,0.00009703636f,0.00003266335f,-0.000030756f,-0.00009298325f,-0.0001540184f,-0.000213623f,-0.000271678f,-0.000328064f,-0.000382781f,-0.0004354715f,-0.0004863739f,-0.0005351305f,-0.0005818605f,-0.0006262064f,-0.0006684065f,-0.0007081032f,-0.0007455349f,-0.000780344f,-0.0008127689f,-0.0008425713f,-0.0008698702f,-0.0008944273f,-0.000916481f,-0.0009359121f,-0.0009526014f,-0.0009667873f,-0.0009782314f,-0.0009871721f,-0.0009934902f,-0.0009971857f,-0.000998497f,-0.0009973049f,-0.0009936094f,-0.0009875298f,-0.0009791851f,-0.0009685755f,-0.0009558201f,-0.0009407997f,-0.000923872f,-0.0009049177f,-0.0008840561f,-0.0008614063f,-0.0008370876f,-0.0008111f,-0.0007835627f,-0.0007545948f,-0.0007243156f,-0.0006928444f,-0.000660181f,-0.0006264448f,-0.0005918741f,-0.000556469f,-0.0005202293f,-0.0004833937f,-0.0004460812f,-0.000408411f,-0.0003703833f,-0.0003321171f,-0.0002937317f,-0.0002553463f,-0.0002170801f,-0.0001789331f,-0.0001410246f,-0.0001035929f,-0.00006651878f,-0.00002992153f,0.000005960464f,0.00004124641f,0.0000757575f,0.0001093745f,0.0001421571f,0.0001739264f,0.0002046824f,0.0002343655f,0.0002629161f,0.000290215f,0.0003163815f,0.000341177f,0.0003647208f,0.0003868937f,0.0004076958f,0.0004271269f,0.0004450679f,0.000461638f,0.0004767179f,0.0004903674f,0.0005025268f,0.000513196f,0.0005224347f,0.0005301833f,0.0005365014f,0.000541389f,0.0005448461f,0.0005469322f,0.0005475879f,0.0005469322f,0.0005449653f,0.000541687f,0.0005371571f,0.0005313754f,0.0005244613f,0.000516355f,0.0005072355f,0.0004969835f,0.0004857779f,0.0004736185f,0.0004605651f,0.0004466176f,0.0004318953f,0.0004164577f,0.0004003048f,0.0003835559f,0.0003662109f,0.0003483295f,0.0003300309f,0.0003112555f,0.000292182f,0.0002728105f,0.0002532005f,0.0002333522f,0.0002134442f,0.0001934171f,0.0001733899f,0.0001533628f,0.0001334548f,0.0001136065f,0.00009399652f,0.00007456541f,0.00005543232f,0.00003659725f,0.00001806021f,0.0f,-0.00001776218f,-0.00003492832f,-0.00005161762f,-0.00006783009f,-0.00008356571f,-0.00009858608f,-0.0001130104f,-0.0001268387f,-0.0001400709f,-0.0001525879f,-0.0001643896f,-0.0001754761f,-0.0001859665f,-0.0001956224f,-0.0002045631f,-0.0002127886f,-0.0002202988f,-0.0002270937f,-0.0002330542f,-0.0002382994f,-0.0002429485f,-0.0002467632f,-0.0002497435f,-0.0002521276f,-0.0002539158f,-0.0002548695f,-0.0002552271f,-0.0002548695f,-0.0002539158f,-0.0002523661f,-0.0002502203f,-0.0002473593f,-0.0002441406f,-0.0002402067f,-0.0002359152f,-0.0002310276f,-0.0002257824f,-0.0002199411f,-0.0002138615f,-0.000207305f,-0.0002003908f,-0.0001932383f,-0.0001857281f,-0.0001778603f,-0.0001698732f,-0.0001616478f,-0.0001531839f,-0.0001446009f,-0.0001358986f,-0.0001269579f,-0.0001181364f,-0.0001090765f,-0.0001001358f,-0.0000910759f,-0.00008201599f,-0.00007307529f,-0.00006425381f,-0.00005543232f,-0.00004673004f,-0.00003814697f,-0.00002968311f,-0.00002133846f,-0.00001323223f,-0.000005364418f,0.000002264977f,0.000009775162f,0.00001698732f,0.00002396107f,0.00003063679f,0.00003707409f,0.00004321337f,0.00004911423f,0.00005465746f,0.00005990267f,0.00006484985f,0.00006949902f,0.00007385015f,0.00007784367f,0.00008153915f,0.00008493662f,0.00008797646f,0.00009071827f,0.00009316206f,0.00009530783f,0.00009709597f,0.00009864569f,0.00009989738f,0.0001007915f,0.0001015067f,0.0001018643f,0.0001019835f,0.0001018643f,0.0001015067f,0.0001009107f,0.0001000762f,0.00009900331f,0.00009775162f,0.00009632111f,0.00009465218f,0.00009286404f,0.00009089708f,0.00008881092f,0.00008654594f,0.00008416176f,0.00008165836f,0.00007909536f,0.00007635355f,0.00007361174f,0.00007075071f,0.00006788969f,0.00006490946f,0.00006192923f,0.00005894899f,0.00005590916f,0.00005286932f,0.00004982948f,0.00004684925f,0.00004380941f,0.00004082918f,0.00003790855f,0.00003504753f,0.00003218651f,0.00002938509f,0.00002664328f,0.00002402067f,0.00002139807f,0.00001889467f,0.00001645088f,0.0000141263f,0.00001186132f,0.000009715557f,0.000007629395f,0.000005722046f,0.000003814697f,0.000002026558f,0.0000003576279f,-0.000001192093f,-0.000002622604f,-0.000004053116f,-0.000005364418f,-0.000006437302f,-0.000007510185f,-0.000008583069f,-0.000009417534f,-0.000010252f,-0.00001096725f,-0.0000115633f,-0.00001204014f,-0.00001251698f,-0.0000128746f,-0.00001323223f,-0.00001335144f,-0.00001358986f,-0.00001370907f,-0.00001370907f,-0.00001370907f,-0.00001358986f,-0.00001347065f,-0.00001323223f,-0.00001299381f,-0.00001275539f,-0.00001251698f,-0.00001215935f,-0.00001180172f,-0.00001144409f,-0.00001108646f,-0.00001060963f,-0.000010252f,-0.000009775162f,-0.000009298325f,-0.000008821487f,-0.00000846386f,-0.000007987022f,-0.000007510185f,-0.000007033348f,-0.00000667572f,-0.000006198883f,-0.000005722046f,-0.000005364418f,-0.00000500679f,-0.000004529953f,-0.000004172325f,-0.000003814697f,-0.000003457069f,-0.000003218651f,-0.000002861023f,-0.000002622604f,-0.000002264977f,-0.000002026558f,-0.000001788139f,-0.000001549721f,-0.000001430511f,-0.000001192093f,-0.000001072884f,-0.0000009536743f,-0.0000007152557f,-0.0000005960464f,-0.0000004768372f,-0.0000004768372f,-0.0000003576279f,-0.0000002384186f,-0.0000002384186f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f};
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
 
+//Bleps and blamps
+//
+//The tables are built when the module loads instead of being stored as
+//literals: a Blackman-windowed sinc over +-Samples periods, integrated once
+//for the band-limited step and twice for the band-limited ramp, at full and
+//half cutoff (the d2 tables, used while the voice oscillators run 2x).
+//Only the residuals are kept, mirrored around the center so every table
+//starts and ends at zero.
+//
+//OBXD_BLEP_OVERSAMPLING sets the table points per sample (64 by default,
+//which reproduces the original literal tables to within 2e-7). Lower it
+//to shrink the tables at the cost of coarser interpolation.
+//
+//OBXD_BLEP_FP16 stores the tables as IEEE half floats, widened to float on
+//every read. That halves the hot footprint (the blep and blamp in use are
+//8 KB together at 64x) with residual errors around 1e-4 of the step.
+#ifndef OBXD_BLEP_OVERSAMPLING
+#define OBXD_BLEP_OVERSAMPLING 64
+#endif
 
-const float blepd2[] = {-0.00000000000000000161967f,-0.000000000003185738f,-0.00000000003221653f,-0.0000000001454588f,-0.0000000004397739f,-0.000000001051358f,-0.000000002155025f,-0.000000003964459f,-0.00000000673149f,-0.00000001074516f,-0.00000001633306f,-0.00000002385991f,-0.00000003372702f,-0.00000004637046f,-0.00000006226129f,-0.00000008190624f,-0.0000001058457f,-0.0000001346515f,-0.000000168929f,-0.0000002093113f,-0.0000002564618f,-0.0000003110738f,-0.000000373866f,-0.0000004455827f,-0.0000005269923f,-0.0000006188858f,-0.0000007220755f,-0.0000008373934f,-0.0000009656874f,-0.000001107824f,-0.000001264685f,-0.000001437162f,-0.00000162616f,-0.000001832593f,-0.000002057377f,-0.000002301435f,-0.000002565696f,-0.00000285109f,-0.000003158544f,-0.000003488977f,-0.000003843303f,-0.000004222436f,-0.000004627272f,-0.000005058698f,-0.000005517584f,-0.000006004784f,-0.000006521137f,-0.000007067451f,-0.000007644513f,-0.000008253084f,-0.000008893898f,-0.000009567653f,-0.00001027502f,-0.00001101663f,-0.00001179308f,-0.00001260491f,-0.00001345263f,-0.00001433671f,-0.00001525757f,-0.00001621556f,-0.000017211f,-0.00001824415f,-0.0000193152f,-0.00002042429f,-0.00002157152f,-0.00002275689f,-0.00002398035f,-0.00002524179f,-0.00002654103f,-0.0000278778f,-0.00002925179f,-0.00003066257f,-0.00003210968f,-0.00003359255f,-0.00003511054f,-0.00003666294f,-0.00003824893f,-0.00003986764f,-0.00004151809f,-0.00004319922f,-0.00004490988f,-0.00004664884f,-0.00004841478f,-0.00005020628f,-0.00005202184f,-0.00005385984f,-0.00005571862f,-0.00005759637f,-0.00005949123f,-0.00006140124f,-0.0000633243f,-0.00006525829f,-0.00006720095f,-0.00006914994f,-0.00007110281f,-0.00007305706f,-0.00007501005f,-0.00007695908f,-0.00007890136f,-0.00008083399f,-0.00008275401f,-0.00008465834f,-0.00008654385f,-0.00008840729f,-0.00009024536f,-0.00009205466f,-0.00009383172f,-0.000095573f,-0.00009727487f,-0.00009893363f,-0.0001005455f,-0.0001021067f,-0.0001036133f,-0.0001050614f,-0.0001064468f,-0.0001077657f,-0.0001090137f,-0.0001101868f,-0.0001112808f,-0.0001122913f,-0.000113214f,-0.0001140447f,-0.000114779f,-0.0001154124f,-0.0001159406f,-0.0001163591f,-0.0001166634f,-0.0001168492f,-0.0001169118f,-0.000116847f,-0.0001166501f,-0.0001163167f,-0.0001158424f,-0.0001152229f,-0.0001144535f,-0.0001135301f,-0.0001124482f,-0.0001112036f,-0.000109792f,-0.0001082092f,-0.0001064511f,-0.0001045136f,-0.0001023926f,-0.0001000842f,-0.00009758458f,-0.00009488994f,-0.00009199658f,-0.0000889009f,-0.00008559941f,-0.00008208873f,-0.00007836559f,-0.00007442685f,-0.00007026945f,-0.00006589054f,-0.00006128734f,-0.00005645724f,-0.00005139777f,-0.00004610663f,-0.00004058166f,-0.00003482089f,-0.0000288225f,-0.00002258486f,-0.00001610654f,-0.000009386258f,-0.000002422962f,0.000004784214f,0.00001223593f,0.00001993262f,0.00002787454f,0.00003606169f,0.00004449385f,0.00005317058f,0.0000620912f,0.00007125478f,0.00008066017f,0.00009030596f,0.0001001905f,0.0001103118f,0.0001206677f,0.0001312558f,0.0001420733f,0.0001531173f,0.0001643846f,0.0001758714f,0.0001875742f,0.0001994887f,0.0002116105f,0.000223935f,0.0002364573f,0.000249172f,0.0002620737f,0.0002751564f,0.0002884141f,0.0003018404f,0.0003154284f,0.0003291712f,0.0003430615f,0.0003570916f,0.0003712537f,0.0003855395f,0.0003999405f,0.000414448f,0.0004290529f,0.0004437457f,0.0004585169f,0.0004733566f,0.0004882544f,0.0005031999f,0.0005181824f,0.0005331907f,0.0005482137f,0.0005632396f,0.0005782567f,0.0005932528f,0.0006082157f,0.0006231329f,0.0006379913f,0.0006527781f,0.0006674799f,0.0006820834f,0.0006965747f,0.0007109399f,0.0007251651f,0.0007392359f,0.0007531379f,0.0007668564f,0.0007803766f,0.0007936836f,0.0008067623f,0.0008195976f,0.0008321739f,0.000844476f,0.0008564882f,0.0008681949f,0.0008795803f,0.0008906288f,0.0009013244f,0.0009116511f,0.0009215932f,0.0009311347f,0.0009402594f,0.0009489518f,0.0009571955f,0.0009649748f,0.0009722738f,0.0009790767f,0.0009853678f,0.0009911316f,0.0009963523f,0.001001015f,0.001005103f,0.001008603f,0.001011499f,0.001013776f,0.00101542f,0.001016417f,0.001016751f,0.00101641f,0.001015379f,0.001013645f,0.001011195f,0.001008016f,0.001004095f,0.0009994205f,0.0009939804f,0.0009877633f,0.0009807578f,0.0009729532f,0.0009643392f,0.000954906f,0.0009446439f,0.0009335442f,0.0009215981f,0.0009087975f,0.000895135f,0.0008806036f,0.0008651965f,0.000848908f,0.0008317325f,0.0008136652f,0.000794702f,0.000774839f,0.0007540731f,0.0007324021f,0.0007098241f,0.000686338f,0.0006619433f,0.0006366402f,0.0006104296f,0.0005833131f,0.0005552928f,0.0005263721f,0.0004965544f,0.0004658444f,0.0004342471f,0.0004017687f,0.0003684158f,0.0003341961f,0.0002991177f,0.0002631898f,0.0002264222f,0.0001888257f,0.0001504118f,0.0001111927f,0.00007118154f,0.00003039229f,-0.00001116031f,-0.00005346067f,-0.0000964924f,-0.0001402383f,-0.0001846802f,-0.0002297993f,-0.0002755758f,-0.0003219893f,-0.0003690184f,-0.0004166407f,-0.0004648334f,-0.0005135727f,-0.0005628338f,-0.0006125913f,-0.000662819f,-0.0007134899f,-0.0007645761f,-0.0008160491f,-0.0008678794f,-0.000920037f,-0.0009724909f,-0.00102521f,-0.001078161f,-0.001131311f,-0.001184627f,-0.001238074f,-0.001291617f,-0.00134522f,-0.001398848f,-0.001452461f,-0.001506024f,-0.001559498f,-0.001612844f,-0.001666023f,-0.001718994f,-0.001771718f,-0.001824153f,-0.001876258f,-0.001927992f,-0.001979311f,-0.002030175f,-0.002080539f,-0.00213036f,-0.002179594f,-0.002228199f,-0.002276128f,-0.002323339f,-0.002369787f,-0.002415426f,-0.002460211f,-0.002504098f,-0.002547042f,-0.002588998f,-0.002629919f,-0.002669761f,-0.002708479f,-0.002746028f,-0.002782363f,-0.002817438f,-0.002851211f,-0.002883635f,-0.002914667f,-0.002944263f,-0.00297238f,-0.002998974f,-0.003024003f,-0.003047425f,-0.003069197f,-0.003089278f,-0.003107628f,-0.003124206f,-0.003138973f,-0.00315189f,-0.003162918f,-0.003172021f,-0.003179162f,-0.003184305f,-0.003187414f,-0.003188456f,-0.003187397f,-0.003184207f,-0.003178852f,-0.003171303f,-0.003161532f,-0.003149509f,-0.003135209f,-0.003118605f,-0.003099674f,-0.003078392f,-0.003054736f,-0.003028688f,-0.003000228f,-0.002969338f,-0.002936001f,-0.002900203f,-0.002861931f,-0.002821172f,-0.002777917f,-0.002732157f,-0.002683884f,-0.002633093f,-0.002579781f,-0.002523945f,-0.002465585f,-0.002404703f,-0.002341301f,-0.002275385f,-0.002206962f,-0.00213604f,-0.002062629f,-0.001986742f,-0.001908393f,-0.001827599f,-0.001744377f,-0.001658747f,-0.001570732f,-0.001480356f,-0.001387644f,-0.001292624f,-0.001195326f,-0.001095782f,-0.0009940268f,-0.0008900951f,-0.0007840253f,-0.0006758572f,-0.000565633f,-0.0004533964f,-0.0003391936f,-0.0002230724f,-0.000105083f,0.00001472269f,0.0001362908f,0.0002595653f,0.0003844883f,0.0005110001f,0.0006390389f,0.0007685409f,0.0008994406f,0.001031671f,0.001165162f,0.001299842f,0.00143564f,0.00157248f,0.001710286f,0.001848979f,0.001988479f,0.002128706f,0.002269576f,0.002411004f,0.002552905f,0.002695189f,0.002837768f,0.002980551f,0.003123446f,0.00326636f,0.003409198f,0.003551865f,0.003694262f,0.003836291f,0.003977854f,0.00411885f,0.004259177f,0.004398733f,0.004537415f,0.00467512f,0.004811741f,0.004947175f,0.005081315f,0.005214054f,0.005345285f,0.005474902f,0.005602796f,0.005728859f,0.005852982f,0.005975059f,0.006094979f,0.006212635f,0.006327918f,0.00644072f,0.006550934f,0.00665845f,0.006763163f,0.006864965f,0.006963751f,0.007059414f,0.00715185f,0.007240955f,0.007326625f,0.007408758f,0.007487254f,0.007562011f,0.007632932f,0.007699918f,0.007762874f,0.007821703f,0.007876316f,0.007926617f,0.007972518f,0.00801393f,0.008050769f,0.008082949f,0.008110387f,0.008133005f,0.008150723f,0.008163468f,0.008171163f,0.00817374f,0.00817113f,0.008163267f,0.008150087f,0.008131531f,0.008107541f,0.008078063f,0.008043045f,0.008002439f,0.007956197f,0.007904279f,0.007846646f,0.007783261f,0.007714093f,0.007639111f,0.007558292f,0.007471613f,0.007379055f,0.007280606f,0.007176253f,0.007065989f,0.006949811f,0.006827721f,0.006699723f,0.006565826f,0.006426041f,0.006280387f,0.006128883f,0.005971555f,0.005808432f,0.005639548f,0.005464939f,0.005284648f,0.005098721f,0.004907209f,0.004710167f,0.004507652f,0.00429973f,0.004086467f,0.003867937f,0.003644215f,0.003415383f,0.003181526f,0.002942733f,0.002699099f,0.002450722f,0.002197705f,0.001940155f,0.001678183f,0.001411905f,0.001141442f,0.000866916f,0.0005884565f,0.0003061958f,0.00002027045f,-0.000269179f,-0.0005620078f,-0.0008580672f,-0.001157205f,-0.001459264f,-0.001764085f,-0.002071504f,-0.002381352f,-0.002693458f,-0.003007648f,-0.003323744f,-0.003641563f,-0.003960921f,-0.004281629f,-0.004603496f,-0.004926328f,-0.005249927f,-0.005574093f,-0.005898623f,-0.006223311f,-0.006547949f,-0.006872326f,-0.00719623f,-0.007519444f,-0.007841753f,-0.008162936f,-0.008482771f,-0.008801037f,-0.009117509f,-0.009431961f,-0.009744165f,-0.01005389f,-0.01036091f,-0.010665f,-0.01096591f,-0.01126343f,-0.01155732f,-0.01184733f,-0.01213325f,-0.01241484f,-0.01269186f,-0.01296409f,-0.01323128f,-0.01349321f,-0.01374965f,-0.01400036f,-0.01424511f,-0.01448369f,-0.01471586f,-0.01494139f,-0.01516007f,-0.01537166f,-0.01557596f,-0.01577274f,-0.01596179f,-0.01614289f,-0.01631584f,-0.01648043f,-0.01663646f,-0.01678371f,-0.016922f,-0.01705114f,-0.01717092f,-0.01728117f,-0.01738171f,-0.01747235f,-0.01755291f,-0.01762324f,-0.01768317f,-0.01773253f,-0.01777117f,-0.01779895f,-0.01781571f,-0.01782132f,-0.01781564f,-0.01779855f,-0.01776993f,-0.01772966f,-0.01767763f,-0.01761373f,-0.01753788f,-0.01744997f,-0.01734994f,-0.01723769f,-0.01711316f,-0.0169763f,-0.01682703f,-0.01666532f,-0.01649113f,-0.01630442f,-0.01610517f,-0.01589336f,-0.01566898f,-0.01543203f,-0.01518252f,-0.01492045f,-0.01464587f,-0.01435879f,-0.01405925f,-0.01374731f,-0.01342301f,-0.01308644f,-0.01273765f,-0.01237674f,-0.01200379f,-0.0116189f,-0.01122219f,-0.01081377f,-0.01039376f,-0.009962313f,-0.009519557f,-0.009065652f,-0.008600758f,-0.008125048f,-0.0076387f,-0.007141904f,-0.006634858f,-0.006117766f,-0.005590844f,-0.005054317f,-0.004508416f,-0.003953383f,-0.003389467f,-0.002816927f,-0.002236029f,-0.001647047f,-0.001050266f,-0.0004459769f,0.000165521f,0.0007839202f,0.001408905f,0.002040152f,0.002677331f,0.003320103f,0.003968121f,0.004621034f,0.005278481f,0.005940095f,0.0066055f,0.007274317f,0.007946159f,0.008620631f,0.009297334f,0.009975861f,0.0106558f,0.01133674f,0.01201825f,0.01269991f,0.01338128f,0.01406193f,0.01474141f,0.01541928f,0.01609509f,0.01676838f,0.01743869f,0.01810557f,0.01876855f,0.01942716f,0.02008093f,0.02072939f,0.02137206f,0.02200848f,0.02263816f,0.02326062f,0.02387539f,0.02448198f,0.02507991f,0.0256687f,0.02624788f,0.02681695f,0.02737544f,0.02792288f,0.02845878f,0.02898267f,0.02949408f,0.02999254f,0.03047758f,0.03094872f,0.03140552f,0.03184751f,0.03227424f,0.03268526f,0.03308013f,0.03345839f,0.03381962f,0.0341634f,0.03448929f,0.03479686f,0.03508573f,0.03535548f,0.03560571f,0.03583604f,0.03604608f,0.03623546f,0.03640382f,0.03655079f,0.03667603f,0.03677921f,0.03685999f,0.03691806f,0.03695311f,0.03696484f,0.03695297f,0.03691722f,0.03685733f,0.03677304f,0.03666413f,0.03653035f,0.0363715f,0.03618737f,0.03597778f,0.03574255f,0.03548152f,0.03519455f,0.03488149f,0.03454224f,0.03417668f,0.03378474f,0.03336633f,0.0329214f,0.03244991f,0.03195183f,0.03142714f,0.03087586f,0.030298f,0.02969361f,0.02906274f,0.02840545f,0.02772185f,0.02701204f,0.02627613f,0.02551428f,0.02472663f,0.02391337f,0.0230747f,0.02221081f,0.02132195f,0.02040835f,0.0194703f,0.01850806f,0.01752196f,0.01651229f,0.01547941f,0.01442367f,0.01334546f,0.01224515f,0.01112318f,0.009979959f,0.008815948f,0.007631614f,0.006427442f,0.005203937f,0.003961621f,0.002701037f,0.001422742f,0.0001273141f,-0.001184653f,-0.002512547f,-0.003855737f,-0.005213577f,-0.006585402f,-0.007970529f,-0.00936826f,-0.01077788f,-0.01219865f,-0.01362984f,-0.01507066f,-0.01652035f,-0.01797809f,-0.0194431f,-0.02091452f,-0.02239153f,-0.02387326f,-0.02535884f,-0.02684739f,-0.028338f,-0.02982976f,-0.03132175f,-0.03281301f,-0.03430261f,-0.03578957f,-0.03727291f,-0.03875165f,-0.04022479f,-0.04169131f,-0.04315019f,-0.0446004f,-0.0460409f,-0.04747063f,-0.04888854f,-0.05029355f,-0.05168458f,-0.05306056f,-0.05442039f,-0.05576296f,-0.05708718f,-0.05839193f,-0.0596761f,-0.06093856f,-0.06217818f,-0.06339383f,-0.06458439f,-0.06574871f,-0.06688564f,-0.06799406f,-0.06907281f,-0.07012075f,-0.07113673f,-0.07211961f,-0.07306824f,-0.07398148f,-0.07485817f,-0.07569721f,-0.07649741f,-0.07725767f,-0.07797684f,-0.0786538f,-0.07928742f,-0.07987659f,-0.0804202f,-0.08091713f,-0.08136629f,-0.08176658f,-0.08211693f,-0.08241626f,-0.08266348f,-0.08285757f,-0.08299746f,-0.0830821f,-0.08311049f,-0.0830816f,-0.08299442f,-0.08284799f,-0.0826413f,-0.0823734f,-0.08204335f,-0.0816502f,-0.08119304f,-0.08067096f,-0.08008306f,-0.0794285f,-0.0787064f,-0.07791593f,-0.07705627f,-0.07612661f,-0.07512619f,-0.07405424f,-0.07291f,-0.07169278f,-0.07040184f,-0.06903653f,-0.06759617f,-0.06608013f,-0.0644878f,-0.06281858f,-0.0610719f,-0.05924723f,-0.05734402f,-0.05536178f,-0.05330006f,-0.05115838f,-0.04893633f,-0.04663351f,-0.04424955f,-0.04178409f,-0.03923682f,-0.03660745f,-0.03389569f,-0.03110133f,-0.02822413f,-0.02526391f,-0.02222052f,-0.01909383f,-0.01588372f,-0.01259014f,-0.009213022f,-0.00575236f,-0.002208161f,0.001419533f,0.005130656f,0.008925108f,0.01280277f,0.01676347f,0.02080704f,0.02493326f,0.02914189f,0.03343265f,0.03780524f,0.04225933f,0.04679457f,0.05141056f,0.05610688f,0.06088309f,0.06573872f,0.07067324f,0.07568614f,0.08077685f,0.08594477f,0.09118929f,0.09650976f,0.1019055f,0.1073758f,0.11292f,0.1185372f,0.1242267f,0.1299877f,0.1358194f,0.1417208f,0.1476911f,0.1537294f,0.1598347f,0.166006f,0.1722424f,0.1785428f,0.1849062f,0.1913315f,0.1978177f,0.2043636f,0.210968f,0.2176299f,0.224348f,0.2311212f,0.2379481f,0.2448276f,0.2517585f,0.2587393f,0.2657689f,0.2728458f,0.2799688f,0.2871364f,0.2943474f,0.3016003f,0.3088937f,0.3162261f,0.3235962f,0.3310025f,0.3384435f,0.3459177f,0.3534236f,0.3609598f,0.3685246f,0.3761167f,0.3837343f,0.391376f,0.3990403f,0.4067255f,0.4144301f,0.4221524f,0.4298909f,0.437644f,0.44541f,0.4531875f,0.4609746f,0.4687699f,0.4765718f,0.4843785f,0.4921884f,0.5f,0.4921885f,0.4843785f,0.4765718f,0.4687699f,0.4609746f,0.4531875f,0.44541f,0.4376439f,0.4298909f,0.4221524f,0.41443f,0.4067255f,0.3990403f,0.391376f,0.3837343f,0.3761167f,0.3685246f,0.3609598f,0.3534237f,0.3459177f,0.3384435f,0.3310025f,0.3235962f,0.3162261f,0.3088936f,0.3016003f,0.2943474f,0.2871364f,0.2799687f,0.2728457f,0.2657688f,0.2587394f,0.2517585f,0.2448276f,0.2379481f,0.2311212f,0.224348f,0.2176298f,0.210968f,0.2043636f,0.1978177f,0.1913315f,0.1849062f,0.1785428f,0.1722424f,0.166006f,0.1598346f,0.1537294f,0.1476911f,0.1417208f,0.1358194f,0.1299878f,0.1242267f,0.1185372f,0.11292f,0.1073758f,0.1019055f,0.09650975f,0.09118927f,0.08594477f,0.08077681f,0.07568616f,0.07067323f,0.06573874f,0.0608831f,0.05610687f,0.05141056f,0.04679453f,0.04225934f,0.03780526f,0.03343266f,0.02914184f,0.02493328f,0.02080703f,0.01676345f,0.01280278f,0.00892508f,0.005130649f,0.001419544f,-0.002208233f,-0.005752325f,-0.00921309f,-0.01259017f,-0.01588368f,-0.01909387f,-0.02222049f,-0.02526391f,-0.02822423f,-0.03110135f,-0.03389573f,-0.03660738f,-0.0392369f,-0.04178405f,-0.04424953f,-0.0466336f,-0.04893625f,-0.05115831f,-0.05330002f,-0.05536187f,-0.05734408f,-0.05924726f,-0.06107199f,-0.06281865f,-0.06448781f,-0.06608009f,-0.0675962f,-0.06903648f,-0.07040191f,-0.07169282f,-0.07290995f,-0.07405424f,-0.07512617f,-0.07612669f,-0.07705629f,-0.07791603f,-0.07870638f,-0.07942855f,-0.08008301f,-0.08067095f,-0.08119309f,-0.08165026f,-0.08204329f,-0.08237338f,-0.08264124f,-0.08284795f,-0.08299446f,-0.0830816f,-0.08311057f,-0.08308208f,-0.08299744f,-0.08285761f,-0.08266354f,-0.0824163f,-0.08211684f,-0.08176649f,-0.0813663f,-0.08091712f,-0.08042014f,-0.07987666f,-0.07928741f,-0.07865381f,-0.07797694f,-0.07725763f,-0.07649732f,-0.07569718f,-0.07485819f,-0.07398152f,-0.07306826f,-0.07211959f,-0.07113671f,-0.07012081f,-0.06907272f,-0.06799412f,-0.06688571f,-0.06574869f,-0.06458437f,-0.06339383f,-0.06217813f,-0.0609386f,-0.05967605f,-0.05839193f,-0.05708718f,-0.05576301f,-0.05442035f,-0.05306053f,-0.05168462f,-0.05029356f,-0.04888844f,-0.04747057f,-0.04604089f,-0.04460049f,-0.04315019f,-0.0416913f,-0.04022479f,-0.03875172f,-0.03727293f,-0.03578949f,-0.03430259f,-0.03281295f,-0.03132176f,-0.02982974f,-0.02833807f,-0.02684736f,-0.0253588f,-0.02387321f,-0.02239156f,-0.02091455f,-0.01944304f,-0.01797807f,-0.01652038f,-0.01507068f,-0.01362991f,-0.01219857f,-0.01077783f,-0.0093683f,-0.007970572f,-0.00658536f,-0.005213618f,-0.003855705f,-0.002512574f,-0.001184583f,0.0001273155f,0.001422763f,0.002701044f,0.003961623f,0.005203903f,0.006427407f,0.0076316f,0.008815885f,0.009979963f,0.01112318f,0.01224518f,0.01334548f,0.01442367f,0.01547939f,0.01651227f,0.01752192f,0.01850808f,0.01947027f,0.02040833f,0.02132195f,0.02221084f,0.02307469f,0.02391338f,0.02472663f,0.02551425f,0.02627611f,0.02701205f,0.02772182f,0.02840543f,0.02906269f,0.0296936f,0.03029799f,0.0308758f,0.03142715f,0.03195179f,0.0324499f,0.03292137f,0.03336632f,0.03378469f,0.03417671f,0.0345422f,0.03488147f,0.03519458f,0.03548151f,0.03574252f,0.03597778f,0.03618735f,0.03637147f,0.03653032f,0.03666413f,0.03677303f,0.03685731f,0.03691721f,0.03695297f,0.03696483f,0.03695309f,0.03691804f,0.03685999f,0.03677922f,0.03667599f,0.03655076f,0.03640378f,0.03623545f,0.03604609f,0.03583604f,0.03560567f,0.03535551f,0.03508574f,0.03479683f,0.03448927f,0.03416342f,0.03381962f,0.03345841f,0.0330801f,0.03268528f,0.03227425f,0.03184748f,0.03140551f,0.0309487f,0.03047758f,0.02999252f,0.02949405f,0.0289827f,0.02845877f,0.02792287f,0.0273754f,0.02681696f,0.02624792f,0.02566868f,0.02507991f,0.02448195f,0.02387536f,0.02326065f,0.02263814f,0.02200848f,0.02137208f,0.02072942f,0.02008092f,0.01942718f,0.01876855f,0.01810557f,0.01743865f,0.0167684f,0.0160951f,0.01541924f,0.01474142f,0.01406193f,0.0133813f,0.0126999f,0.01201826f,0.01133674f,0.01065576f,0.009975851f,0.009297311f,0.00862062f,0.007946134f,0.00727433f,0.006605506f,0.005940139f,0.005278468f,0.004621029f,0.00396812f,0.003320098f,0.002677321f,0.002040148f,0.001408935f,0.0007839203f,0.0001655221f,-0.000445962f,-0.001050234f,-0.001646996f,-0.002236009f,-0.002816916f,-0.003389478f,-0.003953457f,-0.004508495f,-0.005054355f,-0.005590916f,-0.006117821f,-0.006634831f,-0.007141948f,-0.007638693f,-0.008125067f,-0.008600712f,-0.009065628f,-0.009519577f,-0.00996232f,-0.01039374f,-0.01081371f,-0.01122224f,-0.01161897f,-0.01200378f,-0.01237667f,-0.01273763f,-0.01308644f,-0.01342309f,-0.01374722f,-0.01405919f,-0.01435876f,-0.01464581f,-0.01492047f,-0.0151825f,-0.01543212f,-0.01566899f,-0.01589334f,-0.01610518f,-0.01630437f,-0.01649117f,-0.01666534f,-0.01682711f,-0.01697636f,-0.01711321f,-0.01723778f,-0.01734996f,-0.01744998f,-0.01753783f,-0.01761365f,-0.01767755f,-0.01772964f,-0.01776993f,-0.01779854f,-0.01781559f,-0.01782131f,-0.01781571f,-0.0177989f,-0.01777112f,-0.0177325f,-0.01768315f,-0.01762319f,-0.01755285f,-0.01747227f,-0.01738179f,-0.01728117f,-0.01717103f,-0.01705122f,-0.016922f,-0.01678371f,-0.01663649f,-0.01648045f,-0.01631582f,-0.01614285f,-0.01596177f,-0.0157727f,-0.01557589f,-0.01537168f,-0.01516008f,-0.01494145f,-0.01471591f,-0.01448369f,-0.01424503f,-0.0140003f,-0.0137496f,-0.0134933f,-0.01323128f,-0.01296413f,-0.01269186f,-0.01241481f,-0.01213324f,-0.01184738f,-0.01155734f,-0.01126349f,-0.01096594f,-0.01066494f,-0.01036084f,-0.01005387f,-0.009744167f,-0.009431958f,-0.009117484f,-0.008800983f,-0.008482695f,-0.008162975f,-0.007841825f,-0.007519484f,-0.007196188f,-0.006872296f,-0.006547928f,-0.006223321f,-0.005898714f,-0.005574107f,-0.005249977f,-0.004926324f,-0.004603505f,-0.00428164f,-0.003960967f,-0.003641605f,-0.003323674f,-0.00300765f,-0.002693415f,-0.002381444f,-0.0020715f,-0.001764059f,-0.001459241f,-0.001157165f,-0.0008580685f,-0.0005620718f,-0.0002691746f,0.00002026558f,0.0003061891f,0.0005884171f,0.00086689f,0.001141429f,0.001411915f,0.001678169f,0.001940131f,0.002197742f,0.002450705f,0.002699077f,0.002942741f,0.003181517f,0.003415346f,0.003644228f,0.003867924f,0.004086494f,0.0042997f,0.004507661f,0.004710138f,0.004907191f,0.00509876f,0.005284607f,0.005464911f,0.005639553f,0.005808413f,0.005971551f,0.006128848f,0.006280363f,0.006426036f,0.006565809f,0.006699741f,0.006827712f,0.006949842f,0.007065952f,0.00717622f,0.007280588f,0.007379055f,0.007471621f,0.007558286f,0.00763911f,0.007714093f,0.007783294f,0.007846653f,0.007904232f,0.007956147f,0.0080024f,0.008042991f,0.008078039f,0.008107543f,0.008131504f,0.008150041f,0.008163273f,0.008171082f,0.008173704f,0.008171141f,0.008163452f,0.008150697f,0.008132994f,0.008110344f,0.008082926f,0.00805074f,0.008013904f,0.007972479f,0.007926583f,0.007876337f,0.007821739f,0.007762909f,0.007699907f,0.007632911f,0.007562041f,0.007487237f,0.007408738f,0.007326603f,0.007240951f,0.007151842f,0.007059395f,0.00696373f,0.006864965f,0.00676316f,0.006658435f,0.006550908f,0.006440699f,0.006327927f,0.006212592f,0.006094933f,0.005975068f,0.005852997f,0.005728841f,0.005602777f,0.005474865f,0.005345285f,0.005214036f,0.005081356f,0.004947186f,0.004811764f,0.00467509f,0.004537404f,0.004398704f,0.004259169f,0.00411886f,0.003977835f,0.003836274f,0.003694236f,0.003551841f,0.003409147f,0.003266394f,0.003123462f,0.00298053f,0.002837777f,0.002695203f,0.002552867f,0.002410948f,0.002269566f,0.00212872f,0.001988471f,0.001848996f,0.001710296f,0.00157243f,0.001435637f,0.001299858f,0.001165152f,0.001031697f,0.0008994341f,0.0007685423f,0.0006390214f,0.0005110502f,0.0003845096f,0.0002595782f,0.0001363158f,0.00001466274f,-0.0001051426f,-0.0002230406f,-0.0003392696f,-0.0004534721f,-0.0005656481f,-0.0006759167f,-0.0007840395f,-0.0008900166f,-0.0009939671f,-0.001095772f,-0.001195312f,-0.001292586f,-0.001387596f,-0.001480341f,-0.001570702f,-0.001658797f,-0.00174439f,-0.001827598f,-0.001908422f,-0.001986742f,-0.002062678f,-0.002136111f,-0.002207041f,-0.002275467f,-0.00234139f,-0.00240469f,-0.002465606f,-0.002524018f,-0.002579808f,-0.002633095f,-0.002683997f,-0.002732158f,-0.002777815f,-0.002821088f,-0.002861857f,-0.002900124f,-0.002936006f,-0.002969265f,-0.00300014f,-0.003028631f,-0.003054738f,-0.003078341f,-0.00309968f,-0.003118634f,-0.003135204f,-0.003149509f,-0.00316155f,-0.003171325f,-0.003178835f,-0.003184199f,-0.003187418f,-0.003188491f,-0.003187418f,-0.003184319f,-0.003179193f,-0.00317204f,-0.003162861f,-0.003151894f,-0.0031389f,-0.003124237f,-0.003107548f,-0.00308919f,-0.003069162f,-0.003047347f,-0.003023982f,-0.002998948f,-0.002972364f,-0.002944231f,-0.002914667f,-0.002883554f,-0.002851129f,-0.002817392f,-0.002782345f,-0.002745986f,-0.002708435f,-0.002669811f,-0.002629995f,-0.002589107f,-0.002547145f,-0.00250411f,-0.002460241f,-0.002415419f,-0.002369881f,-0.002323389f,-0.002276182f,-0.00222826f,-0.002179623f,-0.002130389f,-0.00208056f,-0.002030253f,-0.001979351f,-0.001927972f,-0.001876235f,-0.001824141f,-0.001771688f,-0.001718998f,-0.001666069f,-0.001612782f,-0.001559496f,-0.001505971f,-0.001452446f,-0.001398802f,-0.001345158f,-0.001291633f,-0.001237988f,-0.001184583f,-0.001131296f,-0.001078129f,-0.0010252f,-0.0009723902f,-0.0009199381f,-0.0008678436f,-0.0008161068f,-0.0007646084f,-0.0007135868f,-0.0006629229f,-0.0006126165f,-0.0005629063f,-0.0005136728f,-0.0004649162f,-0.0004166365f,-0.000369072f,-0.0003219843f,-0.0002756119f,-0.0002298355f,-0.0001846552f,-0.0001403093f,-0.00009655952f,-0.00005352497f,-0.00001120567f,0.00003039837f,0.00007116795f,0.0001111627f,0.0001503825f,0.0001888275f,0.000226438f,0.0002632141f,0.0002991557f,0.0003342032f,0.0003684163f,0.0004017949f,0.0004342794f,0.0004658699f,0.0004965663f,0.000526309f,0.0005552769f,0.0005832911f,0.0006104112f,0.0006366372f,0.0006619096f,0.0006862879f,0.0007097721f,0.0007323623f,0.0007540584f,0.0007748008f,0.0007947087f,0.000813663f,0.0008317232f,0.0008488894f,0.0008651614f,0.000880599f,0.0008951426f,0.000908792f,0.000921607f,0.0009335279f,0.0009446144f,0.000954926f,0.0009643435f,0.0009729266f,0.0009807348f,0.0009877682f,0.0009939671f,0.0009993911f,0.0010041f,0.001008034f,0.001011193f,0.001013637f,0.001015365f,0.001016378f,0.001016736f,0.001016438f,0.001015425f,0.001013756f,0.001011491f,0.00100857f,0.001005113f,0.001001f,0.0009963512f,0.000991106f,0.000985384f,0.0009790659f,0.000972271f,0.0009649396f,0.000957191f,0.0009489655f,0.0009402633f,0.0009311438f,0.000921607f,0.000911653f,0.0009013414f,0.0008906126f,0.0008795857f,0.0008682013f,0.0008564591f,0.0008444786f,0.0008321404f,0.0008195639f,0.0008067489f,0.0007936358f,0.000780344f,0.0007668138f,0.0007531047f,0.0007392168f,0.0007251501f,0.0007109046f,0.0006965399f,0.000682056f,0.0006674528f,0.0006527305f,0.0006379485f,0.000623107f,0.0006082058f,0.000593245f,0.0005782247f,0.0005632043f,0.0005481839f,0.0005331635f,0.0005182028f,0.000503242f,0.0004882813f,0.0004733801f,0.0004585385f,0.0004437566f,0.0004290938f,0.0004144907f,0.0003999472f,0.0003855824f,0.0003712773f,0.0003570914f,0.0003430843f,0.0003291965f,0.0003154278f,0.0003018379f,0.0002884269f,0.000275135f,0.0002620816f,0.000249207f,0.0002364516f,0.0002239347f,0.0002115965f,0.0001994967f,0.0001875758f,0.0001758933f,0.0001643896f,0.0001531243f,0.0001420975f,0.0001312494f,0.0001206398f,0.0001103282f,0.0001001954f,0.00009030104f,0.00008064508f,0.00007122755f,0.00006210804f,0.00005316734f,0.00004446507f,0.00003600121f,0.00002789497f,0.00001990795f,0.00001227856f,0.000004768372f,-0.000002384186f,-0.000009417534f,-0.00001609325f,-0.00002264977f,-0.00002884865f,-0.00003480911f,-0.00004065037f,-0.000046134f,-0.0000513792f,-0.0000565052f,-0.00006127357f,-0.00006592274f,-0.00007033348f,-0.0000743866f,-0.0000783205f,-0.0000821352f,-0.00008559227f,-0.00008893013f,-0.00009202957f,-0.00009489059f,-0.00009763241f,-0.0001001358f,-0.0001024008f,-0.0001045465f,-0.0001064539f,-0.000108242f,-0.0001097918f,-0.0001112223f,-0.0001124144f,-0.0001134872f,-0.0001144409f,-0.0001152754f,-0.0001158714f,-0.0001163483f,-0.0001167059f,-0.0001168251f,-0.0001169443f,-0.0001168251f,-0.0001167059f,-0.0001163483f,-0.0001159906f,-0.0001153946f,-0.0001147985f,-0.0001140833f,-0.0001132488f,-0.0001122952f,-0.0001113415f,-0.0001101494f,-0.0001090765f,-0.0001077652f,-0.0001064539f,-0.0001050234f,-0.0001035929f,-0.0001021624f,-0.0001006126f,-0.00009894371f,-0.00009727478f,-0.00009560585f,-0.00009381771f,-0.00009202957f,-0.00009024143f,-0.00008845329f,-0.00008654594f,-0.0000846386f,-0.00008273125f,-0.0000808239f,-0.00007891655f,-0.0000770092f,-0.00007498264f,-0.00007307529f,-0.00007116795f,-0.00006914139f,-0.00006723404f,-0.00006532669f,-0.00006330013f,-0.00006139278f,-0.00005948544f,-0.00005757809f,-0.00005578995f,-0.0000538826f,-0.00005197525f,-0.00005018711f,-0.00004839897f,-0.00004661083f,-0.0000449419f,-0.00004315376f,-0.00004148483f,-0.00003993511f,-0.00003826618f,-0.00003671646f,-0.00003516674f,-0.00003361702f,-0.0000320673f,-0.00003063679f,-0.00002920628f,-0.00002789497f,-0.00002658367f,-0.00002527237f,-0.00002396107f,-0.00002276897f,-0.00002157688f,-0.00002038479f,-0.0000193119f,-0.00001823902f,-0.00001716614f,-0.00001621246f,-0.00001525879f,-0.00001430511f,-0.00001347065f,-0.00001263618f,-0.00001180172f,-0.00001096725f,-0.000010252f,-0.000009536743f,-0.000008940697f,-0.000008225441f,-0.000007629395f,-0.000007033348f,-0.000006556511f,-0.000005960464f,-0.000005483627f,-0.000005125999f,-0.000004649162f,-0.000004291534f,-0.000003814697f,-0.000003457069f,-0.000003218651f,-0.000002861023f,-0.000002622604f,-0.000002264977f,-0.000002026558f,-0.000001788139f,-0.00000166893f,-0.000001430511f,-0.000001311302f,-0.000001072884f,-0.0000009536743f,-0.000000834465f,-0.0000007152557f,-0.0000005960464f,-0.0000005960464f,-0.0000004768372f,-0.0000003576279f,-0.0000003576279f,-0.0000002384186f,-0.0000002384186f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f};
-//const float sinc[] = {-0.0000000000000004146626f,-0.0000000008153554f,-0.000000006608794f,-0.00000002231452f,-0.00000005271932f,-0.0000001028222f,-0.0000001770186f,-0.0000002801043f,-0.0000004159667f,-0.0000005887875f,-0.0000008023567f,-0.000001060012f,-0.000001364875f,-0.000001719254f,-0.000002125701f,-0.000002586037f,-0.000003101586f,-0.000003672964f,-0.000004301162f,-0.000004984693f,-0.000005724337f,-0.000006517685f,-0.000007363614f,-0.000008259004f,-0.000009201491f,-0.0000101869f,-0.00001121161f,-0.00001227042f,-0.00001335814f,-0.00001446934f,-0.00001559716f,-0.00001673499f,-0.00001787554f,-0.00001901093f,-0.00002013206f,-0.00002123126f,-0.00002229924f,-0.00002332655f,-0.00002430342f,-0.00002521937f,-0.00002606464f,-0.00002682964f,-0.00002750236f,-0.00002807389f,-0.00002853177f,-0.00002886753f,-0.00002906936f,-0.00002912718f,-0.000029031f,-0.00002877125f,-0.00002833774f,-0.00002772232f,-0.00002691563f,-0.00002590959f,-0.00002469638f,-0.00002326917f,-0.00002162164f,-0.00001974807f,-0.00001764343f,-0.00001530361f,-0.00001272567f,-0.000009907111f,-0.00000684668f,-0.000003544063f,-0.000000000008901719f,0.000003783726f,0.000007804163f,0.00001205734f,0.00001653795f,0.00002123973f,0.00002615455f,0.00003127437f,0.00003658899f,0.00004208669f,0.00004775569f,0.00005358154f,0.00005954991f,0.00006564461f,0.00007184826f,0.00007814272f,0.00008450833f,0.00009092462f,0.00009737042f,0.0001038224f,0.0001102575f,0.0001166518f,0.0001229794f,0.0001292151f,0.0001353321f,0.000141303f,0.0001471007f,0.0001526976f,0.0001580642f,0.0001631721f,0.0001679937f,0.0001724985f,0.0001766593f,0.0001804467f,0.0001838327f,0.0001867896f,0.0001892897f,0.0001913057f,0.0001928118f,0.0001937835f,0.0001941954f,0.0001940243f,0.0001932491f,0.0001918477f,0.0001898017f,0.0001870925f,0.0001837039f,0.0001796213f,0.000174832f,0.0001693253f,0.0001630917f,0.0001561247f,0.0001484201f,0.0001399752f,0.0001307896f,0.0001208665f,0.00011021f,0.00009882782f,0.00008673003f,0.0000739288f,0.00006043956f,0.0000462813f,0.00003147223f,0.00001603677f,0.0000000008828794f,-0.00001660678f,-0.00003375489f,-0.0000514095f,-0.0000695338f,-0.00008808904f,-0.0001070329f,-0.0001263218f,-0.000145909f,-0.0001657452f,-0.0001857798f,-0.0002059596f,-0.0002262292f,-0.0002465314f,-0.0002668072f,-0.0002869967f,-0.0003070371f,-0.0003268659f,-0.000346418f,-0.0003656279f,-0.0003844293f,-0.0004027559f,-0.0004205392f,-0.0004377116f,-0.000454206f,-0.0004699535f,-0.0004848879f,-0.0004989429f,-0.0005120507f,-0.0005241478f,-0.0005351699f,-0.0005450547f,-0.000553741f,-0.00056117f,-0.0005672854f,-0.0005720326f,-0.0005753601f,-0.0005772181f,-0.0005775608f,-0.0005763454f,-0.0005735324f,-0.0005690854f,-0.0005629727f,-0.0005551658f,-0.0005456408f,-0.0005343778f,-0.0005213624f,-0.0005065827f,-0.0004900339f,-0.0004717147f,-0.0004516297f,-0.000429788f,-0.000406206f,-0.0003808998f,-0.0003538964f,-0.0003252267f,-0.0002949268f,-0.0002630385f,-0.000229609f,-0.0001946912f,-0.0001583428f,-0.000120628f,-0.00008161574f,-0.00004138021f,-0.000000001174241f,0.00004243673f,0.00008584376f,0.0001301253f,0.0001751824f,0.0002209108f,0.0002672028f,0.0003139461f,0.0003610245f,0.0004083186f,0.0004557047f,0.0005030571f,0.0005502466f,0.0005971416f,0.0006436078f,0.0006895107f,0.0007347089f,0.0007790703f,0.0008224531f,0.0008647171f,0.0009057221f,0.0009453298f,0.0009834005f,0.001019797f,0.001054382f,0.001087023f,0.001117587f,0.001145945f,0.001171971f,0.001195542f,0.001216542f,0.001234855f,0.001250372f,0.001262989f,0.001272609f,0.001279139f,0.001282493f,0.001282592f,0.001279365f,0.001272746f,0.001262679f,0.001249115f,0.001232014f,0.001211347f,0.001187091f,0.001159229f,0.001127759f,0.001092688f,0.00105403f,0.001011812f,0.0009660691f,0.0009168474f,0.000864203f,0.0008082025f,0.0007489228f,0.0006864509f,0.0006208845f,0.0005523318f,0.0004809105f,0.0004067487f,0.0003299846f,0.0002507657f,0.0001692495f,0.0000856025f,0.0000000001681457f,-0.00008737317f,-0.0001763248f,-0.0002666543f,-0.0003581528f,-0.0004506052f,-0.000543789f,-0.0006374689f,-0.0007314237f,-0.0008254071f,-0.0009191742f,-0.001012476f,-0.001105061f,-0.001196674f,-0.001287056f,-0.001375949f,-0.001463091f,-0.001548222f,-0.001631081f,-0.001711408f,-0.001788947f,-0.001863441f,-0.001934638f,-0.002002289f,-0.002066152f,-0.002125988f,-0.002181563f,-0.002232653f,-0.002279041f,-0.002320517f,-0.002356879f,-0.002387938f,-0.002413512f,-0.002433432f,-0.002447542f,-0.002455695f,-0.002457758f,-0.002453611f,-0.002443153f,-0.002426289f,-0.002402947f,-0.002373065f,-0.002336601f,-0.002293528f,-0.002243834f,-0.002187526f,-0.002124629f,-0.002055183f,-0.001979249f,-0.001896903f,-0.001808241f,-0.001713377f,-0.001612443f,-0.001505588f,-0.00139298f,-0.001274806f,-0.00115127f,-0.001022592f,-0.0008890104f,-0.0007507814f,-0.0006081769f,-0.000461485f,-0.0003110093f,-0.0001570807f,-0.000000008495208f,0.0001598481f,0.0003221285f,0.0004864598f,0.0006524571f,0.000819725f,0.0009878575f,0.00115644f,0.001325049f,0.001493253f,0.001660617f,0.001826699f,0.00199105f,0.002153224f,0.002312767f,0.00246923f,0.002622157f,0.002771102f,0.002915614f,0.003055251f,0.003189574f,0.003318152f,0.003440559f,0.003556381f,0.003665211f,0.003766656f,0.003860328f,0.00394587f,0.004022923f,0.00409115f,0.004150231f,0.004199864f,0.004239767f,0.004269676f,0.004289354f,0.00429858f,0.004297161f,0.004284924f,0.004261725f,0.004227444f,0.004181986f,0.004125285f,0.004057304f,0.003978032f,0.003887486f,0.003785716f,0.003672798f,0.003548839f,0.003413976f,0.003268377f,0.003112238f,0.002945788f,0.002769281f,0.002583016f,0.002387291f,0.002182461f,0.0019689f,0.00174701f,0.001517221f,0.001279992f,0.001035804f,0.0007851754f,0.0005286208f,0.0002667053f,0.000000007400844f,-0.0002708732f,-0.0005453171f,-0.000822686f,-0.001102325f,-0.001383562f,-0.001665712f,-0.001948076f,-0.002229945f,-0.0025106f,-0.002789313f,-0.00306534f,-0.003337967f,-0.003606441f,-0.003870023f,-0.004127973f,-0.004379555f,-0.004624038f,-0.004860698f,-0.005088819f,-0.0053077f,-0.005516648f,-0.005714987f,-0.005902058f,-0.006077222f,-0.006239852f,-0.006389364f,-0.00652518f,-0.006646751f,-0.006753562f,-0.006845124f,-0.00692098f,-0.006980707f,-0.007023915f,-0.007050253f,-0.007059402f,-0.007051091f,-0.007025081f,-0.006981179f,-0.006919236f,-0.006839138f,-0.006740823f,-0.006624273f,-0.006489516f,-0.006336622f,-0.006165716f,-0.005976964f,-0.005770581f,-0.005546832f,-0.005306027f,-0.005048524f,-0.00477473f,-0.004485108f,-0.004180138f,-0.003860373f,-0.003526405f,-0.003178869f,-0.002818443f,-0.002445847f,-0.002061841f,-0.001667227f,-0.001262844f,-0.0008495661f,-0.0004283041f,-0.0000000006289513f,0.0004343705f,0.0008737893f,0.00131726f,0.001763712f,0.002212069f,0.002661236f,0.003110097f,0.003557526f,0.004002382f,0.004443516f,0.004879772f,0.005309992f,0.005733015f,0.006147682f,0.006552839f,0.006947331f,0.007330051f,0.007699865f,0.008055672f,0.008396389f,0.008720956f,0.009028343f,0.009317543f,0.009587592f,0.009837545f,0.01006651f,0.01027363f,0.01045809f,0.01061911f,0.01075599f,0.01086805f,0.01095467f,0.01101531f,0.01104945f,0.01105666f,0.01103655f,0.0109888f,0.01091318f,0.01080948f,0.0106776f,0.01051749f,0.01032917f,0.01011273f,0.009868354f,0.009596256f,0.009296756f,0.00897024f,0.008617165f,0.008238057f,0.007833519f,0.007404223f,0.006950913f,0.006474404f,0.005975578f,0.005455385f,0.00491484f,0.004355025f,0.003777103f,0.003182234f,0.002571699f,0.001946815f,0.001308951f,0.0006595271f,0.000000009461362f,-0.0006680909f,-0.001343222f,-0.002023795f,-0.002708186f,-0.003394742f,-0.004081781f,-0.004767576f,-0.005450455f,-0.006128659f,-0.006800437f,-0.007464038f,-0.008117707f,-0.008759692f,-0.009388247f,-0.01000164f,-0.01059814f,-0.01117607f,-0.01173375f,-0.01226953f,-0.0127818f,-0.01326898f,-0.01372957f,-0.01416208f,-0.01456508f,-0.01493718f,-0.01527709f,-0.01558354f,-0.01585537f,-0.01609145f,-0.01629075f,-0.01645232f,-0.01657528f,-0.01665884f,-0.01670231f,-0.01670508f,-0.01666663f,-0.01658654f,-0.0164645f,-0.01630028f,-0.01609377f,-0.01584496f,-0.01555393f,-0.0152209f,-0.01484616f,-0.01443012f,-0.01397332f,-0.01347637f,-0.01294003f,-0.01236515f,-0.01175264f,-0.01110358f,-0.01041913f,-0.009700547f,-0.008949202f,-0.008166554f,-0.007354157f,-0.006513661f,-0.005646806f,-0.004755417f,-0.003841405f,-0.002906756f,-0.001953536f,-0.0009839179f,-0.00000002677436f,0.0009958354f,0.002001349f,0.003014139f,0.004031789f,0.005051837f,0.006071787f,0.007089114f,0.008101269f,0.009105683f,0.01009978f,0.01108097f,0.01204668f,0.01299429f,0.01392132f,0.01482519f,0.01570338f,0.01655342f,0.01737287f,0.01815933f,0.01891047f,0.019624f,0.02029773f,0.0209295f,0.02151725f,0.02205902f,0.02255288f,0.0229971f,0.02338997f,0.02372991f,0.02401544f,0.02424522f,0.02441803f,0.02453276f,0.02458844f,0.02458423f,0.02451945f,0.02439353f,0.02420606f,0.0239568f,0.02364562f,0.02327256f,0.02283782f,0.02234174f,0.02178482f,0.02116774f,0.0204913f,0.01975648f,0.01896442f,0.01811638f,0.01721383f,0.01625833f,0.01525163f,0.01419561f,0.01309236f,0.01194394f,0.01075272f,0.009521124f,0.008251725f,0.006947211f,0.00561039f,0.004244183f,0.002851616f,0.001435816f,0.000000001403875f,-0.00145252f,-0.002918363f,-0.00439407f,-0.00587606f,-0.00736087f,-0.00884482f,-0.01032424f,-0.01179543f,-0.01325468f,-0.01469825f,-0.01612241f,-0.01752342f,-0.01889757f,-0.02024117f,-0.02155055f,-0.02282209f,-0.02405223f,-0.02523742f,-0.02637431f,-0.0274595f,-0.02848973f,-0.02946183f,-0.03037274f,-0.03121951f,-0.03199932f,-0.03270948f,-0.03334744f,-0.03391081f,-0.03439734f,-0.03480496f,-0.03513174f,-0.03537596f,-0.03553608f,-0.03561075f,-0.03559877f,-0.0354992f,-0.03531127f,-0.03503444f,-0.03466836f,-0.03421291f,-0.03366818f,-0.03303449f,-0.03231237f,-0.03150259f,-0.03060617f,-0.02962425f,-0.02855828f,-0.02740993f,-0.02618106f,-0.02487379f,-0.02349042f,-0.02203347f,-0.02050567f,-0.01890997f,-0.01724951f,-0.01552762f,-0.01374781f,-0.0119138f,-0.0100295f,-0.008098888f,-0.006126203f,-0.004115802f,-0.002072226f,-0.00000002869215f,0.002095997f,0.00421098f,0.006339955f,0.008477859f,0.01061955f,0.01275979f,0.01489339f,0.01701499f,0.01911927f,0.02120086f,0.0232544f,0.02527455f,0.02725591f,0.02919327f,0.03108134f,0.03291493f,0.03468891f,0.03639825f,0.03803802f,0.03960337f,0.04108968f,0.04249235f,0.04380699f,0.04502936f,0.0461554f,0.04718123f,0.04810321f,0.04891787f,0.04962195f,0.05021247f,0.05068666f,0.05104201f,0.05127627f,0.05138747f,0.0513739f,0.05123415f,0.05096708f,0.05057187f,0.05004799f,0.04939524f,0.04861367f,0.04770371f,0.04666609f,0.04550183f,0.04421232f,0.04279922f,0.04126459f,0.03961067f,0.03784013f,0.03595594f,0.03396135f,0.03185993f,0.02965557f,0.02735246f,0.02495498f,0.0224679f,0.01989624f,0.01724527f,0.01452052f,0.01172776f,0.00887305f,0.005962508f,0.003002622f,0.00000002152608f,-0.003038481f,-0.006105907f,-0.009195124f,-0.0122988f,-0.01540967f,-0.01852018f,-0.02162274f,-0.0247097f,-0.02777335f,-0.03080594f,-0.03379967f,-0.03674688f,-0.03963977f,-0.04247065f,-0.04523187f,-0.04791586f,-0.05051514f,-0.05302232f,-0.05543026f,-0.05773184f,-0.05992015f,-0.0619885f,-0.06393037f,-0.06573948f,-0.06740976f,-0.06893552f,-0.0703112f,-0.07153161f,-0.07259185f,-0.07348735f,-0.07421388f,-0.07476757f,-0.07514492f,-0.07534279f,-0.07535845f,-0.07518956f,-0.07483421f,-0.07429089f,-0.07355858f,-0.07263661f,-0.07152481f,-0.07022347f,-0.06873333f,-0.06705556f,-0.06519189f,-0.06314433f,-0.06091555f,-0.05850857f,-0.05592693f,-0.05317461f,-0.05025607f,-0.04717624f,-0.04394036f,-0.04055427f,-0.03702418f,-0.03335674f,-0.029559f,-0.02563841f,-0.02160291f,-0.01746054f,-0.01321998f,-0.008890141f,-0.004480294f,-0.000000002192331f,0.004540871f,0.009132098f,0.01376347f,0.01842427f,0.02310366f,0.02779062f,0.03247395f,0.03714232f,0.0417842f,0.0463882f,0.05094265f,0.05543588f,0.0598562f,0.064192f,0.06843164f,0.07256348f,0.07657623f,0.08045848f,0.08419903f,0.08778686f,0.09121118f,0.0944614f,0.09752715f,0.1003985f,0.1030657f,0.1055193f,0.1077504f,0.1097502f,0.1115106f,0.1130238f,0.1142825f,0.1152799f,0.1160096f,0.1164658f,0.1166434f,0.1165375f,0.1161442f,0.1154599f,0.1144818f,0.1132076f,0.1116357f,0.1097653f,0.1075961f,0.1051285f,0.1023636f,0.09930325f,0.09594999f,0.09230704f,0.08837839f,0.08416864f,0.07968318f,0.07492816f,0.06991026f,0.06463706f,0.05911672f,0.05335823f,0.04737101f,0.04116539f,0.03475232f,0.02814324f,0.02135037f,0.01438651f,0.00726512f,0.00000002611637f,-0.007394183f,-0.01490238f,-0.02250916f,-0.03019838f,-0.03795356f,-0.04575768f,-0.05359355f,-0.0614434f,-0.06928907f,-0.07711238f,-0.0848946f,-0.09261686f,-0.10026f,-0.1078048f,-0.115232f,-0.1225218f,-0.1296549f,-0.1366116f,-0.1433723f,-0.1499174f,-0.1562276f,-0.1622836f,-0.168066f,-0.1735561f,-0.1787352f,-0.1835847f,-0.1880867f,-0.1922233f,-0.1959773f,-0.1993317f,-0.2022702f,-0.2047768f,-0.2068361f,-0.2084333f,-0.2095544f,-0.2101858f,-0.2103146f,-0.2099288f,-0.2090169f,-0.2075684f,-0.2055734f,-0.2030229f,-0.1999089f,-0.1962242f,-0.1919623f,-0.1871178f,-0.1816863f,-0.1756642f,-0.169049f,-0.1618391f,-0.1540339f,-0.1456339f,-0.1366405f,-0.1270562f,-0.1168846f,-0.1061302f,-0.09479851f,-0.08289628f,-0.07043102f,-0.05741157f,-0.04384747f,-0.02974959f,-0.01512949f,-0.00000002739072f,0.01562519f,0.03173161f,0.0483035f,0.0653245f,0.08277708f,0.1006431f,0.1189033f,0.1375377f,0.1565259f,0.175846f,0.195476f,0.2153927f,0.2355728f,0.255992f,0.2766253f,0.2974475f,0.3184327f,0.3395546f,0.3607862f,0.3821005f,0.4034701f,0.424867f,0.4462633f,0.4676306f,0.4889406f,0.5101647f,0.5312744f,0.5522412f,0.5730364f,0.5936315f,0.6139982f,0.6341084f,0.6539341f,0.6734477f,0.6926218f,0.7114294f,0.729844f,0.7478397f,0.7653905f,0.7824718f,0.799059f,0.8151283f,0.8306565f,0.8456216f,0.8600014f,0.8737755f,0.8869239f,0.8994272f,0.9112675f,0.9224272f,0.9328903f,0.9426413f,0.9516659f,0.959951f,0.9674842f,0.9742547f,0.9802522f,0.9854683f,0.9898949f,0.9935255f,0.9963549f,0.9983789f,0.9995946f,0.9999999f,0.9995946f,0.9983789f,0.9963549f,0.9935255f,0.9898949f,0.9854683f,0.9802522f,0.9742547f,0.9674842f,0.959951f,0.9516659f,0.9426413f,0.9328903f,0.9224272f,0.9112675f,0.8994272f,0.8869239f,0.8737755f,0.8600014f,0.8456215f,0.8306565f,0.8151283f,0.799059f,0.7824718f,0.7653905f,0.7478396f,0.729844f,0.7114294f,0.6926218f,0.6734477f,0.6539341f,0.6341084f,0.6139982f,0.5936314f,0.5730364f,0.5522412f,0.5312744f,0.5101647f,0.4889405f,0.4676306f,0.4462633f,0.424867f,0.40347f,0.3821005f,0.3607862f,0.3395546f,0.3184327f,0.2974475f,0.2766253f,0.255992f,0.2355728f,0.2153927f,0.195476f,0.175846f,0.1565259f,0.1375377f,0.1189033f,0.1006431f,0.08277708f,0.0653245f,0.0483035f,0.03173161f,0.01562519f,-0.00000002739072f,-0.01512949f,-0.02974959f,-0.04384747f,-0.05741156f,-0.07043102f,-0.08289627f,-0.09479851f,-0.1061301f,-0.1168846f,-0.1270562f,-0.1366405f,-0.1456338f,-0.1540339f,-0.1618391f,-0.169049f,-0.1756642f,-0.1816863f,-0.1871178f,-0.1919623f,-0.1962242f,-0.1999089f,-0.2030229f,-0.2055734f,-0.2075684f,-0.2090169f,-0.2099288f,-0.2103146f,-0.2101858f,-0.2095544f,-0.2084333f,-0.206836f,-0.2047767f,-0.2022702f,-0.1993317f,-0.1959773f,-0.1922233f,-0.1880867f,-0.1835847f,-0.1787352f,-0.1735561f,-0.168066f,-0.1622836f,-0.1562276f,-0.1499174f,-0.1433723f,-0.1366116f,-0.1296549f,-0.1225218f,-0.115232f,-0.1078048f,-0.10026f,-0.09261685f,-0.0848946f,-0.07711238f,-0.06928907f,-0.06144339f,-0.05359355f,-0.04575768f,-0.03795356f,-0.03019838f,-0.02250916f,-0.01490238f,-0.007394183f,0.00000002611637f,0.007265119f,0.01438651f,0.02135037f,0.02814324f,0.03475232f,0.04116539f,0.04737101f,0.05335823f,0.05911672f,0.06463704f,0.06991026f,0.07492816f,0.07968318f,0.08416864f,0.08837839f,0.09230704f,0.09594998f,0.09930325f,0.1023636f,0.1051285f,0.1075961f,0.1097653f,0.1116357f,0.1132076f,0.1144817f,0.1154599f,0.1161442f,0.1165375f,0.1166434f,0.1164658f,0.1160096f,0.1152799f,0.1142825f,0.1130238f,0.1115106f,0.1097502f,0.1077504f,0.1055193f,0.1030657f,0.1003985f,0.09752715f,0.0944614f,0.09121117f,0.08778685f,0.08419901f,0.08045847f,0.07657623f,0.07256348f,0.06843164f,0.064192f,0.0598562f,0.05543587f,0.05094265f,0.0463882f,0.04178419f,0.03714232f,0.03247395f,0.02779061f,0.02310366f,0.01842427f,0.01376347f,0.009132098f,0.00454087f,-0.00000000219233f,-0.004480293f,-0.008890141f,-0.01321997f,-0.01746054f,-0.0216029f,-0.02563841f,-0.029559f,-0.03335674f,-0.03702418f,-0.04055427f,-0.04394036f,-0.04717624f,-0.05025606f,-0.05317461f,-0.05592692f,-0.05850857f,-0.06091554f,-0.06314433f,-0.06519188f,-0.06705556f,-0.06873333f,-0.07022347f,-0.07152481f,-0.0726366f,-0.07355858f,-0.07429089f,-0.0748342f,-0.07518955f,-0.07535844f,-0.07534278f,-0.07514492f,-0.07476757f,-0.07421388f,-0.07348734f,-0.07259185f,-0.07153161f,-0.07031119f,-0.06893551f,-0.06740976f,-0.06573948f,-0.06393037f,-0.0619885f,-0.05992015f,-0.05773184f,-0.05543025f,-0.05302231f,-0.05051513f,-0.04791585f,-0.04523186f,-0.04247064f,-0.03963977f,-0.03674688f,-0.03379967f,-0.03080594f,-0.02777335f,-0.0247097f,-0.02162274f,-0.01852018f,-0.01540967f,-0.0122988f,-0.009195124f,-0.006105906f,-0.003038481f,0.00000002152608f,0.003002621f,0.005962508f,0.008873048f,0.01172776f,0.01452052f,0.01724527f,0.01989624f,0.0224679f,0.02495498f,0.02735246f,0.02965556f,0.03185993f,0.03396134f,0.03595594f,0.03784013f,0.03961066f,0.04126458f,0.04279922f,0.04421232f,0.04550183f,0.04666607f,0.0477037f,0.04861366f,0.04939524f,0.05004799f,0.05057187f,0.05096708f,0.05123416f,0.05137391f,0.05138747f,0.05127627f,0.05104201f,0.05068666f,0.05021247f,0.04962194f,0.04891786f,0.0481032f,0.04718122f,0.0461554f,0.04502935f,0.04380699f,0.04249234f,0.04108967f,0.03960337f,0.03803802f,0.03639825f,0.03468891f,0.03291493f,0.03108134f,0.02919327f,0.02725591f,0.02527454f,0.0232544f,0.02120086f,0.01911926f,0.01701499f,0.01489338f,0.01275979f,0.01061955f,0.008477859f,0.006339955f,0.00421098f,0.002095996f,-0.00000002869215f,-0.002072225f,-0.0041158f,-0.0061262f,-0.008098885f,-0.0100295f,-0.0119138f,-0.01374781f,-0.01552761f,-0.01724951f,-0.01890997f,-0.02050567f,-0.02203346f,-0.02349042f,-0.02487379f,-0.02618107f,-0.02740993f,-0.02855828f,-0.02962425f,-0.03060617f,-0.03150259f,-0.03231237f,-0.03303449f,-0.03366818f,-0.03421291f,-0.03466836f,-0.03503444f,-0.03531127f,-0.03549919f,-0.03559877f,-0.03561074f,-0.03553608f,-0.03537595f,-0.03513173f,-0.03480495f,-0.03439734f,-0.0339108f,-0.03334744f,-0.03270948f,-0.03199931f,-0.03121951f,-0.03037274f,-0.02946183f,-0.02848973f,-0.0274595f,-0.02637431f,-0.02523741f,-0.02405223f,-0.02282208f,-0.02155054f,-0.02024117f,-0.01889757f,-0.01752342f,-0.01612241f,-0.01469825f,-0.01325468f,-0.01179543f,-0.01032424f,-0.008844816f,-0.007360869f,-0.005876058f,-0.004394068f,-0.002918362f,-0.00145252f,0.000000001403874f,0.001435815f,0.002851615f,0.004244182f,0.005610391f,0.006947211f,0.008251725f,0.009521126f,0.01075272f,0.01194394f,0.01309236f,0.01419561f,0.01525163f,0.01625833f,0.01721382f,0.01811638f,0.01896442f,0.01975648f,0.0204913f,0.02116774f,0.02178482f,0.02234173f,0.02283782f,0.02327256f,0.02364562f,0.02395679f,0.02420606f,0.02439352f,0.02451944f,0.02458423f,0.02458843f,0.02453275f,0.02441803f,0.02424522f,0.02401544f,0.0237299f,0.02338997f,0.0229971f,0.02255288f,0.02205901f,0.02151725f,0.02092949f,0.02029772f,0.019624f,0.01891046f,0.01815932f,0.01737286f,0.01655341f,0.01570337f,0.01482518f,0.01392131f,0.01299429f,0.01204667f,0.01108097f,0.01009977f,0.009105679f,0.008101264f,0.007089111f,0.006071784f,0.005051837f,0.004031789f,0.003014139f,0.002001349f,0.0009958356f,-0.00000002677436f,-0.0009839179f,-0.001953536f,-0.002906756f,-0.003841405f,-0.004755417f,-0.005646806f,-0.00651366f,-0.007354157f,-0.008166554f,-0.008949202f,-0.009700547f,-0.01041913f,-0.01110358f,-0.01175264f,-0.01236514f,-0.01294002f,-0.01347637f,-0.01397331f,-0.01443012f,-0.01484615f,-0.01522089f,-0.01555393f,-0.01584495f,-0.01609377f,-0.01630028f,-0.01646449f,-0.01658654f,-0.01666662f,-0.01670508f,-0.01670231f,-0.01665884f,-0.01657527f,-0.01645231f,-0.01629074f,-0.01609144f,-0.01585536f,-0.01558354f,-0.01527708f,-0.01493718f,-0.01456507f,-0.01416208f,-0.01372957f,-0.01326897f,-0.01278179f,-0.01226952f,-0.01173374f,-0.01117606f,-0.01059814f,-0.01000163f,-0.009388241f,-0.008759692f,-0.008117708f,-0.007464039f,-0.006800437f,-0.006128659f,-0.005450456f,-0.004767576f,-0.004081781f,-0.003394742f,-0.002708186f,-0.002023795f,-0.001343222f,-0.0006680909f,0.000000009461361f,0.000659527f,0.001308951f,0.001946815f,0.002571699f,0.003182233f,0.003777103f,0.004355023f,0.004914839f,0.005455384f,0.005975577f,0.006474403f,0.006950912f,0.007404221f,0.007833516f,0.008238055f,0.008617163f,0.008970238f,0.009296755f,0.009596253f,0.009868351f,0.01011273f,0.01032916f,0.01051748f,0.0106776f,0.01080948f,0.01091317f,0.0109888f,0.01103654f,0.01105665f,0.01104945f,0.0110153f,0.01095467f,0.01086804f,0.01075598f,0.01061911f,0.01045808f,0.01027362f,0.0100665f,0.009837538f,0.009587585f,0.009317539f,0.009028343f,0.008720957f,0.008396389f,0.008055673f,0.007699866f,0.007330052f,0.006947332f,0.006552839f,0.00614768f,0.005733014f,0.005309992f,0.004879772f,0.004443516f,0.004002382f,0.003557525f,0.003110097f,0.002661235f,0.002212069f,0.001763712f,0.00131726f,0.0008737892f,0.0004343703f,-0.0000000006289512f,-0.000428304f,-0.0008495659f,-0.001262843f,-0.001667227f,-0.00206184f,-0.002445846f,-0.002818442f,-0.003178869f,-0.003526405f,-0.003860372f,-0.004180136f,-0.004485107f,-0.004774727f,-0.005048521f,-0.005306024f,-0.005546829f,-0.005770578f,-0.005976961f,-0.006165712f,-0.006336619f,-0.006489512f,-0.00662427f,-0.00674082f,-0.006839134f,-0.006919232f,-0.006981174f,-0.007025076f,-0.007051085f,-0.007059397f,-0.007050246f,-0.007023909f,-0.006980701f,-0.006920981f,-0.006845125f,-0.006753564f,-0.006646751f,-0.00652518f,-0.006389364f,-0.006239853f,-0.006077222f,-0.005902058f,-0.005714986f,-0.005516647f,-0.0053077f,-0.005088819f,-0.004860696f,-0.004624037f,-0.004379554f,-0.004127972f,-0.003870023f,-0.003606441f,-0.003337967f,-0.00306534f,-0.002789312f,-0.002510599f,-0.002229944f,-0.001948075f,-0.001665711f,-0.001383562f,-0.001102324f,-0.0008226858f,-0.000545317f,-0.0002708732f,0.000000007400842f,0.0002667052f,0.0005286207f,0.0007851752f,0.001035803f,0.001279991f,0.00151722f,0.001747009f,0.001968898f,0.00218246f,0.00238729f,0.002583014f,0.00276928f,0.002945785f,0.003112236f,0.003268375f,0.003413974f,0.003548836f,0.003672795f,0.003785713f,0.003887483f,0.003978028f,0.004057301f,0.004125282f,0.004181982f,0.004227445f,0.004261726f,0.004284925f,0.004297161f,0.004298581f,0.004289355f,0.004269677f,0.004239766f,0.004199863f,0.00415023f,0.00409115f,0.004022922f,0.003945869f,0.003860328f,0.003766655f,0.003665211f,0.003556381f,0.003440559f,0.003318152f,0.003189574f,0.00305525f,0.002915612f,0.0027711f,0.002622156f,0.002469228f,0.002312767f,0.002153223f,0.001991049f,0.001826698f,0.001660617f,0.001493253f,0.001325048f,0.001156439f,0.0009878572f,0.0008197247f,0.0006524568f,0.0004864595f,0.0003221283f,0.000159848f,-0.000000008495203f,-0.0001570806f,-0.000311009f,-0.0004614847f,-0.0006081765f,-0.0007507809f,-0.0008890096f,-0.001022591f,-0.001151269f,-0.001274805f,-0.001392979f,-0.001505586f,-0.001612441f,-0.001713375f,-0.001808239f,-0.001896901f,-0.001979249f,-0.002055184f,-0.002124629f,-0.002187526f,-0.002243834f,-0.002293528f,-0.002336601f,-0.002373065f,-0.002402947f,-0.002426289f,-0.002443152f,-0.002453612f,-0.002457757f,-0.002455694f,-0.002447542f,-0.002433432f,-0.002413512f,-0.002387937f,-0.002356878f,-0.002320515f,-0.002279041f,-0.002232652f,-0.002181562f,-0.002125986f,-0.002066151f,-0.002002288f,-0.001934637f,-0.00186344f,-0.001788946f,-0.001711408f,-0.00163108f,-0.001548221f,-0.00146309f,-0.001375948f,-0.001287055f,-0.001196673f,-0.001105061f,-0.001012476f,-0.0009191733f,-0.0008254063f,-0.000731423f,-0.0006374682f,-0.0005437887f,-0.0004506048f,-0.0003581525f,-0.0002666539f,-0.0001763247f,-0.00008737308f,0.0000000001681455f,0.00008560243f,0.0001692493f,0.0002507654f,0.0003299841f,0.0004067482f,0.0004809099f,0.0005523317f,0.0006208846f,0.0006864508f,0.0007489227f,0.0008082025f,0.000864203f,0.0009168478f,0.0009660696f,0.001011812f,0.00105403f,0.001092688f,0.001127759f,0.001159229f,0.001187091f,0.001211347f,0.001232015f,0.001249115f,0.001262678f,0.001272745f,0.001279364f,0.001282592f,0.001282492f,0.001279139f,0.001272609f,0.001262989f,0.001250371f,0.001234854f,0.001216542f,0.001195542f,0.00117197f,0.001145944f,0.001117586f,0.001087022f,0.001054382f,0.001019796f,0.0009834f,0.0009453294f,0.0009057216f,0.0008647162f,0.0008224522f,0.0007790695f,0.000734708f,0.00068951f,0.0006436071f,0.0005971409f,0.0005502461f,0.0005030563f,0.0004557039f,0.0004083179f,0.0003610241f,0.0003139455f,0.0002672023f,0.0002209105f,0.0001751821f,0.0001301251f,0.00008584363f,0.00004243672f,-0.000000001174241f,-0.00004138023f,-0.00008161574f,-0.000120628f,-0.0001583428f,-0.0001946912f,-0.000229609f,-0.0002630385f,-0.0002949268f,-0.0003252268f,-0.0003538965f,-0.0003808999f,-0.0004062061f,-0.0004297877f,-0.0004516298f,-0.0004717149f,-0.0004900336f,-0.0005065824f,-0.0005213621f,-0.0005343776f,-0.0005456405f,-0.0005551654f,-0.0005629724f,-0.0005690854f,-0.0005735317f,-0.0005763453f,-0.0005775606f,-0.0005772174f,-0.0005753593f,-0.0005720325f,-0.0005672846f,-0.0005611693f,-0.0005537404f,-0.0005450541f,-0.0005351692f,-0.0005241471f,-0.0005120501f,-0.0004989423f,-0.0004848873f,-0.0004699531f,-0.0004542055f,-0.0004377111f,-0.0004205382f,-0.0004027549f,-0.000384429f,-0.0003656275f,-0.0003464172f,-0.0003268652f,-0.0003070367f,-0.000286996f,-0.0002668065f,-0.0002465308f,-0.0002262287f,-0.0002059591f,-0.0001857798f,-0.0001657454f,-0.0001459089f,-0.0001263217f,-0.0001070331f,-0.00008808904f,-0.00006953394f,-0.0000514095f,-0.00003375489f,-0.00001660678f,0.0000000008828778f,0.00001603677f,0.00003147225f,0.00004628124f,0.00006043958f,0.00007392884f,0.00008672991f,0.00009882788f,0.00011021f,0.0001208664f,0.0001307898f,0.000139975f,0.0001484199f,0.0001561245f,0.0001630915f,0.0001693251f,0.0001748318f,0.0001796211f,0.0001837037f,0.0001870922f,0.0001898014f,0.0001918475f,0.0001932488f,0.0001940241f,0.0001941947f,0.0001937831f,0.0001928118f,0.0001913049f,0.0001892889f,0.0001867894f,0.0001838327f,0.0001804467f,0.0001766592f,0.0001724985f,0.0001679931f,0.0001631719f,0.0001580636f,0.0001526968f,0.0001471006f,0.0001413024f,0.0001353313f,0.0001292145f,0.0001229788f,0.0001166512f,0.0001102571f,0.0001038223f,0.0000973703f,0.00009092497f,0.00008450833f,0.00007814272f,0.00007184815f,0.00006564461f,0.00005954991f,0.00005358154f,0.00004775569f,0.00004208676f,0.00003658899f,0.00003127437f,0.0000261546f,0.00002123973f,0.00001653798f,0.00001205736f,0.000007804163f,0.000003783703f,-0.000000000008901681f,-0.000003544079f,-0.00000684668f,-0.000009907134f,-0.00001272555f,-0.00001530365f,-0.00001764329f,-0.00001974791f,-0.0000216217f,-0.00002326923f,-0.00002469646f,-0.00002590943f,-0.00002691537f,-0.00002772242f,-0.00002833794f,-0.00002877093f,-0.00002903067f,-0.00002912695f,-0.00002906912f,-0.00002886715f,-0.00002853203f,-0.00002807362f,-0.00002750264f,-0.00002682936f,-0.00002606478f,-0.00002521952f,-0.00002430297f,-0.00002332625f,-0.00002229894f,-0.00002123156f,-0.00002013221f,-0.00001901063f,-0.00001787523f,-0.00001673514f,-0.00001559686f,-0.00001446904f,-0.00001335829f,-0.00001227042f,-0.00001121161f,-0.00001018676f,-0.000009201491f,-0.000008259004f,-0.00000736348f,-0.000006517685f,-0.000005724337f,-0.000004984693f,-0.000004300695f,-0.000003672964f,-0.000003101586f,-0.000002586037f,-0.000002125701f,-0.000001719344f,-0.000001364625f,-0.000001060089f,-0.0000008023567f,-0.0000005888515f,-0.0000004159667f,-0.0000002801043f,-0.0000001770186f,-0.0000001028222f,-0.00000005271932f,-0.00000002231452f,-0.000000006608794f,-0.0000000008153554f,-0.0000000000000004146626f};
-const float blamp[] = {-0.00000000000000000000158f,-0.000000000000003110314f,-0.00000000000003765157f,-0.0000000000002108462f,-0.0000000000007806025f,-0.000000000002229926f,-0.000000000005340088f,-0.00000000001126152f,-0.000000000021582f,-0.00000000003839055f,-0.00000000006433866f,-0.0000000001026978f,-0.0000000001574114f,-0.0000000002331401f,-0.0000000003353009f,-0.0000000004701026f,-0.0000000006445743f,-0.0000000008665851f,-0.000000001144857f,-0.00000000148897f,-0.000000001909357f,-0.000000002417294f,-0.000000003024884f,-0.00000000374502f,-0.000000004591358f,-0.000000005578261f,-0.000000006720754f,-0.00000000803445f,-0.000000009535487f,-0.00000001124044f,-0.00000001316624f,-0.00000001533007f,-0.00000001774926f,-0.00000002044119f,-0.00000002342315f,-0.00000002671221f,-0.00000003032512f,-0.00000003427812f,-0.00000003858687f,-0.00000004326622f,-0.00000004833011f,-0.00000005379141f,-0.00000005966174f,-0.00000006595133f,-0.00000007266886f,-0.00000007982128f,-0.00000008741367f,-0.00000009544908f,-0.0000001039283f,-0.0000001128499f,-0.0000001222099f,-0.0000001320015f,-0.0000001422155f,-0.0000001528393f,-0.0000001638577f,-0.0000001752522f,-0.0000001870009f,-0.0000001990786f,-0.0000002114567f,-0.0000002241032f,-0.0000002369823f,-0.0000002500546f,-0.0000002632772f,-0.0000002766033f,-0.0000002899826f,-0.000000303361f,-0.0000003166807f,-0.0000003298805f,-0.0000003428954f,-0.0000003556571f,-0.000000368094f,-0.000000380131f,-0.00000039169f,-0.00000040269f,-0.0000004130472f,-0.000000422675f,-0.0000004314848f,-0.0000004393854f,-0.000000446284f,-0.0000004520859f,-0.0000004566952f,-0.0000004600148f,-0.0000004619469f,-0.0000004623933f,-0.0000004612555f,-0.0000004584355f,-0.0000004538358f,-0.00000044736f,-0.0000004389129f,-0.0000004284014f,-0.0000004157345f,-0.0000004008238f,-0.0000003835841f,-0.0000003639334f,-0.000000341794f,-0.0000003170926f,-0.0000002897603f,-0.0000002597339f,-0.0000002269556f,-0.0000001913739f,-0.0000001529438f,-0.0000001116273f,-0.00000006739359f,-0.00000002021991f,0.00000002990852f,0.00000008299788f,0.0000001390455f,0.0000001980394f,0.0000002599583f,0.0000003247707f,0.0000003924353f,0.0000004629003f,0.0000005361034f,0.0000006119715f,0.0000006904204f,0.0000007713552f,0.0000008546694f,0.0000009402455f,0.000001027954f,0.000001117656f,0.0000012092f,0.000001302422f,0.00000139715f,0.000001493198f,0.000001590372f,0.000001688465f,0.000001787262f,0.000001886537f,0.000001986054f,0.000002085569f,0.000002184829f,0.000002283571f,0.000002381528f,0.000002478421f,0.00000257397f,0.000002667883f,0.000002759868f,0.000002849626f,0.000002936854f,0.000003021247f,0.000003102497f,0.000003180294f,0.00000325433f,0.000003324295f,0.000003389882f,0.000003450784f,0.0000035067f,0.000003557331f,0.000003602385f,0.000003641574f,0.000003674621f,0.000003701253f,0.000003721208f,0.000003734236f,0.000003740096f,0.000003738561f,0.000003729416f,0.000003712461f,0.000003687513f,0.000003654404f,0.000003612982f,0.000003563116f,0.000003504691f,0.000003437616f,0.000003361818f,0.000003277247f,0.000003183874f,0.000003081693f,0.000002970725f,0.000002851011f,0.000002722621f,0.000002585647f,0.000002440208f,0.00000228645f,0.000002124545f,0.000001954691f,0.000001777114f,0.000001592067f,0.000001399828f,0.000001200706f,0.0000009950314f,0.0000007831657f,0.0000005654944f,0.0000003424294f,0.0000001144082f,-0.0000001181072f,-0.0000003546303f,-0.0000005946512f,-0.0000008376375f,-0.000001083035f,-0.000001330267f,-0.000001578741f,-0.000001827841f,-0.000002076938f,-0.000002325383f,-0.000002572515f,-0.000002817659f,-0.000003060127f,-0.000003299222f,-0.000003534238f,-0.000003764462f,-0.000003989177f,-0.000004207661f,-0.000004419192f,-0.000004623048f,-0.000004818508f,-0.000005004859f,-0.000005181391f,-0.000005347405f,-0.000005502211f,-0.000005645134f,-0.000005775511f,-0.000005892699f,-0.000005996072f,-0.000006085026f,-0.000006158982f,-0.000006217383f,-0.000006259704f,-0.000006285445f,-0.000006294143f,-0.000006285363f,-0.000006258711f,-0.000006213826f,-0.000006150388f,-0.000006068119f,-0.000005966781f,-0.000005846184f,-0.00000570618f,-0.00000554667f,-0.000005367604f,-0.000005168979f,-0.000004950847f,-0.000004713307f,-0.000004456514f,-0.000004180674f,-0.000003886049f,-0.000003572954f,-0.000003241759f,-0.000002892891f,-0.000002526827f,-0.000002144104f,-0.000001745312f,-0.000001331094f,-0.0000009021492f,-0.0000004592271f,-0.000000003131211f,0.0000004652842f,0.0000009451151f,0.000001435408f,0.000001935164f,0.000002443337f,0.000002958837f,0.000003480534f,0.000004007257f,0.000004537797f,0.000005070911f,0.000005605325f,0.000006139731f,0.000006672798f,0.00000720317f,0.000007729468f,0.000008250298f,0.000008764249f,0.000009269901f,0.000009765825f,0.00001025059f,0.00001072276f,0.0000111809f,0.0000116236f,0.00001204945f,0.00001245703f,0.00001284499f,0.00001321195f,0.0000135566f,0.00001387763f,0.00001417379f,0.00001444384f,0.0000146866f,0.00001490095f,0.00001508579f,0.00001524009f,0.00001536288f,0.00001545324f,0.00001551034f,0.00001553338f,0.00001552167f,0.00001547457f,0.00001539153f,0.00001527207f,0.00001511581f,0.00001492244f,0.00001469175f,0.0000144236f,0.00001411798f,0.00001377495f,0.00001339466f,0.00001297737f,0.00001252344f,0.00001203333f,0.00001150759f,0.00001094688f,0.00001035195f,0.000009723673f,0.000009063001f,0.000008370994f,0.000007648811f,0.000006897708f,0.000006119037f,0.000005314245f,0.000004484873f,0.000003632549f,0.000002758991f,0.000001866002f,0.0000009554656f,0.0000000293446f,-0.0000009103238f,-0.000001861431f,-0.000002821803f,-0.000003789203f,-0.000004761334f,-0.000005735851f,-0.000006710357f,-0.000007682414f,-0.000008649548f,-0.000009609254f,-0.000010559f,-0.00001149623f,-0.00001241839f,-0.00001332291f,-0.0000142072f,-0.00001506871f,-0.0000159049f,-0.00001671321f,-0.00001749115f,-0.00001823625f,-0.00001894606f,-0.00001961822f,-0.00002025038f,-0.00002084027f,-0.00002138569f,-0.00002188452f,-0.00002233469f,-0.00002273427f,-0.00002308136f,-0.00002337422f,-0.00002361118f,-0.0000237907f,-0.00002391134f,-0.00002397181f,-0.00002397093f,-0.00002390765f,-0.00002378109f,-0.00002359048f,-0.00002333521f,-0.00002301483f,-0.00002262904f,-0.0000221777f,-0.00002166084f,-0.00002107863f,-0.00002043144f,-0.00001971979f,-0.00001894436f,-0.00001810604f,-0.00001720585f,-0.000016245f,-0.00001522487f,-0.00001414703f,-0.00001301318f,-0.00001182523f,-0.00001058522f,-0.000009295385f,-0.0000079581f,-0.000006575903f,-0.000005151487f,-0.000003687695f,-0.000002187511f,-0.000000654058f,0.0000009094055f,0.000002499496f,0.000004112709f,0.000005745426f,0.000007393924f,0.000009054379f,0.00001072288f,0.00001239543f,0.00001406797f,0.00001573636f,0.00001739642f,0.00001904392f,0.00002067458f,0.00002228414f,0.00002386828f,0.00002542269f,0.00002694309f,0.00002842518f,0.00002986472f,0.0000312575f,0.00003259937f,0.00003388622f,0.00003511405f,0.00003627891f,0.00003737697f,0.00003840451f,0.0000393579f,0.00004023369f,0.00004102853f,0.00004173923f,0.00004236277f,0.0000428963f,0.00004333714f,0.00004368282f,0.00004393107f,0.0000440798f,0.00004412717f,0.00004407154f,0.00004391153f,0.00004364597f,0.00004327397f,0.00004279485f,0.00004220822f,0.00004151393f,0.00004071213f,0.0000398032f,0.00003878781f,0.00003766692f,0.00003644174f,0.00003511378f,0.0000336848f,0.00003215687f,0.00003053233f,0.00002881377f,0.00002700408f,0.0000251064f,0.00002312415f,0.000021061f,0.00001892088f,0.00001670797f,0.00001442668f,0.00001208166f,0.000009677785f,0.000007220158f,0.000004714075f,0.000002165033f,-0.0000004212855f,-0.000003039025f,-0.000005682166f,-0.000008344544f,-0.00001101985f,-0.00001370167f,-0.00001638347f,-0.00001905861f,-0.00002172041f,-0.0000243621f,-0.00002697687f,-0.00002955789f,-0.00003209829f,-0.00003459125f,-0.00003702993f,-0.00003940756f,-0.00004171741f,-0.00004395281f,-0.00004610723f,-0.00004817419f,-0.00005014739f,-0.00005202064f,-0.00005378793f,-0.00005544342f,-0.00005698147f,-0.00005839666f,-0.0000596838f,-0.00006083793f,-0.00006185437f,-0.00006272872f,-0.00006345684f,-0.00006403493f,-0.00006445951f,-0.00006472741f,-0.00006483583f,-0.0000647823f,-0.00006456475f,-0.00006418147f,-0.00006363112f,-0.0000629128f,-0.00006202599f,-0.00006097057f,-0.00005974685f,-0.00005835556f,-0.00005679786f,-0.00005507532f,-0.00005318998f,-0.00005114425f,-0.00004894102f,-0.0000465836f,-0.0000440757f,-0.00004142147f,-0.0000386255f,-0.00003569276f,-0.00003262862f,-0.00002943888f,-0.00002612971f,-0.00002270765f,-0.00001917962f,-0.00001555288f,-0.00001183505f,-0.000008034044f,-0.000004158124f,-0.0000002158205f,0.000003784052f,0.000007832421f,0.00001191998f,0.00001603719f,0.00002017433f,0.00002432149f,0.00002846862f,0.00003260554f,0.00003672193f,0.00004080743f,0.0000448516f,0.00004884397f,0.00005277406f,0.00005663141f,0.00006040561f,0.00006408633f,0.00006766331f,0.00007112644f,0.00007446574f,0.00007767144f,0.00008073394f,0.00008364389f,0.0000863922f,0.00008897006f,0.00009136897f,0.00009358074f,0.00009559758f,0.00009741205f,0.00009901713f,0.0001004062f,0.0001015732f,0.0001025124f,0.0001032186f,0.0001036871f,0.0001039139f,0.0001038952f,0.0001036282f,0.0001031102f,0.0001023395f,0.0001013147f,0.0001000352f,0.00009850099f,0.00009671263f,0.00009467133f,0.00009237898f,0.00008983805f,0.00008705173f,0.00008402379f,0.00008075868f,0.00007726149f,0.00007353791f,0.00006959431f,0.00006543764f,0.0000610755f,0.00005651606f,0.00005176808f,0.00004684091f,0.00004174445f,0.00003648914f,0.00003108594f,0.0000255463f,0.00001988217f,0.00001410593f,0.000008230396f,0.000002268797f,-0.000003765277f,-0.000009857887f,-0.00001599478f,-0.00002216142f,-0.00002834301f,-0.00003452456f,-0.00004069088f,-0.00004682664f,-0.00005291638f,-0.0000589446f,-0.00006489573f,-0.00007075422f,-0.00007650456f,-0.00008213132f,-0.00008761918f,-0.00009295299f,-0.00009811776f,-0.0001030988f,-0.0001078816f,-0.0001124521f,-0.0001167965f,-0.0001209014f,-0.0001247538f,-0.0001283412f,-0.0001316517f,-0.0001346738f,-0.0001373967f,-0.0001398099f,-0.000141904f,-0.0001436699f,-0.0001450994f,-0.000146185f,-0.0001469198f,-0.000147298f,-0.0001473143f,-0.0001469643f,-0.0001462447f,-0.0001451526f,-0.0001436865f,-0.0001418454f,-0.0001396294f,-0.0001370395f,-0.0001340776f,-0.0001307466f,-0.0001270503f,-0.0001229934f,-0.0001185817f,-0.0001138217f,-0.000108721f,-0.0001032882f,-0.00009753257f,-0.00009146451f,-0.00008509523f,-0.00007843678f,-0.00007150211f,-0.00006430499f,-0.00005685997f,-0.00004918243f,-0.00004128846f,-0.00003319489f,-0.00002491923f,-0.00001647966f,-0.000007894953f,0.000000815531f,0.000009631897f,0.00001853376f,0.00002750028f,0.00003651022f,0.000045542f,0.00005457371f,0.00006358321f,0.00007254814f,0.000081446f,0.00009025419f,0.00009895006f,0.000107511f,0.0001159144f,0.0001241379f,0.0001321592f,0.0001399563f,0.0001475075f,0.0001547914f,0.0001617871f,0.000168474f,0.0001748323f,0.0001808424f,0.0001864858f,0.0001917442f,0.0001966004f,0.0002010379f,0.0002050408f,0.0002085944f,0.0002116848f,0.0002142991f,0.0002164254f,0.0002180528f,0.0002191718f,0.0002197735f,0.0002198507f,0.0002193972f,0.0002184079f,0.0002168791f,0.0002148084f,0.0002121947f,0.0002090381f,0.0002053402f,0.0002011039f,0.0001963333f,0.000191034f,0.0001852131f,0.0001788787f,0.0001720406f,0.0001647098f,0.0001568987f,0.0001486208f,0.0001398913f,0.0001307263f,0.0001211434f,0.0001111613f,0.0001008f,0.00009008046f,0.00007902503f,0.00006765696f,0.0000560006f,0.00004408128f,0.00003192524f,0.00001955963f,0.000007012435f,-0.000005687625f,-0.0000185111f,-0.00003142792f,-0.0000444074f,-0.0000574184f,-0.00007042931f,-0.00008340816f,-0.00009632271f,-0.0001091405f,-0.0001218289f,-0.0001343552f,-0.0001466869f,-0.0001587914f,-0.0001706363f,-0.0001821896f,-0.0001934195f,-0.0002042947f,-0.0002147843f,-0.0002248583f,-0.000234487f,-0.0002436416f,-0.0002522943f,-0.0002604178f,-0.0002679863f,-0.0002749746f,-0.0002813589f,-0.0002871166f,-0.0002922262f,-0.0002966678f,-0.0003004226f,-0.0003034736f,-0.000305805f,-0.0003074028f,-0.0003082546f,-0.0003083497f,-0.0003076791f,-0.0003062355f,-0.0003040136f,-0.0003010097f,-0.0002972222f,-0.0002926512f,-0.000287299f,-0.0002811696f,-0.000274269f,-0.0002666053f,-0.0002581883f,-0.00024903f,-0.0002391444f,-0.0002285471f,-0.0002172561f,-0.0002052909f,-0.000192673f,-0.000179426f,-0.0001655751f,-0.0001511472f,-0.000136171f,-0.0001206771f,-0.0001046975f,-0.00008826565f,-0.00007141684f,-0.0000541876f,-0.00003661585f,-0.00001874081f,-0.0000006029191f,0.00001775628f,0.00003629419f,0.00005496729f,0.00007373116f,0.00009254071f,0.0001113501f,0.000130113f,0.0001487827f,0.000167312f,0.0001856537f,0.0002037601f,0.0002215841f,0.0002390781f,0.0002561952f,0.0002728887f,0.0002891122f,0.0003048202f,0.0003199677f,0.0003345105f,0.0003484056f,0.0003616108f,0.0003740852f,0.0003857891f,0.0003966844f,0.0004067343f,0.0004159037f,0.0004241593f,0.0004314695f,0.0004378047f,0.0004431373f,0.0004474419f,0.0004506952f,0.0004528763f,0.0004539665f,0.0004539496f,0.0004528121f,0.0004505429f,0.0004471334f,0.0004425781f,0.0004368738f,0.0004300203f,0.0004220203f,0.0004128791f,0.000402605f,0.0003912093f,0.0003787059f,0.0003651119f,0.0003504471f,0.0003347343f,0.0003179989f,0.0003002696f,0.0002815774f,0.0002619564f,0.0002414434f,0.0002200776f,0.000197901f,0.0001749583f,0.0001512962f,0.0001269643f,0.0001020142f,0.0000764996f,0.00005047654f,0.00002400292f,-0.000002861472f,-0.00003005509f,-0.00005751475f,-0.00008517579f,-0.0001129722f,-0.0001408367f,-0.0001687009f,-0.0001964957f,-0.000224151f,-0.0002515961f,-0.0002787601f,-0.0003055715f,-0.0003319588f,-0.0003578507f,-0.000383176f,-0.0004078638f,-0.0004318441f,-0.0004550472f,-0.0004774047f,-0.0004988492f,-0.0005193146f,-0.0005387363f,-0.0005570512f,-0.0005741981f,-0.0005901178f,-0.0006047534f,-0.0006180501f,-0.0006299557f,-0.0006404207f,-0.0006493983f,-0.0006568446f,-0.0006627192f,-0.0006669846f,-0.0006696067f,-0.000670555f,-0.0006698028f,-0.000667327f,-0.0006631084f,-0.0006571318f,-0.0006493861f,-0.0006398643f,-0.0006285638f,-0.0006154862f,-0.0006006375f,-0.0005840281f,-0.0005656731f,-0.0005455917f,-0.0005238081f,-0.0005003508f,-0.0004752528f,-0.0004485519f,-0.0004202901f,-0.0003905143f,-0.0003592754f,-0.0003266292f,-0.0002926355f,-0.0002573586f,-0.0002208668f,-0.0001832328f,-0.0001445329f,-0.0001048478f,-0.00006426145f,-0.00002286186f,0.00001925972f,0.00006200864f,0.0001052871f,0.0001489943f,0.0001930266f,0.0002372778f,0.0002816393f,0.0003260003f,0.0003702481f,0.0004142681f,0.0004579443f,0.0005011595f,0.0005437954f,0.000585733f,0.0006268527f,0.0006670349f,0.00070616f,0.0007441086f,0.000780762f,0.0008160025f,0.0008497136f,0.0008817801f,0.0009120889f,0.0009405288f,0.0009669909f,0.0009913694f,0.001013561f,0.001033466f,0.001050988f,0.001066035f,0.001078518f,0.001088355f,0.001095465f,0.001099776f,0.001101218f,0.001099728f,0.00109525f,0.001087731f,0.001077128f,0.001063402f,0.001046522f,0.001026463f,0.001003209f,0.0009767489f,0.0009470819f,0.0009142137f,0.0008781583f,0.0008389378f,0.0007965825f,0.0007511316f,0.0007026325f,0.0006511415f,0.0005967236f,0.0005394528f,0.000479412f,0.000416693f,0.0003513969f,0.0002836335f,0.0002135221f,0.0001411908f,0.00006677673f,-0.000009573766f,-0.00008770554f,-0.0001674545f,-0.0002486478f,-0.0003311039f,-0.0004146325f,-0.0004990351f,-0.0005841046f,-0.0006696261f,-0.0007553766f,-0.0008411251f,-0.0009266334f,-0.001011656f,-0.001095939f,-0.001179224f,-0.001261245f,-0.001341728f,-0.001420396f,-0.001496964f,-0.001571142f,-0.001642635f,-0.001711145f,-0.001776367f,-0.001837994f,-0.001895714f,-0.001949212f,-0.001998171f,-0.00204227f,-0.002081188f,-0.002114601f,-0.002142183f,-0.002163609f,-0.002178551f,-0.002186684f,-0.002187683f,-0.00218122f,-0.002166974f,-0.002144622f,-0.002113844f,-0.002074323f,-0.002025745f,-0.0019678f,-0.001900179f,-0.001822582f,-0.00173471f,-0.001636271f,-0.001526978f,-0.00140655f,-0.001274713f,-0.001131198f,-0.0009757464f,-0.0008081039f,-0.0006280258f,-0.0004352751f,-0.0002296236f,-0.00001085194f,0.00022125f,0.0004668827f,0.0007262369f,0.0009994933f,0.001286822f,0.001588383f,0.001904324f,0.002234784f,0.002579888f,0.002939752f,0.003314479f,0.00370416f,0.004108875f,0.004528692f,0.004963665f,0.005413838f,0.005879242f,0.006359896f,0.005879242f,0.005413839f,0.004963665f,0.004528692f,0.004108875f,0.00370416f,0.003314479f,0.002939752f,0.002579888f,0.002234785f,0.001904326f,0.001588384f,0.001286823f,0.0009994945f,0.0007262379f,0.0004668832f,0.0002212506f,-0.00001084991f,-0.0002296232f,-0.0004352741f,-0.0006280243f,-0.000808103f,-0.0009757448f,-0.001131197f,-0.001274711f,-0.001406547f,-0.001526974f,-0.001636267f,-0.001734708f,-0.001822578f,-0.001900176f,-0.001967797f,-0.002025742f,-0.00207432f,-0.002113841f,-0.00214462f,-0.002166972f,-0.002181217f,-0.00218768f,-0.002186682f,-0.00217855f,-0.002163604f,-0.00214218f,-0.002114598f,-0.002081186f,-0.002042267f,-0.001998167f,-0.00194921f,-0.001895711f,-0.001837987f,-0.00177636f,-0.001711138f,-0.00164263f,-0.001571134f,-0.001496956f,-0.00142039f,-0.001341723f,-0.001261238f,-0.001179218f,-0.001095932f,-0.001011651f,-0.0009266287f,-0.0008411184f,-0.0007553697f,-0.0006696209f,-0.0005840957f,-0.0004990324f,-0.0004146248f,-0.0003310964f,-0.0002486408f,-0.0001674518f,-0.00008770078f,-0.000009566545f,0.00006677955f,0.000141196f,0.0002135262f,0.0002836362f,0.0003513992f,0.0004166961f,0.0004794151f,0.0005394593f,0.0005967319f,0.0006511435f,0.0007026345f,0.0007511377f,0.0007965863f,0.0008389428f,0.0008781627f,0.000914216f,0.000947088f,0.0009767562f,0.001003213f,0.001026466f,0.001046523f,0.001063414f,0.001077138f,0.00108774f,0.001095265f,0.001099743f,0.001101233f,0.001099788f,0.001095474f,0.001088366f,0.001078531f,0.001066044f,0.001051001f,0.001033477f,0.00101357f,0.0009913817f,0.0009670034f,0.0009405389f,0.0009121001f,0.0008817911f,0.0008497238f,0.0008160174f,0.0007807761f,0.0007441193f,0.0007061735f,0.000667043f,0.000626862f,0.0005857423f,0.0005438104f,0.0005011708f,0.0004579574f,0.0004142821f,0.0003702566f,0.0003260151f,0.0002816468f,0.0002372861f,0.0001930445f,0.0001490116f,0.0001052916f,0.00006201863f,0.0000192672f,-0.00002284348f,-0.00006425381f,-0.0001048297f,-0.0001445264f,-0.0001832247f,-0.0002208501f,-0.0002573431f,-0.000292629f,-0.0003266186f,-0.000359267f,-0.0003904998f,-0.0004202724f,-0.0004485399f,-0.0004752427f,-0.0005003363f,-0.0005237907f,-0.0005455762f,-0.000565663f,-0.0005840212f,-0.0006006211f,-0.0006154776f,-0.0006285608f,-0.0006398559f,-0.0006493777f,-0.0006571263f,-0.0006631017f,-0.0006673187f,-0.0006697923f,-0.0006705523f,-0.0006695986f,-0.000666976f,-0.0006627142f,-0.0006568283f,-0.0006493926f,-0.0006404072f,-0.0006299466f,-0.0006180406f,-0.0006047487f,-0.0005901009f,-0.0005741864f,-0.0005570352f,-0.0005387217f,-0.0005193055f,-0.0004988462f,-0.0004773885f,-0.0004550368f,-0.0004318357f,-0.0004078597f,-0.0003831685f,-0.0003578365f,-0.0003319532f,-0.0003055632f,-0.000278756f,-0.0002515912f,-0.0002241433f,-0.0001964867f,-0.000168696f,-0.0001408309f,-0.0001129508f,-0.00008514524f,-0.00005748868f,-0.00003002584f,-0.000002831221f,0.00002402067f,0.00005050004f,0.00007651746f,0.0001020432f,0.0001269877f,0.0001513213f,0.0001749843f,0.0001979321f,0.0002201051f,0.0002414733f,0.0002619773f,0.0002816021f,0.0003002882f,0.0003180206f,0.0003347546f,0.0003504753f,0.0003651381f,0.0003787279f,0.00039123f,0.0004026294f,0.0004128963f,0.0004220456f,0.0004300475f,0.000436902f,0.0004425943f,0.000447154f,0.0004505664f,0.0004528314f,0.0004539788f,0.0004539937f,0.0004529059f,0.0004507154f,0.000447467f,0.0004431605f,0.0004378259f,0.0004314929f,0.0004241765f,0.0004159212f,0.000406757f,0.0003967136f,0.000385806f,0.0003741086f,0.0003616363f,0.0003484339f,0.0003345311f,0.0003199875f,0.000304848f,0.0002891272f,0.0002729148f,0.0002562106f,0.000239104f,0.0002216101f,0.0002037883f,0.0001856685f,0.00016734f,0.000148803f,0.0001301318f,0.0001113713f,0.00009256601f,0.00007376075f,0.00005498528f,0.00003632903f,0.00001779199f,-0.0000005662441f,-0.00001871586f,-0.00003659725f,-0.00005415082f,-0.00007140636f,-0.00008824468f,-0.0001046658f,-0.0001206696f,-0.000136137f,-0.0001511276f,-0.0001655519f,-0.00017941f,-0.0001926422f,-0.0002052784f,-0.0002172291f,-0.0002285242f,-0.0002391338f,-0.0002489984f,-0.0002581775f,-0.0002665818f,-0.000274241f,-0.0002811551f,-0.0002872646f,-0.000292629f,-0.0002971888f,-0.0003009737f,-0.0003039837f,-0.0003062189f,-0.0003076494f,-0.0003083348f,-0.0003082454f,-0.0003073812f,-0.0003057718f,-0.0003034472f,-0.0003004074f,-0.0002966523f,-0.0002922118f,-0.0002870858f,-0.0002813339f,-0.0002749562f,-0.0002679527f,-0.0002603829f,-0.0002522767f,-0.000243634f,-0.0002344549f,-0.0002248287f,-0.0002147555f,-0.0002042651f,-0.0001933873f,-0.0001821816f,-0.0001706183f,-0.000158757f,-0.0001466572f,-0.0001343489f,-0.0001218021f,-0.0001091063f,-0.0000962913f,-0.0000833869f,-0.00007042289f,-0.00005739927f,-0.00004437566f,-0.00003141165f,-0.00001847744f,-0.000005662441f,0.000007033348f,0.00001958013f,0.00003194809f,0.00004410744f,0.00005602837f,0.00006768107f,0.00007903576f,0.00009009242f,0.0001008213f,0.0001111925f,0.0001211762f,0.0001307428f,0.0001399219f,0.000148654f,0.0001569092f,0.0001647174f,0.0001720488f,0.0001789033f,0.0001852214f,0.0001910627f,0.0001963377f,0.0002011359f,0.0002053678f,0.0002090633f,0.0002122223f,0.0002148151f,0.0002169013f,0.0002184212f,0.0002194047f,0.0002198815f,0.0002197921f,0.0002191961f,0.0002180636f,0.0002164543f,0.0002143085f,0.0002117157f,0.0002086163f,0.0002050698f,0.0002010465f,0.0001966059f,0.0001917481f,0.0001865029f,0.0001808703f,0.0001748502f,0.0001685023f,0.0001617968f,0.0001548231f,0.0001475215f,0.0001399815f,0.0001321733f,0.0001241565f,0.000115931f,0.0001075268f,0.00009897351f,0.00009027123f,0.00008144975f,0.00007256866f,0.00006359816f,0.00005459785f,0.00004559755f,0.00003656745f,0.00002753735f,0.00001856685f,0.000009685755f,0.0000008642673f,-0.000007838011f,-0.00001642108f,-0.00002488494f,-0.00003314018f,-0.00004124641f,-0.00004914403f,-0.00005680323f,-0.00006425381f,-0.00007146597f,-0.00007838011f,-0.00008505583f,-0.00009140372f,-0.0000974834f,-0.0001032352f,-0.0001086891f,-0.0001137853f,-0.0001185238f,-0.0001229346f,-0.0001270175f,-0.000130713f,-0.000134021f,-0.0001370013f,-0.0001395941f,-0.0001417994f,-0.0001436472f,-0.0001451075f,-0.0001462102f,-0.0001469254f,-0.0001472831f,-0.0001472533f,-0.0001468658f,-0.0001461506f,-0.0001450479f,-0.0001436174f,-0.0001418591f,-0.0001397729f,-0.0001373589f,-0.0001346171f,-0.0001316071f,-0.000128299f,-0.0001247227f,-0.0001208484f,-0.0001167655f,-0.0001124144f,-0.0001078248f,-0.0001030564f,-0.00009807944f,-0.00009289384f,-0.00008755922f,-0.0000820756f,-0.00007647276f,-0.00007072091f,-0.00006484985f,-0.00005888939f,-0.00005286932f,-0.00004678965f,-0.00004065037f,-0.00003448129f,-0.00002831221f,-0.00002211332f,-0.00001594424f,-0.000009804964f,-0.00000372529f,0.000002324581f,0.000008285046f,0.0000141561f,0.00001993775f,0.00002560019f,0.00003114343f,0.00003653765f,0.00004178286f,0.00004687905f,0.00005182624f,0.00005656481f,0.00006112456f,0.0000654757f,0.00006964803f,0.00007358193f,0.00007730722f,0.0000807941f,0.00008407235f,0.00008708239f,0.0000898838f,0.000092417f,0.00009471178f,0.00009676814f,0.00009855628f,0.0001000762f,0.0001013577f,0.000102371f,0.0001031458f,0.0001036823f,0.0001039505f,0.0001039505f,0.0001037419f,0.000103265f,0.0001025498f,0.0001016259f,0.0001004636f,0.00009906292f,0.00009745359f,0.00009563565f,0.0000936389f,0.00009140372f,0.00008901954f,0.00008642673f,0.00008368492f,0.00008076429f,0.00007772446f,0.00007450581f,0.00007116795f,0.00006771088f,0.0000641346f,0.00006043911f,0.00005668402f,0.00005280972f,0.00004887581f,0.0000448823f,0.00004085898f,0.00003677607f,0.00003266335f,0.00002852082f,0.0000243783f,0.00002020597f,0.00001609325f,0.00001198053f,0.000007867813f,0.000003814697f,-0.0000001788139f,-0.00000411272f,-0.000007987022f,-0.00001180172f,-0.00001549721f,-0.00001913309f,-0.00002264977f,-0.00002610683f,-0.00002938509f,-0.00003260374f,-0.00003564358f,-0.00003856421f,-0.00004136562f,-0.00004404783f,-0.00004655123f,-0.00004887581f,-0.00005108118f,-0.00005316734f,-0.00005501509f,-0.00005674362f,-0.00005829334f,-0.00005972385f,-0.00006091595f,-0.00006198883f,-0.0000628829f,-0.00006359816f,-0.0000641346f,-0.00006455183f,-0.00006473064f,-0.00006479025f,-0.00006467104f,-0.00006443262f,-0.00006401539f,-0.00006341934f,-0.00006270409f,-0.00006181002f,-0.00006079674f,-0.00005966425f,-0.00005835295f,-0.00005692244f,-0.00005537271f,-0.00005376339f,-0.00005197525f,-0.00005012751f,-0.00004816055f,-0.00004607439f,-0.00004392862f,-0.00004166365f,-0.00003933907f,-0.00003701448f,-0.00003457069f,-0.0000320673f,-0.0000295043f,-0.0000269413f,-0.0000243187f,-0.00002169609f,-0.00001901388f,-0.00001633167f,-0.00001364946f,-0.00001096725f,-0.000008285046f,-0.000005662441f,-0.000002980232f,-0.0000003576279f,0.000002205372f,0.000004768372f,0.000007271767f,0.000009715557f,0.00001209974f,0.00001448393f,0.00001674891f,0.00001895428f,0.00002110004f,0.00002318621f,0.00002515316f,0.00002706051f,0.00002884865f,0.00003057718f,0.00003218651f,0.00003373623f,0.00003516674f,0.00003647804f,0.00003772974f,0.00003880262f,0.0000398159f,0.00004076958f,0.00004154444f,0.00004225969f,0.00004285574f,0.00004333258f,0.0000436902f,0.00004392862f,0.00004410744f,0.00004416704f,0.00004410744f,0.00004398823f,0.00004374981f,0.00004339218f,0.00004291534f,0.0000423789f,0.00004178286f,0.0000410676f,0.00004029274f,0.00003939867f,0.000038445f,0.00003743172f,0.00003629923f,0.00003516674f,0.00003391504f,0.00003266335f,0.00003129244f,0.00002992153f,0.00002849102f,0.0000270009f,0.00002545118f,0.00002390146f,0.00002235174f,0.00002074242f,0.00001907349f,0.00001746416f,0.00001579523f,0.0000141263f,0.00001245737f,0.00001078844f,0.000009119511f,0.000007450581f,0.000005781651f,0.000004172325f,0.000002563f,0.0000009536743f,-0.0000005960464f,-0.000002145767f,-0.000003635883f,-0.000005125999f,-0.000006556511f,-0.000007927418f,-0.00000923872f,-0.00001055002f,-0.00001180172f,-0.00001299381f,-0.0000141263f,-0.00001519918f,-0.00001621246f,-0.00001716614f,-0.00001806021f,-0.00001889467f,-0.00001966953f,-0.00002038479f,-0.00002104044f,-0.00002163649f,-0.00002211332f,-0.00002259016f,-0.00002294779f,-0.00002330542f,-0.00002354383f,-0.00002372265f,-0.00002384186f,-0.00002396107f,-0.00002396107f,-0.00002390146f,-0.00002378225f,-0.00002354383f,-0.00002336502f,-0.000023067f,-0.00002270937f,-0.00002229214f,-0.0000218749f,-0.00002133846f,-0.00002080202f,-0.00002020597f,-0.00001960993f,-0.00001889467f,-0.00001817942f,-0.00001746416f,-0.0000166893f,-0.00001585484f,-0.00001502037f,-0.00001418591f,-0.00001329184f,-0.00001239777f,-0.00001144409f,-0.00001055002f,-0.000009596348f,-0.000008583069f,-0.000007629395f,-0.00000667572f,-0.000005722046f,-0.000004708767f,-0.000003755093f,-0.000002801418f,-0.000001847744f,-0.0000008940697f,0.00000005960464f,0.000001013279f,0.000001907349f,0.000002801418f,0.000003695488f,0.000004529953f,0.000005364418f,0.000006139278f,0.000006914139f,0.000007688999f,0.000008404255f,0.000009119511f,0.000009775162f,0.00001037121f,0.00001096725f,0.0000115633f,0.00001209974f,0.00001257658f,0.00001299381f,0.00001341105f,0.00001382828f,0.0000141263f,0.00001448393f,0.00001472235f,0.00001496077f,0.00001513958f,0.00001531839f,0.0000154376f,0.00001549721f,0.00001555681f,0.00001555681f,0.00001555681f,0.00001549721f,0.000015378f,0.00001525879f,0.00001513958f,0.00001496077f,0.00001472235f,0.00001448393f,0.00001418591f,0.00001388788f,0.00001358986f,0.00001323223f,0.0000128746f,0.00001251698f,0.00001209974f,0.00001168251f,0.00001120567f,0.00001072884f,0.0000103116f,0.000009775162f,0.000009298325f,0.000008821487f,0.000008285046f,0.000007748604f,0.000007212162f,0.000006735325f,0.000006198883f,0.000005722046f,0.000005185604f,0.000004649162f,0.00000411272f,0.000003576279f,0.000003039837f,0.000002563f,0.000002026558f,0.000001549721f,0.000001013279f,0.0000005364418f,0.0000001192093f,-0.0000003576279f,-0.000000834465f,-0.000001251698f,-0.00000166893f,-0.000002026558f,-0.00000244379f,-0.000002801418f,-0.000003159046f,-0.000003457069f,-0.000003814697f,-0.00000411272f,-0.000004351139f,-0.000004589558f,-0.000004827976f,-0.000005066395f,-0.000005245209f,-0.000005424023f,-0.000005602837f,-0.000005781651f,-0.00000590086f,-0.000005960464f,-0.000006079674f,-0.000006139278f,-0.000006139278f,-0.000006198883f,-0.000006198883f,-0.000006198883f,-0.000006139278f,-0.000006139278f,-0.000006079674f,-0.000006020069f,-0.00000590086f,-0.000005781651f,-0.000005662441f,-0.000005543232f,-0.000005424023f,-0.000005245209f,-0.000005066395f,-0.000004887581f,-0.000004708767f,-0.000004529953f,-0.000004351139f,-0.00000411272f,-0.000003874302f,-0.000003695488f,-0.000003457069f,-0.000003218651f,-0.000002980232f,-0.000002741814f,-0.000002503395f,-0.000002205372f,-0.000001966953f,-0.000001728535f,-0.000001490116f,-0.000001251698f,-0.000001013279f,-0.0000007748604f,-0.0000004768372f,-0.0000002384186f,0.0f,0.0000001788139f,0.0000004172325f,0.0000006556511f,0.0000008940697f,0.000001072884f,0.000001311302f,0.000001490116f,0.00000166893f,0.000001847744f,0.000002026558f,0.000002205372f,0.000002384186f,0.000002503395f,0.000002682209f,0.000002801418f,0.000002920628f,0.000003039837f,0.000003159046f,0.000003278255f,0.000003397465f,0.000003457069f,0.000003516674f,0.000003576279f,0.000003635883f,0.000003695488f,0.000003755093f,0.000003755093f,0.000003814697f,0.000003814697f,0.000003814697f,0.000003814697f,0.000003814697f,0.000003814697f,0.000003814697f,0.000003755093f,0.000003755093f,0.000003695488f,0.000003635883f,0.000003576279f,0.000003516674f,0.000003457069f,0.000003397465f,0.00000333786f,0.000003278255f,0.000003218651f,0.000003099442f,0.000003039837f,0.000002920628f,0.000002861023f,0.000002741814f,0.000002682209f,0.000002563f,0.00000244379f,0.000002384186f,0.000002264977f,0.000002205372f,0.000002086163f,0.000001966953f,0.000001907349f,0.000001788139f,0.00000166893f,0.000001609325f,0.000001490116f,0.000001370907f,0.000001311302f,0.000001192093f,0.000001132488f,0.000001013279f,0.0000009536743f,0.000000834465f,0.0000007748604f,0.0000007152557f,0.0000006556511f,0.0000005364418f,0.0000004768372f,0.0000004172325f,0.0000003576279f,0.0000002980232f,0.0000002384186f,0.0000001788139f,0.0000001192093f,0.00000005960464f,0.0f,0.0f,-0.00000005960464f,-0.0000001192093f,-0.0000001192093f,-0.0000001788139f,-0.0000001788139f,-0.0000002384186f,-0.0000002384186f,-0.0000002980232f,-0.0000002980232f,-0.0000002980232f,-0.0000002980232f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000002980232f,-0.0000002980232f,-0.0000002980232f,-0.0000002980232f,-0.0000002980232f,-0.0000002384186f,-0.0000002384186f,-0.0000002384186f,-0.0000002384186f,-0.0000002384186f,-0.0000001788139f,-0.0000001788139f,-0.0000001788139f,-0.0000001788139f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.00000005960464f,0.0f};
-const float blampd2[] = {-0.00000000000000000000079f,-0.000000000000001555538f,-0.0000000000000188418f,-0.0000000000001055974f,-0.0000000000003913555f,-0.000000000001119447f,-0.000000000002685064f,-0.000000000005673093f,-0.00000000001089572f,-0.00000000001942924f,-0.00000000003265103f,-0.0000000000522765f,-0.00000000008039512f,-0.0000000001195052f,-0.0000000001725481f,-0.0000000002429424f,-0.0000000003346181f,-0.0000000004520484f,-0.000000000600281f,-0.0000000007849686f,-0.000000001012397f,-0.000000001289514f,-0.000000001623957f,-0.000000002024079f,-0.000000002498969f,-0.000000003058479f,-0.000000003713246f,-0.000000004474705f,-0.000000005355116f,-0.000000006367573f,-0.000000007526025f,-0.000000008845286f,-0.00000001034105f,-0.00000001202989f,-0.00000001392929f,-0.00000001605762f,-0.00000001843415f,-0.00000002107906f,-0.00000002401345f,-0.00000002725931f,-0.00000003083953f,-0.00000003477788f,-0.00000003909902f,-0.0000000438285f,-0.0000000489927f,-0.00000005461886f,-0.00000006073503f,-0.00000006737008f,-0.00000007455365f,-0.00000008231616f,-0.00000009068871f,-0.00000009970314f,-0.0000001093919f,-0.0000001197883f,-0.0000001309258f,-0.0000001428389f,-0.0000001555623f,-0.0000001691313f,-0.0000001835816f,-0.0000001989494f,-0.000000215271f,-0.000000232583f,-0.0000002509226f,-0.0000002703266f,-0.0000002908324f,-0.0000003124771f,-0.000000335298f,-0.0000003593323f,-0.0000003846168f,-0.0000004111886f,-0.0000004390838f,-0.0000004683389f,-0.0000004989894f,-0.0000005310706f,-0.000000564617f,-0.0000005996627f,-0.0000006362407f,-0.0000006743836f,-0.0000007141227f,-0.0000007554885f,-0.0000007985106f,-0.000000843217f,-0.0000008896347f,-0.0000009377896f,-0.0000009877057f,-0.000001039406f,-0.000001092911f,-0.00000114824f,-0.000001205412f,-0.000001264442f,-0.000001325343f,-0.000001388127f,-0.000001452805f,-0.000001519382f,-0.000001587865f,-0.000001658256f,-0.000001730554f,-0.000001804758f,-0.000001880861f,-0.000001958857f,-0.000002038734f,-0.000002120478f,-0.000002204073f,-0.000002289499f,-0.000002376731f,-0.000002465745f,-0.00000255651f,-0.000002648993f,-0.000002743157f,-0.000002838962f,-0.000002936363f,-0.000003035315f,-0.000003135764f,-0.000003237656f,-0.000003340931f,-0.000003445527f,-0.000003551377f,-0.000003658408f,-0.000003766547f,-0.000003875713f,-0.000003985823f,-0.000004096789f,-0.000004208519f,-0.000004320917f,-0.000004433883f,-0.00000454731f,-0.000004661091f,-0.000004775111f,-0.000004889252f,-0.000005003392f,-0.000005117404f,-0.000005231158f,-0.000005344516f,-0.000005457341f,-0.000005569488f,-0.000005680808f,-0.000005791149f,-0.000005900354f,-0.000006008262f,-0.000006114708f,-0.000006219523f,-0.000006322532f,-0.000006423561f,-0.000006522427f,-0.000006618945f,-0.000006712926f,-0.00000680418f,-0.000006892508f,-0.000006977713f,-0.000007059592f,-0.00000713794f,-0.000007212545f,-0.000007283198f,-0.000007349682f,-0.000007411781f,-0.000007469273f,-0.000007521936f,-0.000007569546f,-0.000007611874f,-0.000007648692f,-0.000007679768f,-0.000007704869f,-0.000007723761f,-0.000007736209f,-0.000007741975f,-0.000007740822f,-0.000007732511f,-0.000007716804f,-0.000007693461f,-0.000007662242f,-0.000007622908f,-0.00000757522f,-0.00000751894f,-0.00000745383f,-0.000007379653f,-0.000007296173f,-0.000007203158f,-0.000007100373f,-0.00000698759f,-0.000006864581f,-0.000006731119f,-0.000006586983f,-0.000006431953f,-0.000006265812f,-0.000006088349f,-0.000005899353f,-0.000005698621f,-0.000005485952f,-0.000005261152f,-0.000005024028f,-0.000004774396f,-0.000004512077f,-0.000004236896f,-0.000003948686f,-0.000003647285f,-0.000003332539f,-0.0000030043f,-0.000002662429f,-0.000002306791f,-0.000001937264f,-0.000001553728f,-0.000001156078f,-0.0000007442121f,-0.0000003180409f,0.000000122517f,0.0000005775334f,0.00000104707f,0.000001531179f,0.0000020299f,0.000002543266f,0.000003071296f,0.000003613997f,0.000004171369f,0.000004743395f,0.000005330049f,0.000005931294f,0.000006547077f,0.000007177336f,0.000007821993f,0.000008480959f,0.000009154132f,0.000009841395f,0.00001054262f,0.00001125766f,0.00001198636f,0.00001272854f,0.00001348403f,0.00001425261f,0.00001503408f,0.0000158282f,0.00001663473f,0.0000174534f,0.00001828395f,0.00001912608f,0.00001997949f,0.00002084385f,0.00002171883f,0.00002260407f,0.00002349921f,0.00002440386f,0.00002531763f,0.00002624009f,0.00002717083f,0.00002810939f,0.00002905531f,0.00003000812f,0.00003096732f,0.00003193241f,0.00003290286f,0.00003387814f,0.00003485768f,0.00003584094f,0.00003682732f,0.00003781622f,0.00003880704f,0.00003979915f,0.00004079191f,0.00004178466f,0.00004277674f,0.00004376748f,0.00004475617f,0.00004574211f,0.00004672459f,0.00004770287f,0.00004867621f,0.00004964386f,0.00005060505f,0.00005155901f,0.00005250495f,0.00005344208f,0.0000543696f,0.00005528668f,0.00005619252f,0.00005708626f,0.00005796709f,0.00005883415f,0.00005968659f,0.00006052355f,0.00006134418f,0.0000621476f,0.00006293293f,0.00006369931f,0.00006444585f,0.00006517167f,0.00006587588f,0.0000665576f,0.00006721594f,0.00006785001f,0.00006845893f,0.00006904182f,0.00006959778f,0.00007012593f,0.00007062541f,0.00007109533f,0.00007153483f,0.00007194304f,0.0000723191f,0.00007266218f,0.00007297142f,0.00007324597f,0.00007348505f,0.00007368781f,0.00007385344f,0.00007398118f,0.00007407023f,0.00007411983f,0.00007412922f,0.00007409767f,0.00007402445f,0.00007390886f,0.00007375021f,0.00007354782f,0.00007330106f,0.00007300928f,0.00007267187f,0.00007228825f,0.00007185784f,0.00007138011f,0.00007085451f,0.00007028058f,0.00006965782f,0.00006898579f,0.00006826408f,0.00006749229f,0.00006667006f,0.00006579705f,0.00006487297f,0.00006389753f,0.00006287049f,0.00006179164f,0.00006066082f,0.00005947786f,0.00005824266f,0.00005695514f,0.00005561526f,0.00005422302f,0.00005277845f,0.00005128161f,0.00004973262f,0.00004813161f,0.00004647877f,0.00004477432f,0.00004301852f,0.00004121168f,0.00003935414f,0.00003744628f,0.00003548852f,0.00003348133f,0.00003142523f,0.00002932076f,0.00002716852f,0.00002496914f,0.00002272331f,0.00002043174f,0.00001809521f,0.00001571453f,0.00001329055f,0.00001082417f,0.000008316342f,0.000005768043f,0.000003180309f,0.0000005542149f,-0.000002109119f,-0.000004808528f,-0.000007542806f,-0.0000103107f,-0.00001311092f,-0.00001594212f,-0.00001880293f,-0.00002169191f,-0.00002460761f,-0.00002754852f,-0.00003051309f,-0.00003349972f,-0.00003650678f,-0.00003953262f,-0.0000425755f,-0.0000456337f,-0.00004870541f,-0.00005178881f,-0.00005488204f,-0.0000579832f,-0.00006109037f,-0.00006420156f,-0.00006731477f,-0.00007042798f,-0.00007353912f,-0.00007664608f,-0.00007974674f,-0.00008283895f,-0.00008592051f,-0.00008898922f,-0.00009204284f,-0.00009507911f,-0.00009809574f,-0.0001010904f,-0.0001040609f,-0.0001070047f,-0.0001099195f,-0.000112803f,-0.0001156527f,-0.0001184662f,-0.0001212412f,-0.0001239751f,-0.0001266656f,-0.0001293101f,-0.0001319063f,-0.0001344516f,-0.0001369437f,-0.00013938f,-0.000141758f,-0.0001440754f,-0.0001463297f,-0.0001485183f,-0.0001506389f,-0.0001526891f,-0.0001546663f,-0.0001565682f,-0.0001583924f,-0.0001601366f,-0.0001617982f,-0.0001633751f,-0.0001648649f,-0.0001662653f,-0.000167574f,-0.0001687889f,-0.0001699076f,-0.000170928f,-0.000171848f,-0.0001726654f,-0.0001733782f,-0.0001739844f,-0.000174482f,-0.000174869f,-0.0001751435f,-0.0001753038f,-0.0001753479f,-0.0001752742f,-0.0001750809f,-0.0001747664f,-0.0001743292f,-0.0001737676f,-0.0001730803f,-0.0001722659f,-0.0001713229f,-0.0001702503f,-0.0001690467f,-0.000167711f,-0.0001662422f,-0.0001646392f,-0.0001629013f,-0.0001610276f,-0.0001590172f,-0.0001568696f,-0.0001545842f,-0.0001521604f,-0.0001495979f,-0.0001468962f,-0.0001440552f,-0.0001410748f,-0.0001379547f,-0.0001346952f,-0.0001312962f,-0.0001277581f,-0.0001240811f,-0.0001202656f,-0.0001163121f,-0.0001122213f,-0.0001079938f,-0.0001036304f,-0.00009913211f,-0.00009449985f,-0.00008973476f,-0.00008483804f,-0.000079811f,-0.00007465507f,-0.00006937178f,-0.00006396275f,-0.00005842971f,-0.00005277452f,-0.00004699911f,-0.00004110553f,-0.00003509596f,-0.00002897264f,-0.00002273795f,-0.00001639437f,-0.000009944477f,-0.000003390955f,0.000003263405f,0.00001001571f,0.00001686296f,0.00002380205f,0.00003082979f,0.00003794286f,0.00004513787f,0.00005241132f,0.00005975959f,0.000067179f,0.00007466574f,0.00008221593f,0.00008982559f,0.00009749064f,0.0001052069f,0.0001129702f,0.000120776f,0.0001286201f,0.0001364979f,0.0001444048f,0.0001523362f,0.0001602872f,0.0001682531f,0.000176229f,0.0001842099f,0.0001921908f,0.0002001666f,0.0002081321f,0.0002160821f,0.0002240114f,0.0002319145f,0.0002397861f,0.0002476208f,0.0002554131f,0.0002631575f,0.0002708484f,0.0002784802f,0.0002860472f,0.0002935439f,0.0003009645f,0.0003083033f,0.0003155546f,0.0003227127f,0.0003297717f,0.0003367259f,0.0003435696f,0.0003502969f,0.0003569021f,0.0003633794f,0.0003697231f,0.0003759274f,0.0003819866f,0.000387895f,0.000393647f,0.0003992368f,0.0004046589f,0.0004099077f,0.0004149778f,0.0004198634f,0.0004245594f,0.0004290603f,0.0004333608f,0.0004374556f,0.0004413396f,0.0004450077f,0.0004484547f,0.0004516759f,0.0004546662f,0.000457421f,0.0004599356f,0.0004622053f,0.0004642258f,0.0004659925f,0.0004675014f,0.0004687481f,0.0004697288f,0.0004704394f,0.0004708763f,0.0004710357f,0.0004709141f,0.0004705083f,0.0004698149f,0.0004688308f,0.0004675533f,0.0004659794f,0.0004641065f,0.0004619323f,0.0004594543f,0.0004566706f,0.0004535791f,0.0004501781f,0.0004464659f,0.0004424412f,0.0004381028f,0.0004334496f,0.0004284807f,0.0004231955f,0.0004175936f,0.0004116747f,0.0004054387f,0.0003988859f,0.0003920165f,0.0003848311f,0.0003773305f,0.0003695157f,0.0003613879f,0.0003529486f,0.0003441992f,0.0003351419f,0.0003257786f,0.0003161115f,0.0003061434f,0.0002958768f,0.0002853148f,0.0002744607f,0.0002633177f,0.0002518897f,0.0002401804f,0.000228194f,0.0002159349f,0.0002034076f,0.0001906169f,0.0001775678f,0.0001642656f,0.0001507158f,0.0001369241f,0.0001228964f,0.0001086388f,0.00009415769f,0.00007945971f,0.00006455164f,0.0000494405f,0.00003413351f,0.00001863814f,0.000002962022f,-0.00001288697f,-0.00002890078f,-0.00004507113f,-0.00006138958f,-0.00007784744f,-0.00009443589f,-0.0001111459f,-0.0001279682f,-0.0001448934f,-0.000161912f,-0.0001790142f,-0.00019619f,-0.0002134295f,-0.0002307223f,-0.0002480581f,-0.0002654264f,-0.0002828163f,-0.0003002172f,-0.000317618f,-0.0003350078f,-0.0003523752f,-0.000369709f,-0.0003869977f,-0.0004042299f,-0.0004213937f,-0.0004384776f,-0.0004554698f,-0.0004723583f,-0.0004891311f,-0.0005057764f,-0.0005222819f,-0.0005386356f,-0.0005548253f,-0.0005708387f,-0.0005866637f,-0.000602288f,-0.0006176993f,-0.0006328853f,-0.0006478339f,-0.0006625326f,-0.0006769692f,-0.0006911317f,-0.0007050076f,-0.0007185851f,-0.0007318518f,-0.0007447959f,-0.0007574054f,-0.0007696682f,-0.0007815728f,-0.0007931073f,-0.0008042602f,-0.0008150199f,-0.0008253751f,-0.0008353146f,-0.0008448273f,-0.0008539021f,-0.0008625283f,-0.0008706952f,-0.0008783923f,-0.0008856094f,-0.0008923364f,-0.0008985632f,-0.0009042803f,-0.0009094781f,-0.0009141474f,-0.0009182792f,-0.0009218645f,-0.000924895f,-0.0009273623f,-0.0009292583f,-0.0009305754f,-0.0009313059f,-0.0009314429f,-0.0009309793f,-0.0009299086f,-0.0009282245f,-0.000925921f,-0.0009229926f,-0.0009194339f,-0.00091524f,-0.0009104062f,-0.0009049284f,-0.0008988026f,-0.0008920254f,-0.0008845935f,-0.0008765042f,-0.0008677552f,-0.0008583445f,-0.0008482704f,-0.0008375319f,-0.0008261281f,-0.0008140586f,-0.0008013237f,-0.0007879237f,-0.0007738596f,-0.0007591327f,-0.0007437448f,-0.0007276981f,-0.0007109955f,-0.0006936399f,-0.0006756349f,-0.0006569847f,-0.0006376937f,-0.0006177668f,-0.0005972094f,-0.0005760275f,-0.0005542274f,-0.0005318159f,-0.0005088002f,-0.0004851882f,-0.0004609881f,-0.0004362085f,-0.0004108586f,-0.000384948f,-0.0003584869f,-0.0003314858f,-0.0003039557f,-0.0002759081f,-0.000247355f,-0.0002183088f,-0.0001887823f,-0.000158789f,-0.0001283426f,-0.00009745736f,-0.00006614791f,-0.00003442939f,-0.000002317386f,0.00003017213f,0.00006302272f,0.00009621755f,0.0001297394f,0.0001635705f,0.0001976929f,0.000232088f,0.000266737f,0.0003016207f,0.0003367194f,0.0003720131f,0.0004074815f,0.0004431038f,0.0004788591f,0.0005147259f,0.0005506826f,0.000586707f,0.0006227769f,0.0006588697f,0.0006949624f,0.0007310318f,0.0007670546f,0.0008030069f,0.0008388649f,0.0008746043f,0.0009102009f,0.0009456301f,0.000980867f,0.001015887f,0.001050664f,0.001085174f,0.001119391f,0.001153289f,0.001186843f,0.001220027f,0.001252816f,0.001285183f,0.001317103f,0.001348549f,0.001379496f,0.001409917f,0.001439787f,0.00146908f,0.001497769f,0.00152583f,0.001553236f,0.001579962f,0.001605981f,0.001631269f,0.001655801f,0.001679551f,0.001702495f,0.001724607f,0.001745863f,0.001766239f,0.001785711f,0.001804255f,0.001821848f,0.001838466f,0.001854087f,0.001868688f,0.001882247f,0.001894743f,0.001906153f,0.001916457f,0.001925635f,0.001933666f,0.001940531f,0.00194621f,0.001950686f,0.001953939f,0.001955952f,0.001956709f,0.001956193f,0.001954388f,0.001951278f,0.00194685f,0.001941089f,0.001933981f,0.001925515f,0.001915678f,0.001904459f,0.001891847f,0.001877834f,0.001862408f,0.001845563f,0.001827291f,0.001807585f,0.00178644f,0.00176385f,0.00173981f,0.001714319f,0.001687373f,0.001658971f,0.001629112f,0.001597796f,0.001565025f,0.0015308f,0.001495125f,0.001458004f,0.001419441f,0.001379443f,0.001338016f,0.001295169f,0.001250911f,0.001205251f,0.001158201f,0.001109772f,0.001059978f,0.001008833f,0.0009563518f,0.0009025513f,0.0008474487f,0.0007910624f,0.000733412f,0.0006745181f,0.0006144025f,0.0005530881f,0.0004905987f,0.0004269595f,0.0003621966f,0.0002963374f,0.0002294102f,0.0001614446f,0.00009247124f,0.00002252185f,-0.00004837065f,-0.0001201723f,-0.0001928479f,-0.0002663613f,-0.000340675f,-0.0004157508f,-0.0004915489f,-0.0005680287f,-0.0006451484f,-0.0007228652f,-0.0008011351f,-0.0008799131f,-0.0009591531f,-0.001038808f,-0.001118829f,-0.001199167f,-0.001279773f,-0.001360594f,-0.001441578f,-0.001522671f,-0.00160382f,-0.001684968f,-0.00176606f,-0.001847038f,-0.001927843f,-0.002008417f,-0.002088698f,-0.002168627f,-0.00224814f,-0.002327175f,-0.002405669f,-0.002483555f,-0.002560769f,-0.002637245f,-0.002712915f,-0.002787711f,-0.002861565f,-0.002934407f,-0.003006167f,-0.003076774f,-0.003146156f,-0.003214241f,-0.003280957f,-0.003346228f,-0.003409982f,-0.003472143f,-0.003532637f,-0.003591386f,-0.003648316f,-0.003703348f,-0.003756405f,-0.00380741f,-0.003856285f,-0.00390295f,-0.003947326f,-0.003989335f,-0.004028896f,-0.004065929f,-0.004100354f,-0.004132092f,-0.004161059f,-0.004187176f,-0.004210362f,-0.004230535f,-0.004247614f,-0.004261517f,-0.004272163f,-0.004279471f,-0.004283357f,-0.004283743f,-0.004280544f,-0.004273681f,-0.004263072f,-0.004248635f,-0.00423029f,-0.004207956f,-0.004181552f,-0.004150998f,-0.004116214f,-0.00407712f,-0.004033636f,-0.003985685f,-0.003933186f,-0.003876062f,-0.003814235f,-0.003747628f,-0.003676163f,-0.003599765f,-0.003518358f,-0.003431867f,-0.003340217f,-0.003243334f,-0.003141146f,-0.00303358f,-0.002920564f,-0.002802027f,-0.002677898f,-0.00254811f,-0.002412592f,-0.002271278f,-0.0021241f,-0.001970992f,-0.001811891f,-0.00164673f,-0.001475448f,-0.001297983f,-0.001114273f,-0.000924259f,-0.0007278814f,-0.0005250828f,-0.0003158064f,-0.00009999688f,0.0001224002f,0.0003514379f,0.0005871683f,0.0008296419f,0.001078908f,0.001335016f,0.001598011f,0.00186794f,0.002144847f,0.002428775f,0.002719765f,0.003017858f,0.003323092f,0.003635505f,0.003955133f,0.004282011f,0.004616172f,0.004957647f,0.005306467f,0.005662661f,0.006026255f,0.006397276f,0.006775748f,0.007161694f,0.007555134f,0.007956089f,0.008364576f,0.008780613f,0.009204214f,0.009635393f,0.01007416f,0.01052053f,0.01097451f,0.0114361f,0.01190531f,0.01238215f,0.01286662f,0.01238215f,0.01190531f,0.0114361f,0.01097451f,0.01052053f,0.01007416f,0.009635393f,0.009204214f,0.008780614f,0.008364577f,0.007956089f,0.007555135f,0.007161694f,0.006775748f,0.006397277f,0.006026255f,0.005662661f,0.005306467f,0.004957648f,0.004616171f,0.004282011f,0.003955133f,0.003635505f,0.003323091f,0.003017858f,0.002719766f,0.002428776f,0.002144847f,0.001867941f,0.001598012f,0.001335017f,0.001078907f,0.0008296408f,0.0005871691f,0.0003514364f,0.0001224019f,-0.00009999797f,-0.0003158078f,-0.0005250834f,-0.0007278807f,-0.0009242594f,-0.001114272f,-0.001297984f,-0.00147545f,-0.001646731f,-0.001811892f,-0.001970991f,-0.002124101f,-0.002271276f,-0.002412591f,-0.00254811f,-0.002677899f,-0.002802026f,-0.002920564f,-0.003033578f,-0.003141146f,-0.003243335f,-0.003340218f,-0.003431868f,-0.003518358f,-0.003599763f,-0.003676161f,-0.003747627f,-0.003814235f,-0.00387606f,-0.003933184f,-0.003985684f,-0.004033636f,-0.004077122f,-0.004116215f,-0.004150994f,-0.004181549f,-0.004207954f,-0.004230291f,-0.004248634f,-0.004263073f,-0.004273683f,-0.004280545f,-0.004283741f,-0.004283354f,-0.004279472f,-0.004272163f,-0.004261516f,-0.004247613f,-0.004230537f,-0.00421036f,-0.004187174f,-0.00416106f,-0.004132092f,-0.004100353f,-0.004065931f,-0.004028894f,-0.003989331f,-0.003947325f,-0.003902949f,-0.003856286f,-0.003807411f,-0.003756404f,-0.003703348f,-0.003648318f,-0.003591388f,-0.003532633f,-0.003472142f,-0.003409982f,-0.003346227f,-0.003280953f,-0.00321424f,-0.003146157f,-0.003076777f,-0.003006168f,-0.002934404f,-0.002861567f,-0.002787709f,-0.002712913f,-0.002637245f,-0.002560772f,-0.002483554f,-0.002405666f,-0.002327174f,-0.002248138f,-0.002168626f,-0.002088696f,-0.002008416f,-0.001927845f,-0.001847036f,-0.001766056f,-0.001684964f,-0.001603819f,-0.001522668f,-0.001441583f,-0.001360595f,-0.001279771f,-0.001199171f,-0.001118824f,-0.001038805f,-0.0009591579f,-0.0008799136f,-0.0008011311f,-0.0007228702f,-0.0006451458f,-0.0005680323f,-0.0004915446f,-0.0004157424f,-0.0003406703f,-0.0002663583f,-0.0001928508f,-0.0001201779f,-0.00004836917f,0.00002251565f,0.00009247661f,0.0001614392f,0.0002294183f,0.0002963394f,0.0003622025f,0.000426963f,0.0004906058f,0.0005530864f,0.0006144047f,0.000674516f,0.0007334203f,0.0007910579f,0.0008474439f,0.0009025484f,0.0009563565f,0.001008838f,0.001059979f,0.001109779f,0.001158208f,0.001205251f,0.001250908f,0.001295164f,0.00133802f,0.001379445f,0.00141944f,0.001458004f,0.001495123f,0.001530796f,0.001565024f,0.001597792f,0.001629114f,0.001658976f,0.001687378f,0.001714319f,0.001739815f,0.00176385f,0.001786441f,0.001807585f,0.001827285f,0.001845568f,0.001862407f,0.001877829f,0.001891851f,0.001904458f,0.001915678f,0.001925513f,0.001933977f,0.001941085f,0.001946852f,0.001951277f,0.001954392f,0.001956195f,0.001956716f,0.001955956f,0.001953945f,0.001950681f,0.001946211f,0.001940534f,0.001933664f,0.001925632f,0.001916453f,0.001906157f,0.001894742f,0.001882255f,0.001868695f,0.001854092f,0.001838461f,0.001821846f,0.001804262f,0.00178571f,0.001766235f,0.001745865f,0.001724601f,0.001702502f,0.001679555f,0.001655802f,0.001631275f,0.001605988f,0.001579955f,0.001553237f,0.001525834f,0.001497775f,0.001469076f,0.001439795f,0.001409918f,0.00137949f,0.001348555f,0.001317099f,0.00128518f,0.001252815f,0.001220033f,0.001186848f,0.00115329f,0.00111939f,0.001085177f,0.001050666f,0.001015887f,0.0009808689f,0.0009456277f,0.0009102076f,0.0008746088f,0.0008388609f,0.0008030087f,0.0007670522f,0.0007310361f,0.0006949604f,0.0006588697f,0.0006227791f,0.0005867183f,0.0005506873f,0.0005147159f,0.0004788637f,0.0004431009f,0.0004074872f,0.0003720224f,0.0003367066f,0.0003016293f,0.0002667308f,0.0002321005f,0.0001977086f,0.0001635849f,0.0001297295f,0.0000962317f,0.00006303191f,0.00003015995f,-0.000002324581f,-0.00003442168f,-0.00006616116f,-0.00009745359f,-0.0001283288f,-0.0001587868f,-0.0001887679f,-0.000218302f,-0.0002473593f,-0.0002759099f,-0.0003039539f,-0.0003314912f,-0.0003584921f,-0.0003849566f,-0.0004108548f,-0.0004362166f,-0.0004609823f,-0.0004851818f,-0.0005087852f,-0.0005318224f,-0.0005542338f,-0.0005760193f,-0.0005972087f,-0.0006177723f,-0.0006376803f,-0.0006569922f,-0.0006756186f,-0.0006936491f,-0.000710994f,-0.0007276833f,-0.0007437468f,-0.0007591248f,-0.0007738471f,-0.0007879138f,-0.0008013248f,-0.0008140504f,-0.0008261204f,-0.0008375347f,-0.0008482635f,-0.0008583367f,-0.0008677542f,-0.0008765161f,-0.0008845925f,-0.0008920133f,-0.0008988082f,-0.0009049177f,-0.0009104013f,-0.0009152293f,-0.0009194314f,-0.0009229779f,-0.0009259284f,-0.0009282231f,-0.0009298921f,-0.0009309649f,-0.0009314418f,-0.0009312928f,-0.0009305775f,-0.0009292662f,-0.0009273589f,-0.0009248853f,-0.0009218752f,-0.0009182692f,-0.0009141564f,-0.0009094775f,-0.0009042919f,-0.0008985698f,-0.0008923411f,-0.0008856058f,-0.0008783937f,-0.0008707047f,-0.0008625388f,-0.0008538961f,-0.0008448362f,-0.0008352995f,-0.0008253753f,-0.0008150041f,-0.0008042455f,-0.0007930994f,-0.0007815659f,-0.0007696748f,-0.0007573962f,-0.0007447898f,-0.0007318556f,-0.0007185936f,-0.0007050037f,-0.0006911159f,-0.0006769598f,-0.0006625354f,-0.0006478429f,-0.0006328821f,-0.0006176829f,-0.0006022751f,-0.0005866587f,-0.0005708337f,-0.0005548298f,-0.0005386472f,-0.0005222857f,-0.0005057752f,-0.0004891157f,-0.0004723668f,-0.0004554689f,-0.0004384816f,-0.0004214048f,-0.0004042387f,-0.0003869832f,-0.0003696978f,-0.0003523827f,-0.0003350079f,-0.0003176033f,-0.0003002286f,-0.000282824f,-0.0002654195f,-0.0002480447f,-0.0002307296f,-0.0002134144f,-0.0001961887f,-0.0001790226f,-0.000161916f,-0.0001448989f,-0.0001279712f,-0.0001111329f,-0.00009444356f,-0.00007784367f,-0.00006139278f,-0.00004506111f,-0.00002890825f,-0.0000128746f,0.00000295043f,0.00001862645f,0.00003412366f,0.00004944205f,0.00006455183f,0.00007945299f,0.00009414554f,0.0001086295f,0.0001229048f,0.0001369119f,0.0001507103f,0.0001642704f,0.0001775622f,0.0001906157f,0.0002034009f,0.0002159476f,0.0002281964f,0.0002401769f,0.0002518892f,0.0002633333f,0.0002744496f,0.0002853274f,0.0002958775f,0.0003061593f,0.0003161132f,0.0003257692f,0.0003351569f,0.000344187f,0.0003529489f,0.000361383f,0.000369519f,0.0003773272f,0.0003848374f,0.0003920197f,0.0003988743f,0.0004054308f,0.0004116893f,0.0004175901f,0.000423193f,0.000428468f,0.000433445f,0.0004380941f,0.0004424453f,0.0004464686f,0.0004501939f,0.0004535913f,0.000456661f,0.0004594624f,0.000461936f,0.0004641116f,0.0004659891f,0.0004675686f,0.0004688203f,0.0004698038f,0.0004705191f,0.0004709065f,0.0004710257f,0.0004708767f,0.0004704297f,0.0004697442f,0.0004687607f,0.000467509f,0.0004659891f,0.0004642308f,0.0004622042f,0.0004599392f,0.0004574358f,0.0004546642f,0.000451684f,0.0004484653f,0.0004450083f,0.0004413426f,0.0004374683f,0.0004333556f,0.000429064f,0.0004245639f,0.0004198551f,0.0004149675f,0.0004099011f,0.0004046559f,0.0003992319f,0.0003936589f,0.000387907f,0.0003819764f,0.0003759265f,0.0003697276f,0.0003633797f,0.0003569126f,0.0003502965f,0.0003435612f,0.0003367364f,0.0003297627f,0.0003227293f,0.000315547f,0.000308305f,0.0003009737f,0.0002935529f,0.0002860427f,0.0002784729f,0.0002708435f,0.0002631545f,0.0002554059f,0.0002476275f,0.0002397895f,0.0002319217f,0.0002240241f,0.0002160966f,0.0002081394f,0.0002001822f,0.0001921952f,0.000184238f,0.0001762509f,0.0001682639f,0.0001602769f,0.0001523495f,0.0001444221f,0.0001364946f,0.0001286268f,0.000120759f,0.0001129508f,0.0001052022f,0.0000975132f,0.0000898242f,0.00008219481f,0.00007468462f,0.00006717443f,0.00005978346f,0.00005239248f,0.00004512072f,0.00003796816f,0.0000308156f,0.00002378225f,0.00001686811f,0.00001001358f,0.000003278255f,-0.000003397465f,-0.000009953976f,-0.00001639128f,-0.00002270937f,-0.00002896786f,-0.00003510714f,-0.0000411272f,-0.00004696846f,-0.00005275011f,-0.00005841255f,-0.00006395578f,-0.00006937981f,-0.00007462502f,-0.00007981062f,-0.00008481741f,-0.00008970499f,-0.00009447336f,-0.00009912252f,-0.0001036525f,-0.0001080036f,-0.0001122355f,-0.0001162887f,-0.0001202822f,-0.0001240969f,-0.0001277328f,-0.000131309f,-0.0001347065f,-0.0001379251f,-0.0001410842f,-0.0001440644f,-0.0001468658f,-0.0001496077f,-0.0001521707f,-0.0001545548f,-0.0001568794f,-0.0001590252f,-0.0001610518f,-0.0001628995f,-0.000164628f,-0.0001662374f,-0.0001677275f,-0.0001690388f,-0.0001702309f,-0.0001713037f,-0.0001722574f,-0.0001730919f,-0.0001737475f,-0.0001743436f,-0.0001747608f,-0.0001750588f,-0.0001752973f,-0.0001753569f,-0.0001752973f,-0.0001751184f,-0.00017488f,-0.0001744628f,-0.000173986f,-0.0001733899f,-0.0001726747f,-0.0001718402f,-0.0001709461f,-0.0001699328f,-0.0001688004f,-0.0001675487f,-0.0001662374f,-0.0001648664f,-0.0001633763f,-0.000161767f,-0.0001601577f,-0.0001583695f,-0.0001565814f,-0.0001546741f,-0.0001527071f,-0.0001506209f,-0.0001485348f,-0.0001463294f,-0.0001440644f,-0.0001417398f,-0.0001393557f,-0.0001369119f,-0.0001344681f,-0.0001319051f,-0.0001292825f,-0.0001266599f,-0.0001239777f,-0.0001212358f,-0.0001184344f,-0.000115633f,-0.000112772f,-0.000109911f,-0.0001069903f,-0.0001040697f,-0.0001010895f,-0.00009810925f,-0.00009506941f,-0.00009202957f,-0.00008898973f,-0.00008589029f,-0.00008285046f,-0.00007975101f,-0.00007665157f,-0.00007355213f,-0.00007045269f,-0.00006729364f,-0.0000641942f,-0.00006109476f,-0.00005799532f,-0.00005489588f,-0.00005179644f,-0.00004869699f,-0.00004565716f,-0.00004255772f,-0.00003951788f,-0.00003647804f,-0.00003349781f,-0.00003051758f,-0.00002753735f,-0.00002461672f,-0.00002169609f,-0.00001877546f,-0.00001591444f,-0.00001311302f,-0.0000103116f,-0.00000756979f,-0.000004827976f,-0.000002086163f,0.0000005364418f,0.000003159046f,0.000005781651f,0.00000834465f,0.00001084805f,0.00001329184f,0.00001573563f,0.00001811981f,0.00002044439f,0.00002270937f,0.00002497435f,0.00002717972f,0.00002932549f,0.00003141165f,0.00003349781f,0.00003546476f,0.00003743172f,0.00003933907f,0.00004118681f,0.00004303455f,0.00004476309f,0.00004649162f,0.00004816055f,0.00004971027f,0.00005125999f,0.00005280972f,0.00005424023f,0.00005561113f,0.00005698204f,0.00005823374f,0.00005948544f,0.00006067753f,0.00006181002f,0.0000628829f,0.00006389618f,0.00006484985f,0.00006580353f,0.0000666976f,0.00006747246f,0.00006824732f,0.00006896257f,0.00006967783f,0.00007027388f,0.00007086992f,0.00007140636f,0.0000718832f,0.00007230043f,0.00007265806f,0.00007301569f,0.00007331371f,0.00007355213f,0.00007373095f,0.00007390976f,0.00007402897f,0.00007408857f,0.00007414818f,0.00007414818f,0.00007408857f,0.00007396936f,0.00007385015f,0.00007367134f,0.00007349253f,0.00007325411f,0.00007295609f,0.00007265806f,0.00007230043f,0.00007194281f,0.00007152557f,0.00007110834f,0.0000706315f,0.00007015467f,0.00006961823f,0.00006902218f,0.00006848574f,0.00006783009f,0.00006723404f,0.00006657839f,0.00006586313f,0.00006514788f,0.00006443262f,0.00006371737f,0.0000629425f,0.00006216764f,0.00006133318f,0.00006049871f,0.00005966425f,0.00005882978f,0.00005799532f,0.00005710125f,0.00005620718f,0.00005531311f,0.00005435944f,0.00005346537f,0.00005251169f,0.00005155802f,0.00005060434f,0.00004965067f,0.00004869699f,0.00004768372f,0.00004673004f,0.00004571676f,0.00004476309f,0.00004374981f,0.00004279613f,0.00004178286f,0.00004076958f,0.0000398159f,0.00003880262f,0.00003784895f,0.00003683567f,0.00003582239f,0.00003486872f,0.00003385544f,0.00003290176f,0.00003194809f,0.00003099442f,0.00003004074f,0.00002908707f,0.00002813339f,0.00002717972f,0.00002622604f,0.00002533197f,0.0000243783f,0.00002348423f,0.00002259016f,0.00002169609f,0.00002086163f,0.00001996756f,0.00001913309f,0.00001829863f,0.00001746416f,0.0000166297f,0.00001585484f,0.00001502037f,0.00001424551f,0.00001347065f,0.00001275539f,0.00001198053f,0.00001126528f,0.00001055002f,0.000009834766f,0.000009179115f,0.00000846386f,0.000007808208f,0.000007152557f,0.000006556511f,0.000005960464f,0.000005364418f,0.000004768372f,0.000004172325f,0.000003635883f,0.000003099442f,0.000002563f,0.000002026558f,0.000001549721f,0.000001072884f,0.0000005960464f,0.0000001192093f,-0.0000002980232f,-0.0000007152557f,-0.000001132488f,-0.000001549721f,-0.000001907349f,-0.000002324581f,-0.000002682209f,-0.000002980232f,-0.00000333786f,-0.000003635883f,-0.000003933907f,-0.00000423193f,-0.000004529953f,-0.000004768372f,-0.00000500679f,-0.000005245209f,-0.000005483627f,-0.000005722046f,-0.00000590086f,-0.000006079674f,-0.000006258488f,-0.000006437302f,-0.000006556511f,-0.000006735325f,-0.000006854534f,-0.000006973743f,-0.000007092953f,-0.000007212162f,-0.000007271767f,-0.000007390976f,-0.000007450581f,-0.000007510185f,-0.00000756979f,-0.000007629395f,-0.000007629395f,-0.000007688999f,-0.000007688999f,-0.000007748604f,-0.000007748604f,-0.000007748604f,-0.000007748604f,-0.000007748604f,-0.000007688999f,-0.000007688999f,-0.000007629395f,-0.000007629395f,-0.00000756979f,-0.000007510185f,-0.000007450581f,-0.000007390976f,-0.000007331371f,-0.000007271767f,-0.000007212162f,-0.000007152557f,-0.000007033348f,-0.000006973743f,-0.000006914139f,-0.00000679493f,-0.000006735325f,-0.000006616116f,-0.000006496906f,-0.000006437302f,-0.000006318092f,-0.000006198883f,-0.000006139278f,-0.000006020069f,-0.00000590086f,-0.000005781651f,-0.000005662441f,-0.000005543232f,-0.000005424023f,-0.000005364418f,-0.000005245209f,-0.000005125999f,-0.00000500679f,-0.000004887581f,-0.000004768372f,-0.000004649162f,-0.000004529953f,-0.000004410744f,-0.000004291534f,-0.00000423193f,-0.00000411272f,-0.000003993511f,-0.000003874302f,-0.000003755093f,-0.000003635883f,-0.000003516674f,-0.000003457069f,-0.00000333786f,-0.000003218651f,-0.000003159046f,-0.000003039837f,-0.000002920628f,-0.000002861023f,-0.000002741814f,-0.000002622604f,-0.000002563f,-0.00000244379f,-0.000002384186f,-0.000002264977f,-0.000002205372f,-0.000002086163f,-0.000002026558f,-0.000001966953f,-0.000001847744f,-0.000001788139f,-0.000001728535f,-0.00000166893f,-0.000001609325f,-0.000001490116f,-0.000001430511f,-0.000001370907f,-0.000001311302f,-0.000001251698f,-0.000001192093f,-0.000001132488f,-0.000001072884f,-0.000001013279f,-0.0000009536743f,-0.0000009536743f,-0.0000008940697f,-0.000000834465f,-0.0000007748604f,-0.0000007748604f,-0.0000007152557f,-0.0000006556511f,-0.0000006556511f,-0.0000005960464f,-0.0000005364418f,-0.0000005364418f,-0.0000004768372f,-0.0000004768372f,-0.0000004172325f,-0.0000004172325f,-0.0000003576279f,-0.0000003576279f,-0.0000003576279f,-0.0000002980232f,-0.0000002980232f,-0.0000002384186f,-0.0000002384186f,-0.0000002384186f,-0.0000002384186f,-0.0000001788139f,-0.0000001788139f,-0.0000001788139f,-0.0000001788139f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.0000001192093f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,-0.00000005960464f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f};
-const int B_OVERSAMPLING =64;
+const int B_OVERSAMPLING = OBXD_BLEP_OVERSAMPLING;
 const int Samples = 16;
+const int BLEP_SIZE = 2*Samples*B_OVERSAMPLING+1;
+
+#ifdef OBXD_BLEP_FP16
+#if defined(__ARM_FP16_FORMAT_IEEE)
+//Native half floats, widening is one instruction
+typedef __fp16 BlepValue;
+inline float blepWiden(BlepValue v) { return v; }
+inline BlepValue blepNarrow(float f) { return (BlepValue)f; }
+#else
+//Half float bit patterns. Widening rebiases the exponent with an integer
+//add; half subnormals (below 6e-5, only in the far tails) are flushed to
+//zero when the tables are built, as float subnormals would be slow to read
+typedef uint16_t BlepValue;
+inline float blepWiden(BlepValue v)
+{
+	uint32_t bits = (v & 0x7fff) ? ((uint32_t)(v & 0x7fff) << 13) + 0x38000000 : 0;
+	bits |= (uint32_t)(v & 0x8000) << 16;
+	float f;
+	memcpy(&f,&bits,4);
+	return f;
+}
+inline BlepValue blepNarrow(float f)
+{
+	uint32_t bits;
+	memcpy(&bits,&f,4);
+	uint32_t mag = bits & 0x7fffffff;
+	if(mag < 0x38800000)
+		return 0;
+	return (BlepValue)(((bits >> 16) & 0x8000) | ((mag - 0x38000000 + 0x1000) >> 13));
+}
+#endif
+#else
+typedef float BlepValue;
+inline float blepWiden(BlepValue v) { return v; }
+inline BlepValue blepNarrow(float f) { return f; }
+#endif
+
+struct BlepTables
+{
+	//Grouped by cutoff so the pair an oscillator reads sits together
+	alignas(64) BlepValue blep[BLEP_SIZE];
+	BlepValue blamp[BLEP_SIZE];
+	BlepValue blepd2[BLEP_SIZE];
+	BlepValue blampd2[BLEP_SIZE];
+
+	BlepTables()
+	{
+		double* step = new double[BLEP_SIZE];
+		double* ramp = new double[BLEP_SIZE];
+		build(1.0,step,ramp,blep,blamp);
+		build(0.5,step,ramp,blepd2,blampd2);
+		delete[] step;
+		delete[] ramp;
+	}
+
+	static void build(double cutoff,double* step,double* ramp,BlepValue* blepOut,BlepValue* blampOut)
+	{
+		const int last = BLEP_SIZE-1;
+		const int center = Samples*B_OVERSAMPLING;
+		double prev = 0;
+		for(int i = 0 ; i < BLEP_SIZE;i++)
+		{
+			double x = (double)(i-center)/B_OVERSAMPLING;
+			double t = (double)i/last;
+			double w = 0.42-0.5*cos(2*M_PI*t)+0.08*cos(4*M_PI*t);
+			double s = (i==center) ? 1.0 : sin(M_PI*cutoff*x)/(M_PI*cutoff*x);
+			double h = cutoff*s*w;
+			//Trapezoid integration, twice
+			step[i] = i ? step[i-1]+(prev+h)*0.5 : 0;
+			ramp[i] = i ? ramp[i-1]+(step[i-1]+step[i])*0.5 : 0;
+			prev = h;
+		}
+		for(int i = 0 ; i < BLEP_SIZE;i++)
+		{
+			double st = step[i]/step[last];
+			double rp = ramp[i]/ramp[last];
+			if(i < center)
+			{
+				blepOut[i] = blepNarrow((float)st);
+				blampOut[i] = blepNarrow((float)rp);
+			}
+			else
+			{
+				blepOut[i] = blepNarrow((float)(1-st));
+				blampOut[i] = blepNarrow((float)(rp-(double)(i-center)/center));
+			}
+		}
+	}
+};
+
+static BlepTables blepTables;
+static BlepValue const * const blep = blepTables.blep;
+static BlepValue const * const blamp = blepTables.blamp;
+static BlepValue const * const blepd2 = blepTables.blepd2;
+static BlepValue const * const blampd2 = blepTables.blampd2;
@@ -27,6 +27,7 @@
 #include "SynthEngine.h"
 #include "Lfo.h"
 #include "Tuning.h"
+#include "VoiceTrace.h"
 
 class Motherboard
 {
@@ -37,7 +38,10 @@ private:
 	bool awaitingkeys[129];
 	int priorities[129];
 
+	//Oversampling ladder decimators: left/right take 2x down to 1x,
+	//left9/right9 take 4x down to 2x, or 2x down to 1x when fastDecimation
 	Decimator17 left,right;
+	Decimator9 left9,right9;
 	int asPlayedCounter;
 	float lkl,lkr;
 	float sampleRate,sampleRateInv;
@@ -56,10 +60,22 @@ public:
 	ObxdVoice voices[MAX_VOICES];
 	bool uni;
 	bool Oversample;
+	int oversampleFactor; //1, 2 or 4 voice samples per output sample
+	bool fastDecimation; //2x only: 9 tap half band instead of 17
 
 	bool economyMode;
-	Motherboard(): left(),right()
+	VoiceTrace trace;
+	bool traceSounding[MAX_VOICES];
+	uint32_t onsetClock[MAX_VOICES];
+	bool onsetPending[MAX_VOICES];
+	Motherboard(): left(),right(),left9(),right9()
 	{
+		for(int i = 0 ; i < MAX_VOICES;i++)
+		{
+			traceSounding[i] = false;
+			onsetPending[i] = false;
+			onsetClock[i] = 0;
+		}
 		economyMode = true;
 		lkl=lkr=0;
 		vibratoEnabled = true;
@@ -72,6 +88,8 @@ public:
 		}
 		vibratoAmount = 0;
 		Oversample=false;
+		oversampleFactor=1;
+		fastDecimation=false;
 		mlfo= Lfo();
 		vibratoLfo=Lfo();
 		vibratoLfo.waveForm = 1;
@@ -96,6 +114,23 @@ public:
 		//}
 		//delete voices;
 	}
+	//Must be called on a copied Motherboard, the voice queue still points at the source voices
+	void relinkVoices()
+	{
+		vq.relink(voices);
+	}
+	int getVoiceCount()
+	{
+		return totalvc;
+	}
+	int getActiveVoiceCount()
+	{
+		int n = 0;
+		for(int i = 0 ; i < totalvc;i++)
+			if(voices[i].env.isActive())
+				n++;
+		return n;
+	}
 	void setVoiceCount(int count)
 	{
 		for(int i = count ; i < MAX_VOICES;i++)
@@ -121,7 +156,18 @@ public:
 		{
 			voices[i].setSampleRate(sr);
 		}
-		SetOversample(Oversample);
+		SetOversampling(oversampleFactor,fastDecimation);
+	}
+	inline int voiceIndex(ObxdVoice* p)
+	{
+		return (int)(p - voices);
+	}
+	//Start timing a new attack on voice p (fresh note or steal)
+	inline void markOnset(ObxdVoice* p)
+	{
+		int v = voiceIndex(p);
+		onsetClock[v] = trace.clock;
+		onsetPending[v] = true;
 	}
 	void sustainOn()
 	{
@@ -162,6 +208,7 @@ public:
 				if(minmidi < noteNo)
 				{
 					awaitingkeys[noteNo] = true;
+					trace.add(VoiceTrace::QUEUED,VoiceTrace::NO_VOICE,noteNo,0);
 				}
 				else
 				{
@@ -171,10 +218,13 @@ public:
 						if(p->midiIndx > noteNo && p->Active)
 						{
 							awaitingkeys[p->midiIndx] = true;
+							trace.add(VoiceTrace::RETRIGGER,voiceIndex(p),noteNo,p->midiIndx);
 							p->NoteOn(noteNo,-0.5);
 						}
 						else
 						{
+							trace.add(VoiceTrace::NOTE_ON,voiceIndex(p),noteNo,(int)(velocity*127));
+							markOnset(p);
 							p->NoteOn(noteNo,velocity);
 						}
 					}
@@ -189,10 +239,13 @@ public:
 					if(p->Active)
 					{
 						awaitingkeys[p->midiIndx] = true;
+						trace.add(VoiceTrace::RETRIGGER,voiceIndex(p),noteNo,p->midiIndx);
 											p->NoteOn(noteNo,-0.5);
 					}
 					else
 					{
+					trace.add(VoiceTrace::NOTE_ON,voiceIndex(p),noteNo,(int)(velocity*127));
+					markOnset(p);
 					p->NoteOn(noteNo,velocity);
 					}
 				}
@@ -206,6 +259,8 @@ public:
 				ObxdVoice* p = vq.getNext();
 				if (!p->Active)
 				{
+					trace.add(VoiceTrace::NOTE_ON,voiceIndex(p),noteNo,(int)(velocity*127));
+					markOnset(p);
 					p->NoteOn(noteNo,velocity);
 					processed = true;
 				}
@@ -231,9 +286,12 @@ public:
 				if(maxmidi < noteNo)
 				{
 					awaitingkeys[noteNo] = true;
+					trace.add(VoiceTrace::QUEUED,VoiceTrace::NO_VOICE,noteNo,0);
 				}
 				else
 				{
+					trace.add(VoiceTrace::STEAL,voiceIndex(highestVoiceAvalible),noteNo,maxmidi);
+					markOnset(highestVoiceAvalible);
 					highestVoiceAvalible->NoteOn(noteNo,-0.5);
 					awaitingkeys[maxmidi] = true;
 				}
@@ -252,6 +310,8 @@ public:
 					}
 				}
 				awaitingkeys[minPriorityVoice->midiIndx] = true;
+				trace.add(VoiceTrace::STEAL,voiceIndex(minPriorityVoice),noteNo,minPriorityVoice->midiIndx);
+				markOnset(minPriorityVoice);
 				minPriorityVoice->NoteOn(noteNo,-0.5);
 			}
 		}
@@ -262,6 +322,7 @@ public:
 	{
 		awaitingkeys[noteNo] = false;
 		int reallocKey = 0;
+		bool matched = false;
 		//Voice release case
 		if(!asPlayedMode)
 		{
@@ -290,6 +351,8 @@ public:
 				ObxdVoice* p = vq.getNext();
 				if((p->midiIndx == noteNo) && (p->Active))
 				{
+					matched = true;
+					trace.add(VoiceTrace::REALLOC,voiceIndex(p),reallocKey,noteNo);
 					p->NoteOn(reallocKey,-0.5);
 					awaitingkeys[reallocKey] = false;
 				}
@@ -304,32 +367,34 @@ public:
 				ObxdVoice* n = vq.getNext();
 				if (n->midiIndx==noteNo && n->Active)
 				{
+					matched = true;
+					trace.add(VoiceTrace::NOTE_OFF,voiceIndex(n),noteNo,0);
 					n->NoteOff();
 				}
 			}
 		}
+		if(!matched)
+			trace.add(VoiceTrace::ORPHAN_OFF,VoiceTrace::NO_VOICE,noteNo,0);
 	}
 	void SetOversample(bool over)
 	{
-		if(over==true)
-		{
-			mlfo.setSamlpeRate(sampleRate*2);
-			vibratoLfo.setSamlpeRate(sampleRate*2);
-		}
-		else
-		{
-			mlfo.setSamlpeRate(sampleRate);
-			vibratoLfo.setSamlpeRate(sampleRate);
-		}
+		SetOversampling(over?2:1,false);
+	}
+	//factor 1, 2 or 4; fast picks the 9 tap stage for 2x
+	void SetOversampling(int factor,bool fast)
+	{
+		if(factor!=2 && factor!=4)
+			factor=1;
+		mlfo.setSamlpeRate(sampleRate*factor);
+		vibratoLfo.setSamlpeRate(sampleRate*factor);
 		for(int i = 0 ; i < MAX_VOICES;i++)
 		{
-			voices[i].setHQ(over);
-			if(over)
-				voices[i].setSampleRate(sampleRate*2);
-			else
-				voices[i].setSampleRate(sampleRate);
+			voices[i].setHQ(factor>1);
+			voices[i].setSampleRate(sampleRate*factor);
 		}
-		Oversample = over;
+		oversampleFactor = factor;
+		fastDecimation = fast && factor==2;
+		Oversample = factor>1;
 	}
 	inline float processSynthVoice(ObxdVoice& b,float lfoIn,float vibIn )
 	{
@@ -346,40 +411,67 @@ public:
 	void processSample(float* sm1,float* sm2)
 	{
 		tuning.updateMTSESPStatus();
+		trace.clock++;
 		mlfo.update();
 		vibratoLfo.update();
-		float vl=0,vr=0;
-		float vlo = 0 , vro = 0 ;
-		float lfovalue = mlfo.getVal();
-		float viblfo = vibratoEnabled?(vibratoLfo.getVal() * vibratoAmount):0;
-		float lfovalue2=0,viblfo2;
-		if(Oversample)
-		{		
+		const int factor = oversampleFactor;
+		float vl[4]={0,0,0,0},vr[4]={0,0,0,0};
+		float lfovalue[4],viblfo[4];
+		lfovalue[0] = mlfo.getVal();
+		viblfo[0] = vibratoEnabled?(vibratoLfo.getVal() * vibratoAmount):0;
+		for(int k = 1 ; k < factor;k++)
+		{
 			mlfo.update();
-		vibratoLfo.update();
-		lfovalue2 = mlfo.getVal();
-		viblfo2 = vibratoEnabled?(vibratoLfo.getVal() * vibratoAmount):0;
+			vibratoLfo.update();
+			lfovalue[k] = mlfo.getVal();
+			viblfo[k] = vibratoEnabled?(vibratoLfo.getVal() * vibratoAmount):0;
 		}
 
 		for(int i = 0 ; i < totalvc;i++)
 		{
 				voices[i].initTuning(&tuning);
-				float x1 = processSynthVoice(voices[i],lfovalue,viblfo);
-				if(Oversample)
+				float pr = pannings[i % MAX_PANNINGS];
+				float x1 = processSynthVoice(voices[i],lfovalue[0],viblfo[0]);
+				vl[0]+=x1*(1-pr);
+				vr[0]+=x1*pr;
+				for(int k = 1 ; k < factor;k++)
+				{
+					float xk = processSynthVoice(voices[i],lfovalue[k],viblfo[k]);
+					vl[k]+=xk*(1-pr);
+					vr[k]+=xk*pr;
+				}
+				if(onsetPending[i] && (x1 > 0.001f || x1 < -0.001f))
 				{
-					float x2 =  processSynthVoice(voices[i],lfovalue2,viblfo2);
-					vlo+=x2*(1-pannings[i % MAX_PANNINGS]);
-					vro+=x2*(pannings[i % MAX_PANNINGS]);
+					trace.addOnset(trace.clock - onsetClock[i]);
+					onsetPending[i] = false;
 				}
-				vl+=x1*(1-pannings[i % MAX_PANNINGS]);
-				vr+=x1*(pannings[i % MAX_PANNINGS]);
+				bool sounding = voices[i].env.isActive();
+				if(traceSounding[i] && !sounding)
+					trace.add(VoiceTrace::IDLE,i,voices[i].midiIndx,0);
+				traceSounding[i] = sounding;
+		}
+		float ol=vl[0],or_=vr[0];
+		if(factor==4)
+		{
+			//Short stage at 4x, its wide transition band lands above the final one
+			float l0 = left9.Calc(vl[0],vl[1]);
+			float r0 = right9.Calc(vr[0],vr[1]);
+			float l1 = left9.Calc(vl[2],vl[3]);
+			float r1 = right9.Calc(vr[2],vr[3]);
+			ol = left.Calc(l0,l1);
+			or_ = right.Calc(r0,r1);
+		}
+		else if(factor==2 && fastDecimation)
+		{
+			ol = left9.Calc(vl[0],vl[1]);
+			or_ = right9.Calc(vr[0],vr[1]);
 		}
-		if(Oversample)
+		else if(factor==2)
 		{
-			vl = left.Calc(vl,vlo);
-			vr = right.Calc(vr,vro);
+			ol = left.Calc(vl[0],vl[1]);
+			or_ = right.Calc(vr[0],vr[1]);
 		}
-		*sm1 = vl*Volume;
-		*sm2 = vr*Volume;
+		*sm1 = ol*Volume;
+		*sm2 = or_*Volume;
 	}
 };
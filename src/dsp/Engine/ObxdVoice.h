@@ -117,6 +117,8 @@ public:
 
 
 	DelayLine<Samples*2> lenvd,fenvd,lfod;
+	//Envelope delay lines still hold the last note, cleared on the next sample
+	bool delaysStale;
 
 	ApInterpolator ap;
 	float oscpsw;
@@ -135,6 +137,7 @@ public:
 		ng = Random(Random::getSystemRandom().nextInt64());
 		sustainHold = false;
 		shouldProcessed = false;
+		delaysStale = false;
 		vamp=vflt=0;
 		velocityValue=0;
 		lfoVibratoIn=0;
@@ -178,6 +181,12 @@ public:
 	}
 	inline float ProcessSample()
 	{
+		if(delaysStale)
+		{
+			lenvd.fillZeroes();
+			fenvd.fillZeroes();
+			delaysStale = false;
+		}
 		double tunedMidiNote = tuning->tunedMidiNote(midiIndx);
         
 		//portamento on osc input voltage
@@ -281,9 +290,10 @@ public:
 		if(!shouldProcessed)
 		{
 			//When your processing is paused we need to clear delay lines and envelopes
-			//Not doing this will cause clicks or glitches
-			lenvd.fillZeroes();
-			fenvd.fillZeroes();
+			//Not doing this will cause clicks or glitches. The delay lines are
+			//cleared by the first ProcessSample, so a chord of note-ons stays cheap
+			//and a voice retriggered before it sounds is only cleared once
+			delaysStale = true;
 			ResetEnvelope();
 		}
 		shouldProcessed = true;
@@ -30,7 +30,7 @@ class SawOsc
 	float buffer1[Samples*2];
 	const int hsam;
 	const int n;
-	float const * blepPTR;
+	BlepValue const * blepPTR;
 	int bP1;
 public:
 	SawOsc() : hsam(Samples)
@@ -105,13 +105,13 @@ public:
 		float f1 = 1.0f-frac;
 		for(int i = 0 ; i < Samples;i++)
 		{
-			float mixvalue = (blepPTR[lpIn]*f1+blepPTR[lpIn+1]*frac);
+			float mixvalue = (blepWiden(blepPTR[lpIn])*f1+blepWiden(blepPTR[lpIn+1])*frac);
 			buf[(bpos+i)&(n-1)]  += mixvalue*scale;
 			lpIn += B_OVERSAMPLING;
 		}
 		for(int i = Samples ; i <n;i++)
 		{
-			float mixvalue = (blepPTR[lpIn]*f1+blepPTR[lpIn+1]*frac);
+			float mixvalue = (blepWiden(blepPTR[lpIn])*f1+blepWiden(blepPTR[lpIn+1])*frac);
 			buf[(bpos+i)&(n-1)]  -= mixvalue*scale;
 			lpIn += B_OVERSAMPLING;
 		}
@@ -37,15 +37,33 @@ private:
 	ParamSmoother pitchWheelSmoother;
 	ParamSmoother modWheelSmoother;
 	float sampleRate;
+	float oversamplingParam;
+	int oversamplingLimit;
 	//JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SynthEngine)
 public:
+	//Oversampling ladder rungs, in order of cost
+	enum { OVERSAMPLE_1X, OVERSAMPLE_2X_FAST, OVERSAMPLE_2X, OVERSAMPLE_4X, OVERSAMPLE_RUNGS };
 	SynthEngine():
 		cutoffSmoother(),
 		//synth = new Motherboard();
 		pitchWheelSmoother(),
-		modWheelSmoother()
+		modWheelSmoother(),
+		oversamplingParam(0),
+		oversamplingLimit(OVERSAMPLE_4X)
 	{
 	}
+	//Copies the full engine state (voices, envelopes, filters, lfo phases)
+	SynthEngine(const SynthEngine& other):
+		synth(other.synth),
+		cutoffSmoother(other.cutoffSmoother),
+		pitchWheelSmoother(other.pitchWheelSmoother),
+		modWheelSmoother(other.modWheelSmoother),
+		sampleRate(other.sampleRate),
+		oversamplingParam(other.oversamplingParam),
+		oversamplingLimit(other.oversamplingLimit)
+	{
+		synth.relinkVoices();
+	}
 	~SynthEngine()
 	{
 		//delete synth;
@@ -70,6 +88,32 @@ public:
 
 		synth.processSample(left,right);
 	}
+	int getActiveVoiceCount()
+	{
+		return synth.getActiveVoiceCount();
+	}
+	const VoiceTrace& getTrace()
+	{
+		return synth.trace;
+	}
+	//Voice array, for reporting where the engine state sits in memory
+	const ObxdVoice* getVoices()
+	{
+		return synth.voices;
+	}
+	void resetTraceStats()
+	{
+		synth.trace.resetStats();
+	}
+	//Forget all trace events and totals, for a copy that should not report its source's history
+	void resetTrace()
+	{
+		synth.trace.clear();
+	}
+	int getVoiceCount()
+	{
+		return synth.getVoiceCount();
+	}
 	void allNotesOff()
 	{
 		for(int i = 0 ;  i < 128;i++)
@@ -506,9 +550,37 @@ public:
 			synth.voices[i].flt.setMultimode(linsc(param,0,1));
 		}
 	}
+	//Patch rung: 0 = 1x, 1/3 = 2x with the 9 tap decimator, 2/3 = 2x, 1 = 4x.
+	//Legacy patches store the HQ switch (1 = 2x); the host maps that on load
 	void processOversampling(float param)
 	{
-		synth.SetOversample(param>0.5);
+		oversamplingParam = param;
+		int rung = (int)(param * (OVERSAMPLE_RUNGS - 1) + 0.5f);
+		if(rung < 0)
+			rung = 0;
+		if(rung > oversamplingLimit)
+			rung = oversamplingLimit;
+		switch(rung)
+		{
+		case OVERSAMPLE_2X_FAST: synth.SetOversampling(2,true); break;
+		case OVERSAMPLE_2X: synth.SetOversampling(2,false); break;
+		case OVERSAMPLE_4X: synth.SetOversampling(4,false); break;
+		default: synth.SetOversampling(1,false); break;
+		}
+	}
+	//Highest rung patches may select, for hosts trading aliasing against CPU
+	void setOversamplingLimit(int rung)
+	{
+		oversamplingLimit = rung;
+		processOversampling(oversamplingParam);
+	}
+	int getOversamplingRung()
+	{
+		if(synth.oversampleFactor == 4)
+			return OVERSAMPLE_4X;
+		if(synth.oversampleFactor == 2)
+			return synth.fastDecimation ? OVERSAMPLE_2X_FAST : OVERSAMPLE_2X;
+		return OVERSAMPLE_1X;
 	}
 	void processFilterEnvelopeAmt(float param)
 	{
@@ -31,8 +31,8 @@ class TriangleOsc
 	float buffer1[Samples*2];
 	const int hsam;
 	const int n;
-	float const * blepPTR;
-	float const * blampPTR;
+	BlepValue const * blepPTR;
+	BlepValue const * blampPTR;
 
 	int bP1,bP2;
 public:
@@ -148,7 +148,7 @@ public:
 		float f1 = 1.0f-frac;
 		for(int i = 0 ; i < n;i++)
 		{
-			float mixvalue = (blampPTR[lpIn]*f1+blampPTR[lpIn+1]*(frac));
+			float mixvalue = (blepWiden(blampPTR[lpIn])*f1+blepWiden(blampPTR[lpIn+1])*frac);
 			buf[(bpos+i)&(n-1)]  += mixvalue*scale;
 			lpIn += B_OVERSAMPLING;
 		}
@@ -160,13 +160,13 @@ public:
 		float f1 = 1.0f-frac;
 		for(int i = 0 ; i < Samples;i++)
 		{
-			float mixvalue = (blepPTR[lpIn]*f1+blepPTR[lpIn+1]*(frac));
+			float mixvalue = (blepWiden(blepPTR[lpIn])*f1+blepWiden(blepPTR[lpIn+1])*frac);
 			buf[(bpos+i)&(n-1)]  += mixvalue*scale;
 			lpIn += B_OVERSAMPLING;
 		}
 		for(int i = Samples ; i <n;i++)
 		{
-			float mixvalue = (blepPTR[lpIn]*f1+blepPTR[lpIn+1]*(frac));
+			float mixvalue = (blepWiden(blepPTR[lpIn])*f1+blepWiden(blepPTR[lpIn+1])*frac);
 			buf[(bpos+i)&(n-1)]  -= mixvalue*scale;
 			lpIn += B_OVERSAMPLING;
 		}
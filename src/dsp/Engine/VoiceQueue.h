@@ -51,4 +51,9 @@ public:
 		total = voiceCount;
 		idx = idx%total;
 	}
+	//Point at another voice array after the owning Motherboard is copied
+	inline void relink(ObxdVoice* voicesReference)
+	{
+		voices = voicesReference;
+	}
 };
@@ -0,0 +1,129 @@
+/*
+	==============================================================================
+	This file is part of Obxd synthesizer.
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+#include <stdint.h>
+
+//One voice allocation decision, 8 bytes
+struct VoiceTraceEvent
+{
+	uint32_t time;	//Motherboard sample clock
+	uint8_t type;	//VoiceTrace::Type
+	uint8_t voice;	//Voice index, VoiceTrace::NO_VOICE when none was involved
+	uint8_t note;
+	uint8_t aux;	//Velocity for NOTE_ON, otherwise the other note involved
+};
+
+//Flight recorder of note and voice-state events.
+//Written by the audio thread only, never blocks, overwrites the oldest events.
+class VoiceTrace
+{
+public:
+	enum { SIZE = 1024, NO_VOICE = 0xFF };
+	enum Type
+	{
+		NOTE_ON = 1,	//Free voice started a note
+		NOTE_OFF,		//Voice released
+		STEAL,			//Sounding voice taken over, aux = note it was playing
+		RETRIGGER,		//Voice moved to another note without a new attack (unison/legato)
+		QUEUED,			//No voice given, note parked in awaitingkeys
+		REALLOC,		//Released voice handed to a parked key, aux = released note
+		IDLE,			//Envelope finished, voice free
+		ORPHAN_OFF,		//Note off that matched no sounding voice
+		TYPE_COUNT
+	};
+	uint32_t clock;
+	//Totals since resetStats(), audio thread writes, anyone may read
+	uint32_t counts[TYPE_COUNT];
+	//Note onset latency: dispatch to first sample above -60 dBFS on that voice
+	uint64_t onsetSamplesTotal;
+	uint32_t onsetCount;
+	uint32_t onsetMax;
+private:
+	uint32_t head;
+	VoiceTraceEvent events[SIZE];
+public:
+	VoiceTrace()
+	{
+		clock = 0;
+		head = 0;
+		resetStats();
+	}
+	//Owner only: drop the events too
+	void clear()
+	{
+		head = 0;
+		resetStats();
+	}
+	//Audio thread only
+	void resetStats()
+	{
+		for(int i = 0 ; i < TYPE_COUNT;i++)
+			counts[i] = 0;
+		onsetSamplesTotal = 0;
+		onsetCount = 0;
+		onsetMax = 0;
+	}
+	inline void add(int type,int voice,int note,int aux)
+	{
+		VoiceTraceEvent& e = events[head & (SIZE - 1)];
+		e.time = clock;
+		e.type = (uint8_t)type;
+		e.voice = (uint8_t)voice;
+		e.note = (uint8_t)note;
+		e.aux = (uint8_t)aux;
+		counts[type]++;
+		__atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+	}
+	inline void addOnset(uint32_t samples)
+	{
+		onsetSamplesTotal += samples;
+		onsetCount++;
+		if(samples > onsetMax)
+			onsetMax = samples;
+	}
+	//Copy events after *cursor from any thread, advancing it.
+	//Events overwritten before they could be read are counted in *lost.
+	int read(uint32_t* cursor,VoiceTraceEvent* out,int maxEvents,uint32_t* lost) const
+	{
+		uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+		uint32_t from = *cursor;
+		if(h - from > SIZE)
+		{
+			*lost += h - from - SIZE;
+			from = h - SIZE;
+		}
+		int n = (int)(h - from);
+		if(n > maxEvents)
+			n = maxEvents;
+		for(int i = 0 ; i < n;i++)
+			out[i] = events[(from + i) & (SIZE - 1)];
+		//Drop the front of the copy if the writer lapped it meanwhile
+		uint32_t h2 = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+		int skip = 0;
+		if(h2 - from > SIZE)
+			skip = (int)(h2 - from - SIZE);
+		if(skip > n)
+			skip = n;
+		for(int i = skip ; i < n;i++)
+			out[i - skip] = out[i];
+		*lost += skip;
+		*cursor = from + n;
+		return n - skip;
+	}
+};
@@ -22,420 +22,266 @@
 	==============================================================================
  */
 #pragma once
-#include "SynthEngine.h"
 #include "ParamsEnum.h"
-#include "../JuceLibraryCode/JuceHeader.h"
+#include <string.h>
+//JUCE-free port of the OB-Xd CC map: one 128 entry CC -> ParamsEnum table,
+//so a controller message costs a single lookup
+struct MidiMapEntry
+{
+	int cc;
+	int param;
+};
+struct MidiMapTag
+{
+	const char* tag;
+	int param;
+};
 class MidiMap
 {
 public:
-	int controllers[255];
-    int controllers_default[255];
-    
-    std::map<String, int> mapping;
-    
-    bool loaded = false;
+	static const int CC_COUNT = 128;
+	int controllers[CC_COUNT];
+	int controllers_default[CC_COUNT];
+
 	MidiMap()
 	{
-        reset();
-        set_default();
+		reset();
+		set_default();
+	}
+	void reset(){
+		for(int i = 0 ; i < CC_COUNT;i++){
+			controllers[i] = -1;
+			controllers_default[i] = -1;
+		}
 	}
-    void reset(){
-        for(int i = 0 ; i < 255;i++){
-            controllers[i] = -1;
-            controllers_default[i] = -1;
-        }
-    }
-    
-    void set_default(){
-        int midicc = 71;
-        controllers[midicc] = controllers_default[midicc] = VOLUME;
-        mapping["VOLUME"]=VOLUME;
-        
-        midicc = 15;
-        controllers[midicc] = controllers_default[midicc] = VOICE_COUNT;
-        mapping["VOICE_COUNT"]=VOICE_COUNT;
-        
-        midicc = 33;
-        controllers[midicc] = controllers_default[midicc] = TUNE;
-        mapping["TUNE"]=TUNE;
-        
-        
-        midicc = 17;
-        controllers[midicc] = controllers_default[midicc] = OCTAVE;
-        mapping["OCTAVE"]=OCTAVE;
-        
-        midicc = 118;
-        controllers[midicc] = controllers_default[midicc] = BENDRANGE;
-        mapping["BENDRANGE"]=BENDRANGE;
-        
-        midicc = 34;
-        controllers[midicc] = controllers_default[midicc] = BENDOSC2;
-        mapping["BENDOSC2"]=BENDOSC2;
-        
-        midicc = 35;
-        controllers[midicc] = controllers_default[midicc] = LEGATOMODE;
-        mapping["LEGATOMODE"]=LEGATOMODE;
-        
-        midicc = 75;
-        controllers[midicc] = controllers_default[midicc] = BENDLFORATE;
-        mapping["BENDLFORATE"]=BENDLFORATE;
-        
-        midicc = 76;
-        controllers[midicc] = controllers_default[midicc] = VFLTENV;
-        mapping["VFLTENV"]=VFLTENV;
-        
-        midicc = 20;
-        controllers[midicc] = controllers_default[midicc] = VAMPENV;
-        mapping["VAMPENV"]=VAMPENV;
-        
-        midicc = 21;
-        controllers[midicc] = controllers_default[midicc] = ASPLAYEDALLOCATION;
-        mapping["ASPLAYEDALLOCATION"]=ASPLAYEDALLOCATION;
-        
-        midicc = 23;
-        controllers[midicc] = controllers_default[midicc] = PORTAMENTO;
-        mapping["PORTAMENTO"]=PORTAMENTO;
-        
-        midicc = 16;
-        controllers[midicc] = controllers_default[midicc] = UNISON;
-        mapping["UNISON"]=UNISON;
-        
-        midicc = 24;
-        controllers[midicc] = controllers_default[midicc] = UDET;
-        mapping["UDET"]=UDET;
-        
-        midicc = 43;
-        controllers[midicc] = controllers_default[midicc] = OSC2_DET;
-        mapping["OSC2_DET"]=OSC2_DET;
-        
-        midicc = 19;
-        controllers[midicc] = controllers_default[midicc] = LFOFREQ;
-        mapping["LFOFREQ"]=LFOFREQ;
-        
-        midicc = 44;
-        controllers[midicc] = controllers_default[midicc] = LFOSINWAVE;
-        mapping["LFOSINWAVE"]=LFOSINWAVE;
-        
-        midicc = 45;
-        controllers[midicc] = controllers_default[midicc] = LFOSQUAREWAVE;
-        mapping["LFOSQUAREWAVE"]=LFOSQUAREWAVE;
-        
-        midicc = 46;
-        controllers[midicc] = controllers_default[midicc] = LFOSHWAVE;
-        mapping["LFOSHWAVE"]=LFOSHWAVE;
-        
-        midicc = 22;
-        controllers[midicc] = controllers_default[midicc] = LFO1AMT;
-        mapping["LFO1AMT"]=LFO1AMT;
-        
-        midicc = 25;
-        controllers[midicc] = controllers_default[midicc] = LFO2AMT;
-        mapping["LFO2AMT"]=LFO2AMT;
-        
-        midicc = 47;
-        controllers[midicc] = controllers_default[midicc] = LFOOSC1;
-        mapping["LFOOSC1"]=LFOOSC1;
-        
-        midicc = 48;
-        controllers[midicc] = controllers_default[midicc] = LFOOSC2;
-        mapping["LFOOSC2"]=LFOOSC2;
-        
-        midicc = 49;
-        controllers[midicc] = controllers_default[midicc] = LFOFILTER;
-        mapping["LFOFILTER"]=LFOFILTER;
-        
-        midicc = 50;
-        controllers[midicc] = controllers_default[midicc] = LFOPW1;
-        mapping["LFOPW1"]=LFOPW1;
-        
-        midicc = 51;
-        controllers[midicc] = controllers_default[midicc] = LFOPW2;
-        mapping["LFOPW2"]=LFOPW2;
-        
-        midicc = 52;
-        controllers[midicc] = controllers_default[midicc] = OSC2HS;
-        mapping["OSC2HS"]=OSC2HS;
-        
-        midicc = 53;
-        controllers[midicc] = controllers_default[midicc] = XMOD;
-        mapping["XMOD"]=XMOD;
-        
-        midicc = 54;
-        controllers[midicc] = controllers_default[midicc] = OSC1P;
-        mapping["OSC1P"]=OSC1P;
-        
-        midicc = 55;
-        controllers[midicc] = controllers_default[midicc] = OSC2P;
-        mapping["OSC2P"]=OSC2P;
-        
-        midicc = 56;
-        controllers[midicc] = controllers_default[midicc] = OSCQuantize;
-        mapping["OSCQuantize"]=OSCQuantize;
-        
-        midicc = 57;
-        controllers[midicc] = controllers_default[midicc] = OSC1Saw;
-        mapping["OSC1Saw"]=OSC1Saw;
-        
-        midicc = 58;
-        controllers[midicc] = controllers_default[midicc] = OSC1Pul;
-        mapping["OSC1Pul"]=OSC1Pul;
-        
-        midicc = 59;
-        controllers[midicc] = controllers_default[midicc] = OSC2Saw;
-        mapping["OSC2Saw"]=OSC2Saw;
-        
-        midicc = 60;
-        controllers[midicc] = controllers_default[midicc] = OSC2Pul;
-        mapping["OSC2Pul"]=OSC2Pul;
-        
-        midicc = 61;
-        controllers[midicc] = controllers_default[midicc] = PW;
-        mapping["PW"]=PW;
-        
-        midicc = 62;
-        controllers[midicc] = controllers_default[midicc] = BRIGHTNESS;
-        mapping["BRIGHTNESS"]=BRIGHTNESS;
-        
-        midicc = 63;
-        controllers[midicc] = controllers_default[midicc] = ENVPITCH;
-        mapping["ENVPITCH"]=ENVPITCH;
-        
-        midicc = 77;
-        controllers[midicc] = controllers_default[midicc] = OSC1MIX;
-        mapping["OSC1MIX"]=OSC1MIX;
-        
-        midicc = 78;
-        controllers[midicc] = controllers_default[midicc] = OSC2MIX;
-        mapping["OSC2MIX"]=OSC2MIX;
-        
-        midicc = 102;
-        controllers[midicc] = controllers_default[midicc] = NOISEMIX;
-        mapping["NOISEMIX"]=NOISEMIX;
-        
-        midicc = 103;
-        controllers[midicc] = controllers_default[midicc] = FLT_KF;
-        mapping["FLT_KF"]=FLT_KF;
-        
-        midicc = 74;
-        controllers[midicc] = controllers_default[midicc] = CUTOFF;
-        mapping["CUTOFF"]=CUTOFF;
-        
-        midicc = 42;
-        controllers[midicc] = controllers_default[midicc] = RESONANCE;
-        mapping["RESONANCE"]=RESONANCE;
-        
-        midicc = 104;
-        controllers[midicc] = controllers_default[midicc] = MULTIMODE;
-        mapping["MULTIMODE"]=MULTIMODE;
-        
-        midicc = 18;
-        controllers[midicc] = controllers_default[midicc] = FILTER_WARM;
-        mapping["FILTER_WARM"]=FILTER_WARM;
-        
-        midicc = 105;
-        controllers[midicc] = controllers_default[midicc] = BANDPASS;
-        mapping["BANDPASS"]=BANDPASS;
-        
-        midicc = 106;
-        controllers[midicc] = controllers_default[midicc] = FOURPOLE;
-        mapping["FOURPOLE"]=FOURPOLE;
-        
-        midicc = 107;
-        controllers[midicc] = controllers_default[midicc] = ENVELOPE_AMT;
-        mapping["ENVELOPE_AMT"]=ENVELOPE_AMT;
-        
-        midicc = 73;
-        controllers[midicc] = controllers_default[midicc] = LATK;
-        mapping["LATK"]=LATK;
-        
-        midicc = 36;
-        controllers[midicc] = controllers_default[midicc] = LDEC;
-        mapping["LDEC"]=LDEC;
-        
-        midicc = 37;
-        controllers[midicc] = controllers_default[midicc] = LSUS;
-        mapping["LSUS"]=LSUS;
-        
-        midicc = 72;
-        controllers[midicc] = controllers_default[midicc] = LREL;
-        mapping["LREL"]=LREL;
-        
-        midicc = 38;
-        controllers[midicc] = controllers_default[midicc] = FATK;
-        mapping["FATK"]=FATK;
-        
-        midicc = 39;
-        controllers[midicc] = controllers_default[midicc] = FDEC;
-        mapping["FDEC"]=FDEC;
-        
-        midicc = 40;
-        controllers[midicc] = controllers_default[midicc] = FSUS;
-        mapping["FSUS"]=FSUS;
-        
-        midicc = 41;
-        controllers[midicc] = controllers_default[midicc] = FREL;
-        mapping["FREL"]=FREL;
-        
-        midicc = 108;
-        controllers[midicc] = controllers_default[midicc] = ENVDER;
-        mapping["ENVDER"]=ENVDER;
-        
-        midicc = 109;
-        controllers[midicc] = controllers_default[midicc] = FILTERDER;
-        mapping["FILTERDER"]=FILTERDER;
-        
-        midicc = 110;
-        controllers[midicc] = controllers_default[midicc] = PORTADER;
-        mapping["PORTADER"]=PORTADER;
-        
-        midicc = 81;
-        controllers[midicc] = controllers_default[midicc] = PAN1;
-        mapping["PAN1"]=PAN1;
-        
-        midicc = 82;
-        controllers[midicc] = controllers_default[midicc] = PAN2;
-        mapping["PAN2"]=PAN2;
-        
-        midicc = 83;
-        controllers[midicc] = controllers_default[midicc] = PAN3;
-        mapping["PAN3"]=PAN3;
-        
-        midicc = 84;
-        controllers[midicc] = controllers_default[midicc] = PAN4;
-        mapping["PAN4"]=PAN4;
-        
-        midicc = 85;
-        controllers[midicc] = controllers_default[midicc] = PAN5;
-        mapping["PAN5"]=PAN5;
-        
-        midicc = 86;
-        controllers[midicc] = controllers_default[midicc] = PAN6;
-        mapping["PAN6"]=PAN6;
-        
-        midicc = 87;
-        controllers[midicc] = controllers_default[midicc] = PAN7;
-        mapping["PAN7"]=PAN7;
-        
-        midicc = 88;
-        controllers[midicc] = controllers_default[midicc] = PAN8;
-        mapping["PAN8"]=PAN8;
-        
-        midicc = 111;
-        controllers[midicc] = controllers_default[midicc] = ECONOMY_MODE;
-        mapping["ECONOMY_MODE"]=ECONOMY_MODE;
-        
-        //midicc = 112;
-        //controllers[midicc] = controllers_default[midicc] = LFO_SYNC;
-        
-        midicc = 113;
-        controllers[midicc] = controllers_default[midicc] = PW_ENV;
-        mapping["PW_ENV"]=PW_ENV;
-        
-        midicc = 114;
-        controllers[midicc] = controllers_default[midicc] = PW_ENV_BOTH;
-        mapping["PW_ENV_BOTH"]=PW_ENV_BOTH;
-        
-        midicc = 115;
-        controllers[midicc] = controllers_default[midicc] = ENV_PITCH_BOTH;
-        mapping["ENV_PITCH_BOTH"]=ENV_PITCH_BOTH;
-        
-        midicc = 116;
-        controllers[midicc] = controllers_default[midicc] = FENV_INVERT;
-        mapping["FENV_INVERT"]=FENV_INVERT;
-        
-        midicc = 117;
-        controllers[midicc] = controllers_default[midicc] = PW_OSC2_OFS;
-        mapping["PW_OSC2_OFS"]=PW_OSC2_OFS;
-        
-        midicc = 118;
-        controllers[midicc] = controllers_default[midicc] = LEVEL_DIF;
-        mapping["LEVEL_DIF"]=LEVEL_DIF;
-        
-        midicc = 119;
-        controllers[midicc] = controllers_default[midicc] = SELF_OSC_PUSH;
-        mapping["SELF_OSC_PUSH"]=SELF_OSC_PUSH;
-        
-    }
-    
-    
-    int& operator[](int index)
-    {
-        if (index >= 255) {
-            exit(0);
-        }
-        return controllers[index];
-    }
-    
-    void setXml( XmlElement &xml){
-        for (int i = 0; i < 255; ++i)
-        {
-            if (controllers[i]!= -1){
-                xml.setAttribute("MIDI_" +String(i), getTag(controllers[i]));
-            }
-        }
-    }
-    String getTag(int paraId){
-        for (std::map<String, int>::iterator it = this->mapping.begin(); it != this->mapping.end(); it ++){
-            if (paraId == it->second){
-                return it->first;
-            }
-        }
-        return "undefine";
-    }
-    
-    int getParaId(String tagName){
-        return mapping[tagName];
-    }
-    
-    void getXml(XmlElement &xml){
-        for (int i = 0; i < 255; ++i)
-        {
-            String tmp = xml.getStringAttribute("MIDI_" + String(i), "undefine");
-            if (tmp != "undefine"){
-                controllers[i] = getParaId(tmp);
-            }
-        }
-        
-        // Backward keys
-        if (controllers[100] > 0) {
-            controllers[77] = controllers_default[77];
-            controllers[100] = 0;
-        }
-        if ( controllers[101] > 0) {
-            controllers[78] = controllers_default[78];
-            controllers[101] = 0;
-        }
-    }
-    
-    bool loadFile(File& xml){
-        reset();
-        set_default();
-        if (xml.existsAsFile()){
-            XmlDocument xmlDoc (xml);
-            this->getXml(*xmlDoc.getDocumentElement());
-            return true;
-        }
-        
-        return false;
-    }
-    
-    void updateCC(int idx_para, int midiCC) {
-        for (int i =0; i < 255; i++) {
-            if (controllers[i] == idx_para){
-                controllers[i] = -1;
-            }
-        }
-        controllers[midiCC] = idx_para;
-    }
-    
-    void saveFile(File& xml){
-        XmlElement ele("Data");
-        this->setXml(ele);
-        ele.writeToFile(xml, String());
-    }
-    
-    void clean(){
-        reset();
-    }
-    
+
+	static const MidiMapEntry* defaults(int& count)
+	{
+		//Same assignments as the OB-Xd plugin, later entries win (CC 118).
+		//Voice count, allocation and oversampling (CC 15/21/18 there) are left
+		//out: they rebuild voices, so a generic controller must not reach them
+		//unless the user learns them on purpose
+		static const MidiMapEntry table[] = {
+			{71, VOLUME},
+			{33, TUNE},
+			{17, OCTAVE},
+			{118, BENDRANGE},
+			{34, BENDOSC2},
+			{35, LEGATOMODE},
+			{75, BENDLFORATE},
+			{76, VFLTENV},
+			{20, VAMPENV},
+			{23, PORTAMENTO},
+			{16, UNISON},
+			{24, UDET},
+			{43, OSC2_DET},
+			{19, LFOFREQ},
+			{44, LFOSINWAVE},
+			{45, LFOSQUAREWAVE},
+			{46, LFOSHWAVE},
+			{22, LFO1AMT},
+			{25, LFO2AMT},
+			{47, LFOOSC1},
+			{48, LFOOSC2},
+			{49, LFOFILTER},
+			{50, LFOPW1},
+			{51, LFOPW2},
+			{52, OSC2HS},
+			{53, XMOD},
+			{54, OSC1P},
+			{55, OSC2P},
+			{56, OSCQuantize},
+			{57, OSC1Saw},
+			{58, OSC1Pul},
+			{59, OSC2Saw},
+			{60, OSC2Pul},
+			{61, PW},
+			{62, BRIGHTNESS},
+			{63, ENVPITCH},
+			{77, OSC1MIX},
+			{78, OSC2MIX},
+			{102, NOISEMIX},
+			{103, FLT_KF},
+			{74, CUTOFF},
+			{42, RESONANCE},
+			{104, MULTIMODE},
+			{105, BANDPASS},
+			{106, FOURPOLE},
+			{107, ENVELOPE_AMT},
+			{73, LATK},
+			{36, LDEC},
+			{37, LSUS},
+			{72, LREL},
+			{38, FATK},
+			{39, FDEC},
+			{40, FSUS},
+			{41, FREL},
+			{108, ENVDER},
+			{109, FILTERDER},
+			{110, PORTADER},
+			{81, PAN1},
+			{82, PAN2},
+			{83, PAN3},
+			{84, PAN4},
+			{85, PAN5},
+			{86, PAN6},
+			{87, PAN7},
+			{88, PAN8},
+			{111, ECONOMY_MODE},
+			{113, PW_ENV},
+			{114, PW_ENV_BOTH},
+			{115, ENV_PITCH_BOTH},
+			{116, FENV_INVERT},
+			{117, PW_OSC2_OFS},
+			{118, LEVEL_DIF},
+			{119, SELF_OSC_PUSH},
+		};
+		count = sizeof(table)/sizeof(table[0]);
+		return table;
+	}
+
+	static const MidiMapTag* tags(int& count)
+	{
+		//Tag names as written by the OB-Xd plugin, used for persisting mappings
+		static const MidiMapTag table[] = {
+			{"VOLUME", VOLUME},
+			{"VOICE_COUNT", VOICE_COUNT},
+			{"TUNE", TUNE},
+			{"OCTAVE", OCTAVE},
+			{"BENDRANGE", BENDRANGE},
+			{"BENDOSC2", BENDOSC2},
+			{"LEGATOMODE", LEGATOMODE},
+			{"BENDLFORATE", BENDLFORATE},
+			{"VFLTENV", VFLTENV},
+			{"VAMPENV", VAMPENV},
+			{"ASPLAYEDALLOCATION", ASPLAYEDALLOCATION},
+			{"PORTAMENTO", PORTAMENTO},
+			{"UNISON", UNISON},
+			{"UDET", UDET},
+			{"OSC2_DET", OSC2_DET},
+			{"LFOFREQ", LFOFREQ},
+			{"LFOSINWAVE", LFOSINWAVE},
+			{"LFOSQUAREWAVE", LFOSQUAREWAVE},
+			{"LFOSHWAVE", LFOSHWAVE},
+			{"LFO1AMT", LFO1AMT},
+			{"LFO2AMT", LFO2AMT},
+			{"LFOOSC1", LFOOSC1},
+			{"LFOOSC2", LFOOSC2},
+			{"LFOFILTER", LFOFILTER},
+			{"LFOPW1", LFOPW1},
+			{"LFOPW2", LFOPW2},
+			{"OSC2HS", OSC2HS},
+			{"XMOD", XMOD},
+			{"OSC1P", OSC1P},
+			{"OSC2P", OSC2P},
+			{"OSCQuantize", OSCQuantize},
+			{"OSC1Saw", OSC1Saw},
+			{"OSC1Pul", OSC1Pul},
+			{"OSC2Saw", OSC2Saw},
+			{"OSC2Pul", OSC2Pul},
+			{"PW", PW},
+			{"BRIGHTNESS", BRIGHTNESS},
+			{"ENVPITCH", ENVPITCH},
+			{"OSC1MIX", OSC1MIX},
+			{"OSC2MIX", OSC2MIX},
+			{"NOISEMIX", NOISEMIX},
+			{"FLT_KF", FLT_KF},
+			{"CUTOFF", CUTOFF},
+			{"RESONANCE", RESONANCE},
+			{"MULTIMODE", MULTIMODE},
+			{"FILTER_WARM", FILTER_WARM},
+			{"BANDPASS", BANDPASS},
+			{"FOURPOLE", FOURPOLE},
+			{"ENVELOPE_AMT", ENVELOPE_AMT},
+			{"LATK", LATK},
+			{"LDEC", LDEC},
+			{"LSUS", LSUS},
+			{"LREL", LREL},
+			{"FATK", FATK},
+			{"FDEC", FDEC},
+			{"FSUS", FSUS},
+			{"FREL", FREL},
+			{"ENVDER", ENVDER},
+			{"FILTERDER", FILTERDER},
+			{"PORTADER", PORTADER},
+			{"PAN1", PAN1},
+			{"PAN2", PAN2},
+			{"PAN3", PAN3},
+			{"PAN4", PAN4},
+			{"PAN5", PAN5},
+			{"PAN6", PAN6},
+			{"PAN7", PAN7},
+			{"PAN8", PAN8},
+			{"ECONOMY_MODE", ECONOMY_MODE},
+			{"LFO_SYNC", LFO_SYNC},
+			{"PW_ENV", PW_ENV},
+			{"PW_ENV_BOTH", PW_ENV_BOTH},
+			{"ENV_PITCH_BOTH", ENV_PITCH_BOTH},
+			{"FENV_INVERT", FENV_INVERT},
+			{"PW_OSC2_OFS", PW_OSC2_OFS},
+			{"LEVEL_DIF", LEVEL_DIF},
+			{"SELF_OSC_PUSH", SELF_OSC_PUSH},
+		};
+		count = sizeof(table)/sizeof(table[0]);
+		return table;
+	}
+
+	void set_default(){
+		int count;
+		const MidiMapEntry* table = defaults(count);
+		for(int i = 0 ; i < count;i++){
+			controllers[table[i].cc] = controllers_default[table[i].cc] = table[i].param;
+		}
+	}
+
+	//Mod wheel, sustain and the channel mode messages (120-127) are handled
+	//by the synth itself and can never be learned or mapped
+	static inline bool reserved(int cc)
+	{
+		return cc == 1 || cc == 64 || cc >= 120;
+	}
+
+	//Param mapped to a CC, -1 when unmapped
+	inline int lookup(int cc) const
+	{
+		return controllers[cc & (CC_COUNT-1)];
+	}
+
+	const char* getTag(int paraId) const{
+		int count;
+		const MidiMapTag* table = tags(count);
+		for(int i = 0 ; i < count;i++){
+			if(table[i].param == paraId)
+				return table[i].tag;
+		}
+		return "undefine";
+	}
+
+	int getParaId(const char* tagName, int len) const{
+		int count;
+		const MidiMapTag* table = tags(count);
+		for(int i = 0 ; i < count;i++){
+			if(strncmp(table[i].tag, tagName, len) == 0 && table[i].tag[len] == '\0')
+				return table[i].param;
+		}
+		return -1;
+	}
+
+	//Learn: a param lives on at most one CC
+	void updateCC(int idx_para, int midiCC) {
+		if (reserved(midiCC & (CC_COUNT-1)))
+			return;
+		for (int i =0; i < CC_COUNT; i++) {
+			if (controllers[i] == idx_para){
+				controllers[i] = -1;
+			}
+		}
+		controllers[midiCC & (CC_COUNT-1)] = idx_para;
+	}
+
+	void restoreDefaults(){
+		for(int i = 0 ; i < CC_COUNT;i++)
+			controllers[i] = controllers_default[i];
+	}
+
 };
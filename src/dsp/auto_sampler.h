@@ -0,0 +1,178 @@
+/*
+ * auto_sampler.h - Multisample cache and playback for the auto-sampled fallback
+ *
+ * A cache holds one rendering of the current patch per root note and
+ * velocity layer, made off the audio thread (see v2_autosample_build in
+ * obxd_plugin.cpp). Playback is a linear-interpolating sampler: the
+ * nearest root is resampled to the played pitch, the two velocity layers
+ * around the played velocity are crossfaded, and the looped tail holds
+ * the sustain until note-off starts an exponential release.
+ *
+ * Samples are int16 at AS_SCALE per unit of engine output, so engine
+ * peaks up to +-2.0 survive without clipping.
+ */
+
+#ifndef AUTO_SAMPLER_H
+#define AUTO_SAMPLER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define AS_ROOT_LOW 28          /* Lowest sampled root (E1) */
+#define AS_ROOT_HIGH 100        /* Highest sampled root (E7) */
+#define AS_ROOT_STEP 4          /* Semitones between roots, notes shift at most +-2 */
+#define AS_ROOTS ((AS_ROOT_HIGH - AS_ROOT_LOW) / AS_ROOT_STEP + 1)
+#define AS_LAYERS 3
+#define AS_VOICES 16
+#define AS_SCALE 16384.0f
+#define AS_LOOP_SECONDS 0.25f   /* Target loop length, rounded to whole periods */
+#define AS_LOOP_XFADE 1024      /* Frames crossfaded into the loop end */
+#define AS_SILENCE 0.0001f      /* Voice gain at which playback stops */
+#define AS_NO_VOICE 0xFF
+
+/* Velocities the layers are rendered at; below the first, layer 0 is scaled */
+static const float g_as_layer_vel[AS_LAYERS] = {0.2f, 0.6f, 1.0f};
+
+typedef struct {
+    uint32_t offset[AS_LAYERS]; /* First frame of each layer in AutoSampleCache.frames */
+    uint32_t length;            /* Frames per layer */
+    uint32_t loop_start;        /* Loop is [loop_start, length), == length for one-shot */
+} AutoSampleZone;
+
+struct AutoSampleCache {
+    int refcount;               /* Guarded by the shared cache list lock */
+    struct AutoSampleCache *next_shared;
+    uint64_t patch_hash;        /* Params and tempo the samples were rendered from */
+    float release_coef;         /* Per-frame gain after note-off, from the amp release */
+    uint32_t total_frames;
+    AutoSampleZone zones[AS_ROOTS];
+    int16_t frames[1];          /* Interleaved L/R, total_frames long */
+};
+
+typedef struct {
+    uint8_t active;
+    uint8_t note;
+    uint8_t held;               /* Key (or sustain pedal) still down */
+    uint8_t sustained;          /* Key released while the pedal was down */
+    const AutoSampleZone *zone;
+    float velocity;
+    double pos;
+    float inc;
+    float layer_gain[AS_LAYERS];
+    float gain;                 /* Release envelope, 1.0 while held */
+    float release;              /* Per-frame multiplier, 1.0 while held */
+    uint32_t age;
+} AutoSampleVoice;
+
+/* Zone index for a note, or -1 when it is outside the sampled range */
+static inline int auto_sample_zone(int note) {
+    int idx = (note - AS_ROOT_LOW + AS_ROOT_STEP / 2) / AS_ROOT_STEP;
+    if (note < AS_ROOT_LOW - AS_ROOT_STEP / 2 || idx >= AS_ROOTS) return -1;
+    return idx;
+}
+
+static inline int auto_sample_root(int zone) {
+    return AS_ROOT_LOW + zone * AS_ROOT_STEP;
+}
+
+/* Split velocity across the two layers around it */
+static inline void auto_sample_layer_gains(float velocity, float *gains) {
+    for (int l = 0; l < AS_LAYERS; l++) gains[l] = 0.0f;
+    if (velocity <= g_as_layer_vel[0]) {
+        gains[0] = velocity / g_as_layer_vel[0];
+        return;
+    }
+    for (int l = 1; l < AS_LAYERS; l++) {
+        if (velocity <= g_as_layer_vel[l] || l == AS_LAYERS - 1) {
+            float t = (velocity - g_as_layer_vel[l - 1]) / (g_as_layer_vel[l] - g_as_layer_vel[l - 1]);
+            if (t > 1.0f) t = 1.0f;
+            gains[l - 1] = 1.0f - t;
+            gains[l] = t;
+            return;
+        }
+    }
+}
+
+/*
+ * Turn the last loop_len frames of a rendered layer into a seamless loop:
+ * the frames before the loop end are faded toward the frames before the
+ * loop start, so jumping from the end back to loop_start is continuous.
+ */
+static inline void auto_sample_make_loop(int16_t *layer, uint32_t length, uint32_t loop_start) {
+    uint32_t loop_len = length - loop_start;
+    uint32_t xf = AS_LOOP_XFADE;
+    if (xf > loop_len / 2) xf = loop_len / 2;
+    if (xf > loop_start) xf = loop_start;
+    for (uint32_t i = 0; i < xf; i++) {
+        float t = (i + 0.5f) / xf;
+        uint32_t dst = length - xf + i;
+        uint32_t src = loop_start - xf + i;
+        for (int c = 0; c < 2; c++) {
+            float v = layer[dst * 2 + c] * (1.0f - t) + layer[src * 2 + c] * t;
+            layer[dst * 2 + c] = (int16_t)lrintf(v);
+        }
+    }
+}
+
+/*
+ * Mix every active voice into a float accumulator (interleaved L/R,
+ * engine units). Returns the number of voices still playing.
+ */
+static inline int auto_sample_render(const AutoSampleCache *cache, AutoSampleVoice *voices,
+                                     float *mix, int frames) {
+    int playing = 0;
+    for (int v = 0; v < AS_VOICES; v++) {
+        AutoSampleVoice *vo = &voices[v];
+        if (!vo->active) continue;
+
+        const AutoSampleZone *z = vo->zone;
+        const int16_t *layer[AS_LAYERS];
+        float lg[AS_LAYERS];
+        int layers = 0;
+        for (int l = 0; l < AS_LAYERS; l++) {
+            if (vo->layer_gain[l] <= 0.0f) continue;
+            layer[layers] = cache->frames + (size_t)z->offset[l] * 2;
+            lg[layers] = vo->layer_gain[l] * (1.0f / AS_SCALE);
+            layers++;
+        }
+        uint32_t loop_len = z->length - z->loop_start;
+
+        double pos = vo->pos;
+        float gain = vo->gain;
+        for (int i = 0; i < frames; i++) {
+            uint32_t i0 = (uint32_t)pos;
+            uint32_t i1 = i0 + 1;
+            if (i1 >= z->length) i1 = loop_len ? z->loop_start : i0;
+            float frac = (float)(pos - i0);
+
+            float l = 0.0f, r = 0.0f;
+            for (int k = 0; k < layers; k++) {
+                const int16_t *s = layer[k];
+                float a = s[i0 * 2] + (s[i1 * 2] - s[i0 * 2]) * frac;
+                float b = s[i0 * 2 + 1] + (s[i1 * 2 + 1] - s[i0 * 2 + 1]) * frac;
+                l += a * lg[k];
+                r += b * lg[k];
+            }
+            mix[i * 2] += l * gain;
+            mix[i * 2 + 1] += r * gain;
+
+            gain *= vo->release;
+            pos += vo->inc;
+            if (pos >= z->length) {
+                if (!loop_len) {
+                    gain = 0.0f;
+                    break;
+                }
+                pos -= loop_len;
+            }
+        }
+        vo->pos = pos;
+        vo->gain = gain;
+        if (gain < AS_SILENCE) vo->active = 0;
+        else playing++;
+    }
+    return playing;
+}
+
+#endif /* AUTO_SAMPLER_H */
@@ -0,0 +1,86 @@
+/*
+ * obxd_ext_api.h - Extended plugin API for OB-Xd
+ *
+ * Optional entry points beyond plugin_api_v2. Hosts that know about them
+ * resolve OBXD_EXT_API_SYMBOL with dlsym() on dsp.so; hosts that don't keep
+ * working through the plain v2 table.
+ *
+ * The table only ever grows at the end. Check struct_size before calling an
+ * entry that was added after the version you were built against.
+ */
+
+#ifndef OBXD_EXT_API_H
+#define OBXD_EXT_API_H
+
+#include <stdint.h>
+#include "obxd_telemetry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBXD_EXT_API_VERSION 1
+
+/* One timestamped MIDI message for on_midi_batch */
+typedef struct obxd_midi_event {
+    uint32_t frame;         /* Sample offset into the next render_block */
+    uint16_t len;           /* Message length in bytes */
+    uint8_t source;         /* MOVE_MIDI_SOURCE_* */
+    uint8_t data[3];        /* Channel message bytes, when len <= 3 */
+    const uint8_t *sysex;   /* Full message, when len > 3 (SysEx) */
+} obxd_midi_event_t;
+
+typedef struct obxd_ext_api {
+    uint32_t api_version;
+    uint32_t struct_size;
+
+    /*
+     * Create a new instance from an existing one without a cold start.
+     * Engine state and params are copied, bank presets are shared by
+     * reference. Work still queued on the source (params_batch writes not
+     * yet applied, on_midi_batch events for later frames) is not copied,
+     * nor are its stats and voice trace. Call from the control thread, the
+     * one that calls set_param. If the source is rendering, its next
+     * render_block/on_midi call takes the copy at its start, so clone
+     * returns within about a block. Otherwise the copy is taken on the
+     * calling thread after ~10 ms; an audio call that arrives during that
+     * copy is skipped (silence, MIDI dropped). Returns NULL on failure.
+     * Destroy with destroy_instance.
+     */
+    void* (*clone_instance)(void *instance);
+
+    /*
+     * Zero-copy get_param for immutable metadata ("chain_params",
+     * "ui_hierarchy"). Points *out at plugin-owned storage that stays valid
+     * until dsp.so is unloaded. Returns the length, or -1 for other keys.
+     */
+    int (*get_param_blob)(void *instance, const char *key, const char **out);
+
+    /*
+     * Deliver a block's worth of MIDI in one call, in frame order. Messages
+     * are applied sample-accurately during the next render_block, in order.
+     * SysEx (e.g. a patch_sysex.h bulk dump) is copied, so the sysex buffer
+     * need not outlive the call, and applies at its frame like the rest. If
+     * more than 256 messages or 4 KB of SysEx are queued, the queue is
+     * played at once in order ("midi_overflows" in get_param("stats")).
+     * Call from the thread that calls render_block.
+     */
+    void (*on_midi_batch)(void *instance, const obxd_midi_event_t *events, int count);
+
+    /*
+     * Telemetry and param mirror of an instance, updated once per block.
+     * The region is opened by the first call (or get_param("telemetry_shm")),
+     * so make it before the blocks you want to see. Read it with
+     * obxd_telemetry_read(); valid until destroy_instance.
+     */
+    const obxd_telemetry_t* (*get_telemetry)(void *instance);
+} obxd_ext_api_t;
+
+typedef const obxd_ext_api_t* (*obxd_ext_api_fn)(void);
+#define OBXD_EXT_API_SYMBOL "move_plugin_ext_obxd"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBXD_EXT_API_H */
@@ -15,11 +15,22 @@
 #include <string.h>
 #include <math.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#include <new>
 
 /* Include plugin API */
 extern "C" {
 /* Copy plugin_api_v1.h definitions inline to avoid path issues */
 #include <stdint.h>
+#include <stddef.h>
 
 #define MOVE_PLUGIN_API_VERSION 1
 #define MOVE_SAMPLE_RATE 44100
@@ -57,18 +68,39 @@ typedef plugin_api_v2_t* (*move_plugin_init_v2_fn)(const host_api_v1_t *host);
 #define MOVE_PLUGIN_INIT_V2_SYMBOL "move_plugin_init_v2"
 }
 
+/* OB-Xd extended API (clone, ...) */
+#include "obxd_ext_api.h"
+#include "obxd_telemetry.h"
+
 /* OB-Xd Engine */
 #include "Engine/SynthEngine.h"
+#include "Engine/midiMap.h"
 
 /* Constants */
 #define MAX_VOICES 6  /* Balanced for ARM CPU */
 #define MAX_PRESETS 128
 #define MAX_PARAMS 100
 #define MAX_BANKS 32  /* Maximum number of .fxb bank files */
+#define COST_HEAVY_REL 1.5f  /* Cost index: rel at or above this is "heavy" */
+#define COST_LIGHT_REL 0.75f /* ... at or below this is "light" */
+#define PARAM_BATCH_SLOTS 4  /* Pending params_batch writes awaiting a block boundary */
+#define PARAM_BATCH_WAIT_US 10000  /* Render idle this long is not draining params_batch */
+#define MAX_PENDING_MIDI 256  /* Timestamped on_midi_batch events awaiting render */
+#define MAX_PENDING_SYSEX 4096  /* Bytes of SysEx payload queued with them */
+#define STATS_VOICE_BINS 33   /* Active voice histogram, 0..32 (engine maximum) */
 
 /* Host API reference */
 static const host_api_v1_t *g_host = NULL;
 
+/* Per-sample engine path plus output conversion, compiled once per target */
+typedef void (*render_frames_fn)(SynthEngine *synth, float gain, int16_t *out_interleaved_lr, int frames);
+
+struct KernelVariant {
+    const char *name;
+    render_frames_fn render;
+    int (*supported)(void);     /* CPU feature check */
+};
+
 /* Preset storage structure */
 struct Preset {
     char name[32];
@@ -76,6 +108,37 @@ struct Preset {
     int param_count;
 };
 
+/* Parsed presets of one bank - immutable once loaded, shared between clones */
+struct BankData {
+    int refcount;
+    int preset_count;
+    Preset presets[MAX_PRESETS];
+};
+
+/* One resolved param write, ParamsEnum index + clamped value */
+struct ParamChange {
+    int index;
+    float value;
+};
+
+/* params_batch payload, applied as a whole at the next block boundary */
+struct ParamBatch {
+    uint32_t seq;               /* batch_seq when queued, see v2_supersede_batches */
+    int count;
+    ParamChange changes[PARAM_COUNT];
+};
+
+/* Always-on render statistics, written by render_block only */
+struct RenderStats {
+    uint64_t blocks;
+    uint64_t frames;
+    uint64_t over_budget;       /* Blocks that took longer than the budget */
+    uint64_t midi_overflows;    /* on_midi_batch found the queue full and played it early */
+    double total_us;
+    float max_block_us;
+    uint32_t voice_hist[STATS_VOICE_BINS];  /* Blocks by active voice count */
+};
+
 /* Bank metadata */
 struct BankInfo {
     char name[64];       /* Display name (filename without .fxb) */
@@ -83,6 +146,25 @@ struct BankInfo {
     int preset_count;    /* Number of presets in this bank */
 };
 
+/* Measured render cost of one preset, from presets/cost_index.tsv */
+struct PresetCost {
+    char bank[64];       /* BankInfo name */
+    char name[32];       /* Preset name at survey time, stale entries are ignored */
+    int preset;
+    float avg_us;        /* Average cost per sounding voice, us per block */
+    float peak_us;       /* Worst block, per sounding voice */
+    float idle_us;       /* Block cost with no notes held */
+    float block_us;      /* Mean block cost over the survey pattern */
+    float rel;           /* block_us relative to the survey median */
+};
+
+/* Parsed cost index - immutable once loaded, shared between clones */
+struct CostIndex {
+    int refcount;
+    int count;
+    PresetCost entries[1];
+};
+
 /* Parameter names for UI display */
 static const char* g_param_names[3][8] = {
     /* Bank 0: Filter */
@@ -93,8 +175,13 @@ static const char* g_param_names[3][8] = {
     {"lfo_rate", "lfo_wave", "lfo_cutoff", "lfo_pitch", "lfo_pw", "vibrato", "unison", "portamento"}
 };
 
+/* Oversampling ladder rungs, indexed by SynthEngine::OVERSAMPLE_* - also the "oversampling" options */
+static const char* g_oversampling_names[SynthEngine::OVERSAMPLE_RUNGS + 1] = {"1x", "2x-fast", "2x", "4x", NULL};
+
 /* Parameter definitions for shadow UI - maps names to engine indices from ParamsEnum.h */
 #include "param_helper.h"
+#include "patch_sysex.h"
+#include "auto_sampler.h"
 #include "Engine/ParamsEnum.h"
 
 static const param_def_t g_shadow_params[] = {
@@ -108,6 +195,7 @@ static const param_def_t g_shadow_params[] = {
     {"voice_count",   "Voices",        PARAM_TYPE_INT,   VOICE_COUNT,   0.0f, 1.0f},  /* 1-8 voices */
     {"legato",        "Legato",        PARAM_TYPE_INT,   LEGATOMODE,    0.0f, 1.0f},  /* 4 modes: 0-3 */
     {"unison",        "Unison",        PARAM_TYPE_INT,   UNISON,        0.0f, 1.0f},  /* toggle */
+    {"oversampling",  "Oversampling",  PARAM_TYPE_ENUM,  FILTER_WARM,   0.0f, 1.0f, g_oversampling_names},  /* rung / 3 */
 
     /* Oscillator 1 - continuous */
     {"osc1_pitch",    "Osc1 Pitch",    PARAM_TYPE_FLOAT, OSC1P,         0.0f, 1.0f},
@@ -186,17 +274,206 @@ static const param_def_t g_shadow_params[] = {
     {"bend_range",    "Bend Range",    PARAM_TYPE_INT,   BENDRANGE,     0.0f, 1.0f},  /* 2 or 12 semitones */
 };
 
+/* UI hierarchy for shadow parameter editor - served as-is, never rebuilt */
+static const char g_ui_hierarchy_json[] = "{"
+    "\"modes\":null,"
+    "\"levels\":{"
+        "\"root\":{"
+            "\"list_param\":\"preset\","
+            "\"count_param\":\"preset_count\","
+            "\"name_param\":\"preset_name\","
+            "\"children\":null,"
+            "\"knobs\":[\"cutoff\",\"resonance\",\"filter_env\",\"attack\",\"decay\",\"sustain\",\"release\",\"octave_transpose\"],"
+            "\"params\":["
+                "{\"level\":\"banks\",\"label\":\"Banks\"},"
+                "{\"level\":\"global\",\"label\":\"Global\"},"
+                "{\"level\":\"osc1\",\"label\":\"Oscillator 1\"},"
+                "{\"level\":\"osc2\",\"label\":\"Oscillator 2\"},"
+                "{\"level\":\"osc_common\",\"label\":\"Osc Common\"},"
+                "{\"level\":\"filter\",\"label\":\"Filter\"},"
+                "{\"level\":\"filt_env\",\"label\":\"Filter Env\"},"
+                "{\"level\":\"amp_env\",\"label\":\"Amp Env\"},"
+                "{\"level\":\"lfo\",\"label\":\"LFO\"},"
+                "{\"level\":\"lfo_dest\",\"label\":\"LFO Dest\"},"
+                "{\"level\":\"pitch_mod\",\"label\":\"Pitch Mod\"}"
+            "]"
+        "},"
+        "\"global\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"volume\",\"tune\",\"octave\",\"portamento\",\"unison\",\"unison_det\",\"legato\",\"octave_transpose\"],"
+            "\"params\":[\"volume\",\"tune\",\"octave\",\"portamento\",\"unison\",\"unison_det\",\"legato\",\"octave_transpose\",\"oversampling\"]"
+        "},"
+        "\"osc1\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"osc1_saw\",\"osc1_pulse\",\"osc1_pitch\",\"osc1_mix\"],"
+            "\"params\":[\"osc1_saw\",\"osc1_pulse\",\"osc1_pitch\",\"osc1_mix\"]"
+        "},"
+        "\"osc2\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"osc2_saw\",\"osc2_pulse\",\"osc2_pitch\",\"osc2_mix\",\"osc2_detune\",\"osc2_sync\"],"
+            "\"params\":[\"osc2_saw\",\"osc2_pulse\",\"osc2_pitch\",\"osc2_mix\",\"osc2_detune\",\"osc2_sync\"]"
+        "},"
+        "\"osc_common\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"pw\",\"pw_env\",\"noise\",\"xmod\",\"brightness\"],"
+            "\"params\":[\"pw\",\"pw_env\",\"pw_env_both\",\"pw_ofs\",\"noise\",\"xmod\",\"brightness\"]"
+        "},"
+        "\"filter\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"cutoff\",\"resonance\",\"filter_env\",\"key_follow\",\"multimode\",\"fourpole\"],"
+            "\"params\":[\"cutoff\",\"resonance\",\"filter_env\",\"key_follow\",\"multimode\",\"bandpass\",\"fourpole\",\"self_osc\",\"fenv_inv\"]"
+        "},"
+        "\"filt_env\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"f_attack\",\"f_decay\",\"f_sustain\",\"f_release\",\"vel_filter\"],"
+            "\"params\":[\"f_attack\",\"f_decay\",\"f_sustain\",\"f_release\",\"vel_filter\"]"
+        "},"
+        "\"amp_env\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"attack\",\"decay\",\"sustain\",\"release\",\"vel_amp\"],"
+            "\"params\":[\"attack\",\"decay\",\"sustain\",\"release\",\"vel_amp\"]"
+        "},"
+        "\"lfo\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"lfo_rate\",\"lfo_sin\",\"lfo_square\",\"lfo_sh\",\"lfo_amt1\",\"lfo_amt2\"],"
+            "\"params\":[\"lfo_rate\",\"lfo_sin\",\"lfo_square\",\"lfo_sh\",\"lfo_sync\",\"lfo_amt1\",\"lfo_amt2\"]"
+        "},"
+        "\"lfo_dest\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"lfo_osc1\",\"lfo_osc2\",\"lfo_filter\",\"lfo_pw1\",\"lfo_pw2\"],"
+            "\"params\":[\"lfo_osc1\",\"lfo_osc2\",\"lfo_filter\",\"lfo_pw1\",\"lfo_pw2\"]"
+        "},"
+        "\"pitch_mod\":{"
+            "\"children\":null,"
+            "\"knobs\":[\"env_pitch\",\"bend_range\",\"vibrato\"],"
+            "\"params\":[\"env_pitch\",\"env_pitch_both\",\"bend_range\",\"vibrato\"]"
+        "},"
+        "\"banks\":{"
+            "\"name\":\"Banks\","
+            "\"label\":\"Select Bank\","
+            "\"items_param\":\"fxb_bank_list\","
+            "\"select_param\":\"bank_index\","
+            "\"navigate_to\":\"root\""
+        "}"
+    "}"
+"}";
+
+/* Chain params metadata - generated once from g_shadow_params at load time */
+static char g_chain_params_json[8192];
+static int g_chain_params_len = 0;
+
+static void build_chain_params_json(void) {
+    if (g_chain_params_len > 0) return;
+
+    char *buf = g_chain_params_json;
+    int buf_len = sizeof(g_chain_params_json);
+
+    /* Build JSON with preset/octave_transpose first, then all shadow params */
+    int offset = 0;
+    offset += snprintf(buf + offset, buf_len - offset,
+        "[{\"key\":\"preset\",\"name\":\"Preset\",\"type\":\"int\",\"min\":0,\"max\":9999},"
+        "{\"key\":\"octave_transpose\",\"name\":\"Octave\",\"type\":\"int\",\"min\":-3,\"max\":3}");
+
+    /* Add all shadow params */
+    char type[256];
+    for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params) && offset < buf_len - 100; i++) {
+        param_helper_type_json(&g_shadow_params[i], type, sizeof(type));
+        offset += snprintf(buf + offset, buf_len - offset,
+            ",{\"key\":\"%s\",\"name\":\"%s\",%s,\"min\":%g,\"max\":%g}",
+            g_shadow_params[i].key,
+            g_shadow_params[i].name[0] ? g_shadow_params[i].name : g_shadow_params[i].key,
+            type,
+            g_shadow_params[i].min_val,
+            g_shadow_params[i].max_val);
+    }
+    offset += snprintf(buf + offset, buf_len - offset, "]");
+    g_chain_params_len = offset;
+}
+
 /* =====================================================================
  * Shared utility functions
  * ===================================================================== */
 
+/*
+ * Logging: plugin_log only copies the message into a fixed-size record of a
+ * lock-free ring, so it is safe from render/set_param paths. Records reach
+ * g_host->log when plugin_log_drain runs from a non-RT entry point.
+ *
+ * Each slot's turn is the ring position its current lap starts at (free)
+ * or that plus one (filled), so the zero-initialized ring is ready to use
+ * and the counters wrap cleanly.
+ */
+#define LOG_RING_SLOTS 64
+#define LOG_RECORD_LEN 192
+#define LOG_LAP(pos) ((pos) & ~(uint32_t)(LOG_RING_SLOTS - 1))
+
+struct LogRecord {
+    uint32_t turn;
+    char msg[LOG_RECORD_LEN];
+};
+
+static LogRecord g_log_ring[LOG_RING_SLOTS];
+static uint32_t g_log_head = 0;     /* Next slot to fill, shared by producers */
+static uint32_t g_log_tail = 0;     /* Next slot to drain, owned by the drainer */
+static uint32_t g_log_dropped = 0;  /* Records lost to a full ring */
+static int g_log_draining = 0;
+
 /* Logging helper */
 static void plugin_log(const char *msg) {
-    if (g_host && g_host->log) {
-        char buf[256];
-        snprintf(buf, sizeof(buf), "[obxd] %s", msg);
+    uint32_t pos = __atomic_load_n(&g_log_head, __ATOMIC_RELAXED);
+    LogRecord *rec;
+    for (;;) {
+        rec = &g_log_ring[pos % LOG_RING_SLOTS];
+        uint32_t turn = __atomic_load_n(&rec->turn, __ATOMIC_ACQUIRE);
+        uint32_t free_turn = LOG_LAP(pos);
+        if (turn == free_turn) {
+            if (__atomic_compare_exchange_n(&g_log_head, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if ((int32_t)(turn - free_turn) < 0) {
+            /* Drainer is a full lap behind */
+            __atomic_add_fetch(&g_log_dropped, 1, __ATOMIC_RELAXED);
+            return;
+        } else {
+            pos = __atomic_load_n(&g_log_head, __ATOMIC_RELAXED);
+        }
+    }
+
+    strncpy(rec->msg, msg, LOG_RECORD_LEN - 1);
+    rec->msg[LOG_RECORD_LEN - 1] = '\0';
+    __atomic_store_n(&rec->turn, LOG_LAP(pos) + 1, __ATOMIC_RELEASE);
+}
+
+/* Forward queued log records to the host - call only from non-RT paths */
+static void plugin_log_drain(void) {
+    if (__atomic_load_n(&g_log_tail, __ATOMIC_RELAXED) == __atomic_load_n(&g_log_head, __ATOMIC_RELAXED) &&
+        __atomic_load_n(&g_log_dropped, __ATOMIC_RELAXED) == 0) {
+        return;
+    }
+    if (__atomic_exchange_n(&g_log_draining, 1, __ATOMIC_ACQUIRE)) return;
+
+    char buf[256];
+    for (;;) {
+        uint32_t pos = g_log_tail;
+        LogRecord *rec = &g_log_ring[pos % LOG_RING_SLOTS];
+        if (__atomic_load_n(&rec->turn, __ATOMIC_ACQUIRE) != LOG_LAP(pos) + 1) break;
+
+        if (g_host && g_host->log) {
+            snprintf(buf, sizeof(buf), "[obxd] %s", rec->msg);
+            g_host->log(buf);
+        }
+        __atomic_store_n(&rec->turn, LOG_LAP(pos) + LOG_RING_SLOTS, __ATOMIC_RELEASE);
+        __atomic_store_n(&g_log_tail, pos + 1, __ATOMIC_RELAXED);
+    }
+
+    uint32_t dropped = __atomic_exchange_n(&g_log_dropped, 0, __ATOMIC_RELAXED);
+    if (dropped && g_host && g_host->log) {
+        snprintf(buf, sizeof(buf), "[obxd] %u log messages dropped", dropped);
         g_host->log(buf);
     }
+
+    __atomic_store_n(&g_log_draining, 0, __ATOMIC_RELEASE);
 }
 
 /* Parse float from attribute value */
@@ -222,28 +499,368 @@ static const char* find_attr(const char *xml, const char *attr_name, char *buf,
     return end + 1;
 }
 
+/* =====================================================================
+ * Render kernel variants
+ *
+ * The sample loop below is compiled once per target. flatten inlines the
+ * whole engine path (oscillators, filters, envelopes, decimator) into each
+ * copy, so the target flags reach every kernel and not just the loop.
+ * move_plugin_init_v2 picks the first variant the CPU supports; the
+ * OBXD_KERNELS environment variable or set_param("kernel_variant") forces
+ * one by name.
+ * ===================================================================== */
+
+static inline __attribute__((always_inline))
+void v2_render_frames_body(SynthEngine *synth, float gain, int16_t *out_interleaved_lr, int frames) {
+    for (int i = 0; i < frames; i++) {
+        float left = 0.0f, right = 0.0f;
+        synth->processSample(&left, &right);
+
+        left *= gain;
+        right *= gain;
+
+        int32_t l = (int32_t)(left * 32767.0f);
+        int32_t r = (int32_t)(right * 32767.0f);
+
+        if (l > 32767) l = 32767;
+        if (l < -32768) l = -32768;
+        if (r > 32767) r = 32767;
+        if (r < -32768) r = -32768;
+
+        out_interleaved_lr[i * 2] = (int16_t)l;
+        out_interleaved_lr[i * 2 + 1] = (int16_t)r;
+    }
+}
+
+/* Baseline: armv8-a on Move, x86-64 (SSE2) on test hosts */
+static __attribute__((flatten))
+void v2_render_frames_generic(SynthEngine *synth, float gain, int16_t *out_interleaved_lr, int frames) {
+    v2_render_frames_body(synth, gain, out_interleaved_lr, frames);
+}
+
+static int v2_cpu_generic(void) {
+    return 1;
+}
+
+#if defined(__x86_64__)
+static __attribute__((target("avx2,fma"), flatten))
+void v2_render_frames_avx2(SynthEngine *synth, float gain, int16_t *out_interleaved_lr, int frames) {
+    v2_render_frames_body(synth, gain, out_interleaved_lr, frames);
+}
+
+static int v2_cpu_avx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+static __attribute__((target("arch=armv8.2-a+fp16+dotprod"), flatten))
+void v2_render_frames_armv82(SynthEngine *synth, float gain, int16_t *out_interleaved_lr, int frames) {
+    v2_render_frames_body(synth, gain, out_interleaved_lr, frames);
+}
+
+static int v2_cpu_armv82(void) {
+    unsigned long hw = getauxval(AT_HWCAP);
+    return (hw & HWCAP_FPHP) && (hw & HWCAP_ASIMDHP) && (hw & HWCAP_ASIMDDP);
+}
+#endif
+
+/* Best first; the last entry always runs */
+static const KernelVariant g_kernel_variants[] = {
+#if defined(__x86_64__)
+    {"avx2",    v2_render_frames_avx2,    v2_cpu_avx2},
+#endif
+#if defined(__aarch64__) && defined(__linux__)
+    {"armv8.2", v2_render_frames_armv82,  v2_cpu_armv82},
+#endif
+    {"generic", v2_render_frames_generic, v2_cpu_generic},
+};
+#define KERNEL_VARIANT_COUNT ((int)(sizeof(g_kernel_variants) / sizeof(g_kernel_variants[0])))
+
+static const KernelVariant *g_kernels = &g_kernel_variants[KERNEL_VARIANT_COUNT - 1];
+
+/* v2 helper: Supported variant by name, "auto" = the one picked at load; NULL if unknown */
+static const KernelVariant* v2_find_kernels(const char *name) {
+    if (strcmp(name, "auto") == 0) return g_kernels;
+    for (int i = 0; i < KERNEL_VARIANT_COUNT; i++) {
+        if (strcmp(g_kernel_variants[i].name, name) == 0) {
+            return g_kernel_variants[i].supported() ? &g_kernel_variants[i] : NULL;
+        }
+    }
+    return NULL;
+}
+
+/* Called from move_plugin_init_v2 */
+static void v2_select_kernels(void) {
+    for (int i = 0; i < KERNEL_VARIANT_COUNT; i++) {
+        if (g_kernel_variants[i].supported()) {
+            g_kernels = &g_kernel_variants[i];
+            break;
+        }
+    }
+
+    const char *forced = getenv("OBXD_KERNELS");
+    if (forced && forced[0]) {
+        const KernelVariant *k = v2_find_kernels(forced);
+        if (k) g_kernels = k;
+        else plugin_log("OBXD_KERNELS names an unknown or unsupported variant, ignored");
+    }
+
+    char msg[64];
+    snprintf(msg, sizeof(msg), "Render kernels: %s", g_kernels->name);
+    plugin_log(msg);
+}
+
 /* =====================================================================
  * Plugin API v2 - Instance-based API
  * ===================================================================== */
 
+/*
+ * Instance arena: one 64-byte aligned allocation per instance, laid out
+ * as [obxd_instance_t][SynthEngine][obxd_instance_cold_t], each part
+ * starting on a cache line. The instance struct holds only what the
+ * render and MIDI paths read on every block or event, so the engine and
+ * its voices follow within a few cache lines. The queues (only touched
+ * when something is queued), the CC map, names, bank metadata and the
+ * snapshot cache go last. Bank presets are shared between clones and
+ * stay outside (BankData).
+ */
+#define ARENA_ALIGN 64
+
 typedef struct {
-    char module_dir[256];
-    SynthEngine *synth;
+    /* on_midi_batch messages, dispatched at their frame during render */
+    obxd_midi_event_t pending_midi[MAX_PENDING_MIDI];
+    int pending_sysex_len;      /* Bytes used in pending_sysex, freed when the queue empties */
+    uint8_t pending_sysex[MAX_PENDING_SYSEX];  /* Copies of queued SysEx, pending_midi[].sysex points here */
+    /* params_batch ring: set_param produces, render_block consumes */
+    ParamBatch batches[PARAM_BATCH_SLOTS];
+    uint32_t batch_seq;         /* Last batch queued, control thread only */
+    uint32_t batch_dropped;     /* Batches refused: ring full and the instance could not be claimed */
+    uint32_t batch_superseded;  /* Queued batches up to this seq are void (preset/state load) */
+    uint32_t param_stamp[PARAM_COUNT];  /* Queued writes up to this seq are void for the param */
+    /* External controller CC -> ParamsEnum map, double-buffered: render reads midi_maps[midi_map_live] */
+    MidiMap midi_maps[2];
+    /* Presets and banks */
     int current_preset;
     int preset_count;
     int param_bank;
-    int octave_transpose;
-    float tempo_bpm;
+    BankData *bank_data;        /* Presets of current_bank, shared by reference */
+    int bank_count;
+    int current_bank;
+    CostIndex *cost_index;      /* Preset CPU cost survey, NULL when no index was found */
+    /* get_param("trace") read position in the engine's voice trace */
+    uint32_t trace_cursor;
+    uint32_t trace_lost;
+    char module_dir[256];
     char preset_name[64];
-    float params[PARAM_COUNT];  /* Engine param storage - indexed by ParamsEnum */
-    Preset presets[MAX_PRESETS];
-    float output_gain;
     /* Multi-bank support */
     BankInfo banks[MAX_BANKS];
-    int bank_count;
-    int current_bank;
+    char telemetry_shm[OBXD_TELEMETRY_SHM_NAME_MAX];  /* Empty = process-local */
+    /* Change tracking for params_snapshot polling */
+    uint32_t snapshot_version;  /* param_version the cached snapshot was built at */
+    int snapshot_len;           /* 0 = no cached snapshot */
+    char snapshot[2048];
+} obxd_instance_cold_t;
+
+typedef struct {
+    /* Render path, every block */
+    SynthEngine *synth;         /* Placed in the arena right after this struct */
+    const KernelVariant *kernels;  /* g_kernels unless forced with set_param("kernel_variant") */
+    float output_gain;
+    float tempo_bpm;
+    uint32_t batch_write;
+    uint32_t batch_read;
+    int pending_midi_count;
+    uint32_t stats_reset_request;
+    uint32_t stats_reset_done;
+    float stats_budget_pct;     /* Over-budget threshold, % of the block period */
+    obxd_telemetry_t *telemetry;  /* Telemetry mirror, written by render_block only */
+    struct AutoSampler *autosample;  /* Auto-sampled fallback, NULL until first enabled */
+    uint64_t render_ns;         /* v2_now_ns() at the start of the last render_block */
+    uint32_t param_version;     /* Bumped on every param/preset/bank change */
+    uint32_t audio_seq;         /* Odd while an audio-thread entry point runs */
+    uint32_t owner_state;       /* OWNER_* / CLONE_*, handoff between the audio and control threads */
+    void *clone_target;         /* Arena the audio thread copies into on CLONE_REQUESTED */
+    int oversampling_limit;     /* Highest rung a patch may select, SynthEngine::OVERSAMPLE_* */
+    /* MIDI path, every event */
+    int octave_transpose;
+    int midi_learn_param;       /* ParamsEnum index armed for learn, -1 = off */
+    uint32_t midi_learned;      /* Learn result not yet in the map, V2_LEARNED(cc, param), 0 = none */
+    uint32_t midi_map_live;     /* Which of cold->midi_maps the audio thread reads */
+    obxd_instance_cold_t *cold; /* Last part of the arena */
+    size_t arena_size;
+    /* get_param("stats") counters; stats_reset is applied by render_block */
+    RenderStats stats;
+    float params[PARAM_COUNT];  /* Engine param storage - indexed by ParamsEnum */
 } obxd_instance_t;
 
+static inline size_t arena_align(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+#define ARENA_ENGINE_OFFSET arena_align(sizeof(obxd_instance_t))
+#define ARENA_COLD_OFFSET (ARENA_ENGINE_OFFSET + arena_align(sizeof(SynthEngine)))
+#define ARENA_SIZE (ARENA_COLD_OFFSET + arena_align(sizeof(obxd_instance_cold_t)))
+
+/* Zeroed arena with the engine and cold pointers set; the engine is not constructed */
+static obxd_instance_t* v2_arena_alloc(void) {
+    void *arena = NULL;
+    if (posix_memalign(&arena, ARENA_ALIGN, ARENA_SIZE) != 0) return NULL;
+    memset(arena, 0, ARENA_SIZE);
+    obxd_instance_t *inst = (obxd_instance_t*)arena;
+    inst->synth = (SynthEngine*)((char*)arena + ARENA_ENGINE_OFFSET);
+    inst->cold = (obxd_instance_cold_t*)((char*)arena + ARENA_COLD_OFFSET);
+    inst->arena_size = ARENA_SIZE;
+    return inst;
+}
+
+/* Shared bank data refcounting - clones may be destroyed on any thread */
+static BankData* bank_data_retain(BankData *data) {
+    if (data) __atomic_add_fetch(&data->refcount, 1, __ATOMIC_RELAXED);
+    return data;
+}
+
+static void bank_data_release(BankData *data) {
+    if (data && __atomic_sub_fetch(&data->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(data);
+    }
+}
+
+static CostIndex* cost_index_retain(CostIndex *index) {
+    if (index) __atomic_add_fetch(&index->refcount, 1, __ATOMIC_RELAXED);
+    return index;
+}
+
+static void cost_index_release(CostIndex *index) {
+    if (index && __atomic_sub_fetch(&index->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(index);
+    }
+}
+
+/* Monotonic clock for block timing */
+static inline uint64_t v2_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * Telemetry region: POSIX shm so out-of-process monitors can map it,
+ * falling back to process-local memory when shm is unavailable. Opened on
+ * first request (get_param("telemetry_shm") or get_telemetry), so instances
+ * nobody monitors - clones in particular - never pay for the shm_open.
+ */
+static void v2_telemetry_open(obxd_instance_t *inst) {
+    static uint32_t s_counter = 0;
+    obxd_telemetry_t *t = NULL;
+
+    snprintf(inst->cold->telemetry_shm, sizeof(inst->cold->telemetry_shm), "/obxd-%d-%u",
+             (int)getpid(), __atomic_add_fetch(&s_counter, 1, __ATOMIC_RELAXED));
+    int fd = shm_open(inst->cold->telemetry_shm, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd >= 0) {
+        if (ftruncate(fd, sizeof(obxd_telemetry_t)) == 0) {
+            void *p = mmap(NULL, sizeof(obxd_telemetry_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED) t = (obxd_telemetry_t*)p;
+        }
+        close(fd);
+        if (!t) shm_unlink(inst->cold->telemetry_shm);
+    }
+    if (!t) {
+        inst->cold->telemetry_shm[0] = '\0';
+        t = (obxd_telemetry_t*)calloc(1, sizeof(obxd_telemetry_t));
+        if (!t) {
+            inst->telemetry = NULL;
+            return;
+        }
+    }
+
+    t->magic = OBXD_TELEMETRY_MAGIC;
+    t->version = OBXD_TELEMETRY_VERSION;
+    t->struct_size = sizeof(obxd_telemetry_t);
+    t->param_version = (uint32_t)-1;  /* Force first mirror copy */
+    __atomic_store_n(&inst->telemetry, t, __ATOMIC_RELEASE);
+}
+
+/* Telemetry region of an instance, opened on first use - control thread only */
+static obxd_telemetry_t* v2_telemetry_get(obxd_instance_t *inst) {
+    if (!inst->telemetry) v2_telemetry_open(inst);
+    return inst->telemetry;
+}
+
+static void v2_telemetry_close(obxd_instance_t *inst) {
+    if (!inst->telemetry) return;
+    if (inst->cold->telemetry_shm[0]) {
+        munmap(inst->telemetry, sizeof(obxd_telemetry_t));
+        shm_unlink(inst->cold->telemetry_shm);
+    } else {
+        free(inst->telemetry);
+    }
+    inst->telemetry = NULL;
+}
+
+/* Mark instance params as changed so pollers re-read them */
+static inline void v2_mark_changed(obxd_instance_t *inst) {
+    __atomic_add_fetch(&inst->param_version, 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Ownership handoff. The audio thread owns the instance state it renders
+ * from. clone_instance asks it for a copy: it posts a target arena as
+ * CLONE_REQUESTED and the next audio-thread entry point copies into it at
+ * its start, a block boundary, then flags CLONE_DONE. When no audio call
+ * comes (the instance is not rendering), the control thread claims the
+ * instance itself as OWNER_CONTROL - for the copy, or to apply params_batch
+ * writes render is not draining. audio_seq is odd while an entry point
+ * runs; the claim and the entry both use seq_cst, so either the control
+ * thread sees the audio thread inside and backs off, or the audio thread
+ * sees the claim and skips that call (silence, MIDI dropped) instead of
+ * touching the instance under it. Neither side ever waits for the other.
+ */
+enum { OWNER_AUDIO, CLONE_REQUESTED, CLONE_COPYING, CLONE_DONE, OWNER_CONTROL };
+
+#define CLAIM_TIMEOUT_US 200000  /* How long the control thread keeps trying to take the instance */
+
+static void v2_clone_copy(obxd_instance_t *dst, const obxd_instance_t *src);
+
+/* Enter an audio-thread entry point; false = skip the call, a clone owns the instance */
+static inline bool v2_audio_begin(obxd_instance_t *inst) {
+    __atomic_store_n(&inst->audio_seq, inst->audio_seq + 1, __ATOMIC_SEQ_CST);
+    uint32_t state = __atomic_load_n(&inst->owner_state, __ATOMIC_SEQ_CST);
+    if (state == OWNER_CONTROL) {
+        __atomic_store_n(&inst->audio_seq, inst->audio_seq + 1, __ATOMIC_RELEASE);
+        return false;
+    }
+    if (state == CLONE_REQUESTED &&
+        __atomic_compare_exchange_n(&inst->owner_state, &state, (uint32_t)CLONE_COPYING, false,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        v2_clone_copy((obxd_instance_t*)inst->clone_target, inst);
+        __atomic_store_n(&inst->owner_state, (uint32_t)CLONE_DONE, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+static inline void v2_audio_end(obxd_instance_t *inst) {
+    __atomic_store_n(&inst->audio_seq, inst->audio_seq + 1, __ATOMIC_RELEASE);
+}
+
+/* Take the instance from state `from` on the control thread; false if an entry point is running */
+static bool v2_control_claim(obxd_instance_t *inst, uint32_t from) {
+    if (__atomic_load_n(&inst->audio_seq, __ATOMIC_SEQ_CST) & 1) return false;
+    if (!__atomic_compare_exchange_n(&inst->owner_state, &from, (uint32_t)OWNER_CONTROL, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return false;
+    }
+    if ((__atomic_load_n(&inst->audio_seq, __ATOMIC_SEQ_CST) & 1) == 0) return true;
+    /* An entry point started meanwhile, hand the instance back to it */
+    __atomic_store_n(&inst->owner_state, from, __ATOMIC_SEQ_CST);
+    return false;
+}
+
+static inline void v2_control_release(obxd_instance_t *inst, uint32_t to) {
+    __atomic_store_n(&inst->owner_state, to, __ATOMIC_RELEASE);
+}
+
 /* Forward declarations */
 static void v2_init_default_patch(obxd_instance_t *inst);
 static void v2_apply_preset(obxd_instance_t *inst, int preset_idx);
@@ -251,6 +868,9 @@ static void v2_apply_param(obxd_instance_t *inst, int bank, int idx, float value
 static int v2_load_bank(obxd_instance_t *inst, const char *bank_path);
 static void v2_scan_banks(obxd_instance_t *inst, const char *module_dir);
 static int v2_switch_bank(obxd_instance_t *inst, int bank_idx);
+static int v2_format_stats(obxd_instance_t *inst, char *buf, int buf_len);
+static void v2_apply_param_direct(obxd_instance_t *inst, int param_idx, float value);
+static void v2_engine_set(SynthEngine *synth, int param_idx, float value);
 
 /* v2 helper: Initialize default patch */
 static void v2_init_default_patch(obxd_instance_t *inst) {
@@ -311,21 +931,27 @@ static void v2_init_default_patch(obxd_instance_t *inst) {
     synth->processFilterEnvelopeRelease(0.2f);
     inst->params[FREL] = 0.2f;
 
-    snprintf(inst->preset_name, sizeof(inst->preset_name), "Init");
+    snprintf(inst->cold->preset_name, sizeof(inst->cold->preset_name), "Init");
 }
 
 /* v2 helper: Apply preset - FXB file params match ParamsEnum indices */
 static void v2_apply_preset(obxd_instance_t *inst, int preset_idx) {
-    if (preset_idx < 0 || preset_idx >= inst->preset_count) return;
+    if (preset_idx < 0 || preset_idx >= inst->cold->preset_count || !inst->cold->bank_data) return;
 
-    Preset *p = &inst->presets[preset_idx];
+    const Preset *p = &inst->cold->bank_data->presets[preset_idx];
     SynthEngine *synth = inst->synth;
-    snprintf(inst->preset_name, sizeof(inst->preset_name), "%s", p->name);
+    snprintf(inst->cold->preset_name, sizeof(inst->cold->preset_name), "%s", p->name);
+    v2_mark_changed(inst);
 
     /* Copy all preset params to instance params (indices match ParamsEnum) */
     for (int i = 0; i < p->param_count && i < PARAM_COUNT; i++) {
         inst->params[i] = p->params[i];
     }
+    /* Bank patches carry the original HQ switch, 0 = 1x and 1 = 2x: map it onto the rungs */
+    if (p->param_count > FILTER_WARM) {
+        inst->params[FILTER_WARM] = p->params[FILTER_WARM] >= 0.5f
+            ? (float)SynthEngine::OVERSAMPLE_2X / (SynthEngine::OVERSAMPLE_RUNGS - 1) : 0.0f;
+    }
 
     /* Apply all parameters to engine */
     if (p->param_count > VOLUME) synth->processVolume(p->params[VOLUME]);
@@ -403,6 +1029,9 @@ static void v2_apply_preset(obxd_instance_t *inst, int preset_idx) {
     if (p->param_count > FILTERDER) synth->processFilterDetune(p->params[FILTERDER]);
     if (p->param_count > PORTADER) synth->processPortamentoDetune(p->params[PORTADER]);
 
+    /* Oversampling rung, capped by the instance limit */
+    if (p->param_count > FILTER_WARM) synth->processOversampling(inst->params[FILTER_WARM]);
+
     /* Pitch bend */
     if (p->param_count > BENDRANGE) synth->procPitchWheelAmount(p->params[BENDRANGE]);
     if (p->param_count > BENDLFORATE) synth->procModWheelFrequency(p->params[BENDLFORATE]);
@@ -412,6 +1041,7 @@ static void v2_apply_preset(obxd_instance_t *inst, int preset_idx) {
 static void v2_apply_param(obxd_instance_t *inst, int bank, int idx, float value) {
     int param_idx = bank * 8 + idx;
     inst->params[param_idx] = value;
+    v2_mark_changed(inst);
     SynthEngine *synth = inst->synth;
 
     switch (bank) {
@@ -483,18 +1113,21 @@ static int v2_load_bank(obxd_instance_t *inst, const char *bank_path) {
     }
     if (!xml) { free(data); return -1; }
 
-    inst->preset_count = 0;
+    /* Parse into fresh storage - clones may still reference the old bank */
+    BankData *bank = (BankData*)calloc(1, sizeof(BankData));
+    if (!bank) { free(data); return -1; }
+    bank->refcount = 1;
+
     char *program = xml;
     char buf[256];
 
-    while ((program = strstr(program, "<program ")) != NULL && inst->preset_count < MAX_PRESETS) {
-        Preset *p = &inst->presets[inst->preset_count];
-        memset(p, 0, sizeof(Preset));
+    while ((program = strstr(program, "<program ")) != NULL && bank->preset_count < MAX_PRESETS) {
+        Preset *p = &bank->presets[bank->preset_count];
 
         if (find_attr(program, "programName", buf, sizeof(buf))) {
             strncpy(p->name, buf, sizeof(p->name) - 1);
         } else {
-            snprintf(p->name, sizeof(p->name), "Preset %d", inst->preset_count);
+            snprintf(p->name, sizeof(p->name), "Preset %d", bank->preset_count);
         }
 
         for (int i = 0; i < MAX_PARAMS; i++) {
@@ -506,17 +1139,21 @@ static int v2_load_bank(obxd_instance_t *inst, const char *bank_path) {
             }
         }
 
-        inst->preset_count++;
+        bank->preset_count++;
         program++;
     }
 
     free(data);
 
+    bank_data_release(inst->cold->bank_data);
+    inst->cold->bank_data = bank;
+    inst->cold->preset_count = bank->preset_count;
+
     char msg[128];
-    snprintf(msg, sizeof(msg), "Loaded %d presets from bank", inst->preset_count);
+    snprintf(msg, sizeof(msg), "Loaded %d presets from bank", inst->cold->preset_count);
     plugin_log(msg);
 
-    return inst->preset_count;
+    return inst->cold->preset_count;
 }
 
 /* v2 helper: Extract display name from a file path (strip directory and .fxb extension) */
@@ -549,14 +1186,27 @@ static int bank_compare(const void *a, const void *b) {
 }
 
 /* v2 helper: Scan presets/ folder and populate banks[] array */
+/* FNV-1a over the bank names and selection, to tell whether a rescan changed anything */
+static uint32_t v2_bank_list_hash(const obxd_instance_t *inst) {
+    uint32_t h = 2166136261u ^ (uint32_t)inst->cold->bank_count ^ ((uint32_t)inst->cold->current_bank << 16);
+    for (int i = 0; i < inst->cold->bank_count; i++) {
+        for (const char *c = inst->cold->banks[i].name; *c; c++) h = (h ^ (uint8_t)*c) * 16777619u;
+        h = (h ^ 0xFF) * 16777619u;
+    }
+    return h;
+}
+
+/* Rescan presets/ - snapshot pollers see a version bump when the list changed */
 static void v2_scan_banks(obxd_instance_t *inst, const char *module_dir) {
+    uint32_t before = v2_bank_list_hash(inst);
+
     /* Remember current bank name so we can re-select it after rescan */
     char prev_bank_name[64] = "";
-    if (inst->current_bank >= 0 && inst->current_bank < inst->bank_count) {
-        strncpy(prev_bank_name, inst->banks[inst->current_bank].name, sizeof(prev_bank_name) - 1);
+    if (inst->cold->current_bank >= 0 && inst->cold->current_bank < inst->cold->bank_count) {
+        strncpy(prev_bank_name, inst->cold->banks[inst->cold->current_bank].name, sizeof(prev_bank_name) - 1);
     }
 
-    inst->bank_count = 0;
+    inst->cold->bank_count = 0;
 
     char presets_dir[512];
     snprintf(presets_dir, sizeof(presets_dir), "%s/presets", module_dir);
@@ -568,22 +1218,23 @@ static void v2_scan_banks(obxd_instance_t *inst, const char *module_dir) {
     FILE *f = fopen(factory_path, "rb");
     if (f) {
         fclose(f);
-        BankInfo *b = &inst->banks[inst->bank_count];
+        BankInfo *b = &inst->cold->banks[inst->cold->bank_count];
         strncpy(b->name, "Factory", sizeof(b->name) - 1);
         strncpy(b->path, factory_path, sizeof(b->path) - 1);
         b->preset_count = 0;
-        inst->bank_count++;
+        inst->cold->bank_count++;
     }
 
     /* Scan for additional .fxb files */
     DIR *dir = opendir(presets_dir);
     if (!dir) {
         plugin_log("Could not open presets dir");
+        if (v2_bank_list_hash(inst) != before) v2_mark_changed(inst);
         return;
     }
 
     struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL && inst->bank_count < MAX_BANKS) {
+    while ((entry = readdir(dir)) != NULL && inst->cold->bank_count < MAX_BANKS) {
         const char *fname = entry->d_name;
         int len = strlen(fname);
 
@@ -596,146 +1247,1136 @@ static void v2_scan_banks(obxd_instance_t *inst, const char *module_dir) {
         /* Skip factory.fxb — already added */
         if (strcasecmp(fname, "factory.fxb") == 0) continue;
 
-        BankInfo *b = &inst->banks[inst->bank_count];
+        BankInfo *b = &inst->cold->banks[inst->cold->bank_count];
         snprintf(b->path, sizeof(b->path), "%s/%s", presets_dir, fname);
         bank_name_from_path(b->path, b->name, sizeof(b->name));
         b->preset_count = 0;
 
-        inst->bank_count++;
+        inst->cold->bank_count++;
     }
     closedir(dir);
 
     /* Sort alphabetically (Factory always first) */
-    if (inst->bank_count > 1) {
-        qsort(inst->banks, inst->bank_count, sizeof(BankInfo), bank_compare);
+    if (inst->cold->bank_count > 1) {
+        qsort(inst->cold->banks, inst->cold->bank_count, sizeof(BankInfo), bank_compare);
     }
 
     /* Re-map current_bank to match the previous bank name after sort */
     if (prev_bank_name[0]) {
-        for (int i = 0; i < inst->bank_count; i++) {
-            if (strcmp(inst->banks[i].name, prev_bank_name) == 0) {
-                inst->current_bank = i;
+        for (int i = 0; i < inst->cold->bank_count; i++) {
+            if (strcmp(inst->cold->banks[i].name, prev_bank_name) == 0) {
+                inst->cold->current_bank = i;
                 break;
             }
         }
     }
 
+    if (v2_bank_list_hash(inst) != before) v2_mark_changed(inst);
+
     char msg[64];
-    snprintf(msg, sizeof(msg), "Total banks found: %d", inst->bank_count);
+    snprintf(msg, sizeof(msg), "Total banks found: %d", inst->cold->bank_count);
     plugin_log(msg);
 }
 
 /* v2 helper: Switch to a bank by index, load its presets */
 static int v2_switch_bank(obxd_instance_t *inst, int bank_idx) {
-    if (bank_idx < 0 || bank_idx >= inst->bank_count) return -1;
-    if (bank_idx == inst->current_bank && inst->preset_count > 0) return inst->preset_count;
+    if (bank_idx < 0 || bank_idx >= inst->cold->bank_count) return -1;
+    if (bank_idx == inst->cold->current_bank && inst->cold->preset_count > 0) return inst->cold->preset_count;
 
-    int count = v2_load_bank(inst, inst->banks[bank_idx].path);
+    int count = v2_load_bank(inst, inst->cold->banks[bank_idx].path);
     if (count > 0) {
-        inst->current_bank = bank_idx;
-        inst->banks[bank_idx].preset_count = count;
-        inst->current_preset = 0;
+        inst->cold->current_bank = bank_idx;
+        inst->cold->banks[bank_idx].preset_count = count;
+        inst->cold->current_preset = 0;
         v2_apply_preset(inst, 0);
         char msg[128];
         snprintf(msg, sizeof(msg), "Switched to bank %d: %s (%d presets)",
-                 bank_idx, inst->banks[bank_idx].name, count);
+                 bank_idx, inst->cold->banks[bank_idx].name, count);
         plugin_log(msg);
     }
     return count;
 }
 
-/* v2 API: Create instance */
-static void* v2_create_instance(const char *module_dir, const char *json_defaults) {
-    (void)json_defaults;
+/*
+ * v2 helper: Load presets/cost_index.tsv written by the harness `cost-survey`
+ * command. One line per preset: bank, index, avg_us, peak_us, idle_us,
+ * block_us, rel, name.
+ * Returns NULL when the file is missing or empty.
+ */
+static CostIndex* v2_load_cost_index(const char *module_dir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/presets/cost_index.tsv", module_dir);
+    FILE *f = fopen(path, "r");
+    if (!f) return NULL;
+
+    char line[256];
+    int lines = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] != '#') lines++;
+    }
+    if (lines == 0) {
+        fclose(f);
+        return NULL;
+    }
 
-    obxd_instance_t *inst = (obxd_instance_t*)calloc(1, sizeof(obxd_instance_t));
-    if (!inst) return NULL;
+    CostIndex *index = (CostIndex*)calloc(1, sizeof(CostIndex) + (lines - 1) * sizeof(PresetCost));
+    if (!index) {
+        fclose(f);
+        return NULL;
+    }
+    index->refcount = 1;
+
+    rewind(f);
+    while (fgets(line, sizeof(line), f) && index->count < lines) {
+        if (line[0] == '#') continue;
+        PresetCost *c = &index->entries[index->count];
+        char *field[8];
+        int n = 0;
+        char *p = line;
+        field[n++] = p;
+        while (n < 8 && (p = strchr(p, '\t')) != NULL) {
+            *p++ = '\0';
+            field[n++] = p;
+        }
+        if (n < 8) continue;
+        field[7][strcspn(field[7], "\r\n")] = '\0';
+
+        /* A truncated bank name could match the wrong bank, so skip the row */
+        size_t bank_len = strlen(field[0]);
+        if (bank_len >= sizeof(c->bank)) continue;
+        memcpy(c->bank, field[0], bank_len + 1);
+        c->preset = atoi(field[1]);
+        c->avg_us = (float)atof(field[2]);
+        c->peak_us = (float)atof(field[3]);
+        c->idle_us = (float)atof(field[4]);
+        c->block_us = (float)atof(field[5]);
+        c->rel = (float)atof(field[6]);
+        snprintf(c->name, sizeof(c->name), "%s", field[7]);
+        index->count++;
+    }
+    fclose(f);
 
-    strncpy(inst->module_dir, module_dir, sizeof(inst->module_dir) - 1);
-    inst->output_gain = 0.5f;
-    inst->tempo_bpm = 120.0f;
-    snprintf(inst->preset_name, sizeof(inst->preset_name), "Init");
+    char msg[64];
+    snprintf(msg, sizeof(msg), "Loaded cost index: %d presets", index->count);
+    plugin_log(msg);
+    return index;
+}
 
-    inst->synth = new SynthEngine();
-    if (!inst->synth) {
-        free(inst);
-        return NULL;
+/* v2 helper: Cost entry for a preset of the current bank, NULL if not surveyed */
+static const PresetCost* v2_find_cost(const obxd_instance_t *inst, int preset_idx) {
+    if (!inst->cold->cost_index || !inst->cold->bank_data) return NULL;
+    if (inst->cold->current_bank < 0 || inst->cold->current_bank >= inst->cold->bank_count) return NULL;
+    if (preset_idx < 0 || preset_idx >= inst->cold->bank_data->preset_count) return NULL;
+
+    const char *bank = inst->cold->banks[inst->cold->current_bank].name;
+    const char *name = inst->cold->bank_data->presets[preset_idx].name;
+    for (int i = 0; i < inst->cold->cost_index->count; i++) {
+        const PresetCost *c = &inst->cold->cost_index->entries[i];
+        if (c->preset == preset_idx && strcmp(c->bank, bank) == 0 && strcmp(c->name, name) == 0) return c;
     }
+    return NULL;
+}
 
-    inst->synth->setSampleRate((float)MOVE_SAMPLE_RATE);
-    inst->synth->setPlayHead(inst->tempo_bpm, 0.0f);
+/* Coarse cost class for UI badges */
+static const char* v2_cost_class(float rel) {
+    if (rel >= COST_HEAVY_REL) return "heavy";
+    if (rel <= COST_LIGHT_REL) return "light";
+    return "medium";
+}
 
-    v2_init_default_patch(inst);
+/* =====================================================================
+ * Auto-sampled fallback
+ *
+ * Optional, off by default: set_param("autosample", "1"). A worker thread
+ * renders a multisample of the current patch (auto_sampler.h) once its
+ * params have settled. While smoothed render load stays above
+ * autosample_load_pct, new notes on an eligible patch play from that
+ * cache instead of engine voices. Any param change makes the cache stale:
+ * held sampler notes are handed back to the engine and the worker renders
+ * again once the patch settles.
+ *
+ * Caches are shared: instances playing the same patch at the same tempo
+ * (clones, several tracks on one preset) reuse one rendering.
+ * ===================================================================== */
 
-    /* Scan presets folder for all .fxb banks and load the first */
-    v2_scan_banks(inst, module_dir);
-    if (inst->bank_count > 0) {
-        inst->current_bank = -1;  /* Force load */
-        v2_switch_bank(inst, 0);
-    }
+#define AS_POLL_MS 50            /* Worker wake-up period */
+#define AS_SETTLE_MS 500         /* Params must hold still this long before a build */
+#define AS_PRE_ROLL 4096         /* Frames run before sampling so smoothers settle */
+#define AS_LOOP_MAX_SECONDS 1.5f /* Longest layer of a sustaining patch */
+#define AS_ONESHOT_MAX_SECONDS 2.0f
+#define AS_HANDBACK_MS 10.0f     /* Fade of sampler notes handed back to the engine */
+#define AS_LOAD_DEFAULT 70.0f
 
-    plugin_log("OB-Xd v2: Instance created");
-    return inst;
+enum { AS_STATE_IDLE, AS_STATE_BUILDING, AS_STATE_READY, AS_STATE_INELIGIBLE };
+static const char *g_as_state_names[] = {"idle", "building", "ready", "ineligible"};
+
+/*
+ * One worker -> audio thread hand-off: the cache and the param_version it
+ * was rendered at travel in one pointer, so they cannot be paired wrongly
+ * when the worker publishes twice before a block takes the first. The
+ * audio thread sends the node back with the cache it replaced as retired.
+ */
+struct AutoSampleHandoff {
+    AutoSampleCache *cache;
+    uint32_t version;
+};
+
+/* What the worker renders: the patch as the control thread last saw it */
+struct AutoSampleJob {
+    int valid;
+    uint32_t version;           /* param_version the params were copied at */
+    float params[PARAM_COUNT];
+    float tempo;
+    int oversampling_limit;
+};
+
+struct AutoSampler {
+    obxd_instance_t *inst;
+    pthread_t thread;
+    int running;                /* Worker thread started */
+    int stop;                   /* Worker exit request */
+    int enabled;                /* New notes may go to the sampler */
+    float load_pct;             /* Pressure threshold, % of the block period */
+    /* Worker -> audio thread hand-off */
+    AutoSampleHandoff *next;    /* Published cache, taken at a block start */
+    AutoSampleHandoff *retired; /* Replaced cache, released by the worker */
+    /* Audio thread */
+    AutoSampleCache *cache;
+    uint32_t cache_version;
+    AutoSampleVoice voices[AS_VOICES];
+    int playing;
+    uint8_t note_voice[128];    /* Sampler voice per held note, AS_NO_VOICE if none */
+    uint8_t synth_held[128];    /* Notes held on engine voices */
+    int sustain;
+    int bend;
+    int modwheel;
+    float load_avg;
+    int pressure;
+    uint32_t age;
+    uint32_t sampled_notes;
+    uint32_t handbacks;
+    /* Control thread -> worker, under g_as_lock */
+    AutoSampleJob job;
+    uint32_t job_version;       /* Control thread: version last published */
+    /* Worker status, written under g_as_lock (state is atomic) */
+    int state;
+    const char *reason;         /* Why the patch is ineligible */
+    uint32_t builds;
+    uint32_t shared_hits;
+    uint32_t cache_kb;
+    float build_ms;
+};
+
+/* Shared cache list, jobs and worker status - only touched by workers and the control thread, never by render */
+static pthread_mutex_t g_as_lock = PTHREAD_MUTEX_INITIALIZER;
+static AutoSampleCache *g_as_caches = NULL;
+
+static AutoSampleCache* auto_sample_cache_find(uint64_t hash) {
+    pthread_mutex_lock(&g_as_lock);
+    AutoSampleCache *c = g_as_caches;
+    while (c && c->patch_hash != hash) c = c->next_shared;
+    if (c) c->refcount++;
+    pthread_mutex_unlock(&g_as_lock);
+    return c;
 }
 
-/* v2 API: Destroy instance */
-static void v2_destroy_instance(void *instance) {
-    obxd_instance_t *inst = (obxd_instance_t*)instance;
-    if (!inst) return;
+static void auto_sample_cache_publish(AutoSampleCache *c) {
+    pthread_mutex_lock(&g_as_lock);
+    c->next_shared = g_as_caches;
+    g_as_caches = c;
+    pthread_mutex_unlock(&g_as_lock);
+}
+
+static void auto_sample_cache_release(AutoSampleCache *c);
+
+/* Worker/teardown side: drop a hand-off node and the cache it holds */
+static void auto_sample_handoff_free(AutoSampleHandoff *h) {
+    if (!h) return;
+    auto_sample_cache_release(h->cache);
+    free(h);
+}
 
-    if (inst->synth) {
-        delete inst->synth;
+static void auto_sample_cache_release(AutoSampleCache *c) {
+    if (!c) return;
+    pthread_mutex_lock(&g_as_lock);
+    if (--c->refcount == 0) {
+        AutoSampleCache **pp = &g_as_caches;
+        while (*pp && *pp != c) pp = &(*pp)->next_shared;
+        if (*pp) *pp = c->next_shared;
+        free(c);
     }
-    free(inst);
-    plugin_log("OB-Xd v2: Instance destroyed");
+    pthread_mutex_unlock(&g_as_lock);
 }
 
-/* v2 API: MIDI handler */
-static void v2_on_midi(void *instance, const uint8_t *msg, int len, int source) {
-    obxd_instance_t *inst = (obxd_instance_t*)instance;
-    if (!inst || !inst->synth || len < 2) return;
+/* FNV-1a over the params and tempo a rendering depends on */
+static uint64_t v2_autosample_hash(const float *params, float tempo) {
+    uint64_t h = 1469598103934665603ull;
+    const uint8_t *p = (const uint8_t*)params;
+    for (size_t i = 0; i < sizeof(float) * PARAM_COUNT; i++) h = (h ^ p[i]) * 1099511628211ull;
+    p = (const uint8_t*)&tempo;
+    for (size_t i = 0; i < sizeof(tempo); i++) h = (h ^ p[i]) * 1099511628211ull;
+    return h;
+}
 
-    (void)source;
+/* Amp and filter envelope attack + decay, ms - the part a loop must not cut into */
+static float v2_autosample_env_ms(const float *p) {
+    float amp = logsc(p[LATK], 4, 60000, 900) + logsc(p[LDEC], 4, 60000, 900);
+    float flt = logsc(p[FATK], 1, 60000, 900) + logsc(p[FDEC], 1, 60000, 900);
+    return amp > flt ? amp : flt;
+}
 
-    uint8_t status = msg[0] & 0xF0;
-    uint8_t data1 = msg[1];
-    uint8_t data2 = (len > 2) ? msg[2] : 0;
+/* NULL if the patch has no per-note variation a multisample would lose */
+static const char* v2_autosample_ineligible(const float *p) {
+    if (p[LFO1AMT] > 0.0f && (p[LFOOSC1] > 0.5f || p[LFOOSC2] > 0.5f || p[LFOFILTER] > 0.5f)) return "lfo";
+    if (p[LFO2AMT] > 0.0f && (p[LFOPW1] > 0.5f || p[LFOPW2] > 0.5f)) return "lfo";
+    if (p[LSUS] > 0.01f && v2_autosample_env_ms(p) > (AS_LOOP_MAX_SECONDS - AS_LOOP_SECONDS - 0.1f) * 1000.0f) {
+        return "envelope";
+    }
+    return NULL;
+}
 
-    int note = data1;
-    if (status == 0x90 || status == 0x80) {
-        note += inst->octave_transpose * 12;
-        if (note < 0) note = 0;
-        if (note > 127) note = 127;
+/*
+ * Render every root x layer of a patch. Each note starts from a copy of
+ * one configured, settled engine, so all layers of a root are phase
+ * coherent and crossfade cleanly. Returns NULL if the patch moved (or the
+ * worker was stopped) mid-build.
+ */
+static AutoSampleCache* v2_autosample_build(AutoSampler *as, const AutoSampleJob *job, uint64_t hash) {
+    obxd_instance_t *inst = as->inst;
+    const float *params = job->params;
+    uint32_t version = job->version;
+    int looped = params[LSUS] > 0.01f;
+    float env_s = v2_autosample_env_ms(params) * 0.001f;
+
+    AutoSampleZone zones[AS_ROOTS];
+    uint32_t total = 0;
+    for (int z = 0; z < AS_ROOTS; z++) {
+        float seconds;
+        uint32_t loop_len = 0;
+        if (looped) {
+            /* Whole periods of the root, so the loop seam lines up */
+            float period = MOVE_SAMPLE_RATE / (440.0f * powf(2.0f, (auto_sample_root(z) - 69) / 12.0f));
+            float periods = floorf(AS_LOOP_SECONDS * MOVE_SAMPLE_RATE / period + 0.5f);
+            if (periods < 1.0f) periods = 1.0f;
+            loop_len = (uint32_t)(periods * period + 0.5f);
+            seconds = env_s + 0.05f + (float)(loop_len + AS_LOOP_XFADE) / MOVE_SAMPLE_RATE;
+            if (seconds > AS_LOOP_MAX_SECONDS) seconds = AS_LOOP_MAX_SECONDS;
+        } else {
+            seconds = env_s + 0.05f;
+            if (seconds > AS_ONESHOT_MAX_SECONDS) seconds = AS_ONESHOT_MAX_SECONDS;
+            if (seconds < 0.1f) seconds = 0.1f;
+        }
+        zones[z].length = (uint32_t)(seconds * MOVE_SAMPLE_RATE);
+        zones[z].loop_start = zones[z].length - loop_len;
+        for (int l = 0; l < AS_LAYERS; l++) {
+            zones[z].offset[l] = total;
+            total += zones[z].length;
+        }
     }
 
-    switch (status) {
-        case 0x90:
-            if (data2 > 0) {
-                inst->synth->procNoteOn(note, data2 / 127.0f);
-            } else {
-                inst->synth->procNoteOff(note);
+    AutoSampleCache *c = (AutoSampleCache*)malloc(sizeof(AutoSampleCache) + (size_t)total * 2 * sizeof(int16_t));
+    if (!c) return NULL;
+    c->refcount = 1;
+    c->next_shared = NULL;
+    c->patch_hash = hash;
+    c->total_frames = total;
+    memcpy(c->zones, zones, sizeof(zones));
+    float rel_ms = logsc(params[LREL], 8, 60000, 900);
+    c->release_coef = expf(logf(0.00001f) / (MOVE_SAMPLE_RATE * rel_ms * 0.001f));
+
+    SynthEngine *base = new (std::nothrow) SynthEngine();
+    if (!base) {
+        free(c);
+        return NULL;
+    }
+    base->setSampleRate((float)MOVE_SAMPLE_RATE);
+    base->setPlayHead(job->tempo, 0.0f);
+    base->setOversamplingLimit(job->oversampling_limit);
+    for (int i = 0; i < PARAM_COUNT; i++) v2_engine_set(base, i, params[i]);
+    float l, r;
+    for (int i = 0; i < AS_PRE_ROLL; i++) base->processSample(&l, &r);
+
+    int ok = 1;
+    for (int z = 0; z < AS_ROOTS && ok; z++) {
+        for (int layer = 0; layer < AS_LAYERS && ok; layer++) {
+            if (__atomic_load_n(&as->stop, __ATOMIC_RELAXED) ||
+                __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE) != version) {
+                ok = 0;
+                break;
+            }
+            SynthEngine *e = new (std::nothrow) SynthEngine(*base);
+            if (!e) {
+                ok = 0;
+                break;
+            }
+            e->procNoteOn(auto_sample_root(z), g_as_layer_vel[layer]);
+
+            int16_t *out = c->frames + (size_t)zones[z].offset[layer] * 2;
+            for (uint32_t f = 0; f < zones[z].length; f++) {
+                l = r = 0.0f;
+                e->processSample(&l, &r);
+                int32_t li = (int32_t)lrintf(l * AS_SCALE);
+                int32_t ri = (int32_t)lrintf(r * AS_SCALE);
+                if (li > 32767) li = 32767;
+                if (li < -32768) li = -32768;
+                if (ri > 32767) ri = 32767;
+                if (ri < -32768) ri = -32768;
+                out[f * 2] = (int16_t)li;
+                out[f * 2 + 1] = (int16_t)ri;
+            }
+            delete e;
+            if (zones[z].loop_start < zones[z].length) {
+                auto_sample_make_loop(out, zones[z].length, zones[z].loop_start);
+            }
+        }
+    }
+    delete base;
+
+    if (!ok) {
+        free(c);
+        return NULL;
+    }
+    return c;
+}
+
+/*
+ * Control thread: publish the patch as a job for the worker. The params
+ * are copied here, on the thread that writes them; a write from the audio
+ * thread (CC, params_batch) that lands mid-copy moves param_version, and
+ * the copy is dropped until the next call. Called from get_param/set_param.
+ */
+static void v2_autosample_publish(obxd_instance_t *inst) {
+    AutoSampler *as = inst->autosample;
+    if (!as || !as->running) return;
+    uint32_t version = __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE);
+    if (as->job.valid && version == as->job_version) return;
+
+    AutoSampleJob job;
+    job.valid = 1;
+    job.version = version;
+    memcpy(job.params, inst->params, sizeof(job.params));
+    job.tempo = inst->tempo_bpm;
+    job.oversampling_limit = inst->oversampling_limit;
+    if (__atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE) != version) return;
+
+    pthread_mutex_lock(&g_as_lock);
+    as->job = job;
+    pthread_mutex_unlock(&g_as_lock);
+    as->job_version = version;
+}
+
+/* Worker: wait for the published patch to settle, render it, publish the cache */
+static void* v2_autosample_worker(void *arg) {
+    AutoSampler *as = (AutoSampler*)arg;
+    obxd_instance_t *inst = as->inst;
+    uint32_t seen = 0;
+    uint64_t changed_at = v2_now_ns();
+    uint32_t built = 0;
+    int built_any = 0;          /* Force the first build */
+    AutoSampleJob job;
+
+    while (!__atomic_load_n(&as->stop, __ATOMIC_RELAXED)) {
+        usleep(AS_POLL_MS * 1000);
+        auto_sample_handoff_free(__atomic_exchange_n(&as->retired, (AutoSampleHandoff*)NULL, __ATOMIC_ACQUIRE));
+
+        pthread_mutex_lock(&g_as_lock);
+        int valid = as->job.valid;
+        uint32_t version = as->job.version;
+        pthread_mutex_unlock(&g_as_lock);
+        if (!valid) continue;
+
+        /* A newer change the control thread has not published yet counts as movement */
+        uint64_t now = v2_now_ns();
+        if (version != seen || __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE) != version) {
+            seen = version;
+            changed_at = now;
+            __atomic_store_n(&as->state, AS_STATE_IDLE, __ATOMIC_RELAXED);
+            continue;
+        }
+        if ((built_any && version == built) || now - changed_at < AS_SETTLE_MS * 1000000ull) continue;
+
+        pthread_mutex_lock(&g_as_lock);
+        job = as->job;
+        pthread_mutex_unlock(&g_as_lock);
+        if (job.version != version) continue;
+        built = version;
+        built_any = 1;
+
+        const char *reason = v2_autosample_ineligible(job.params);
+        pthread_mutex_lock(&g_as_lock);
+        as->reason = reason;
+        pthread_mutex_unlock(&g_as_lock);
+        if (reason) {
+            __atomic_store_n(&as->state, AS_STATE_INELIGIBLE, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        uint64_t hash = v2_autosample_hash(job.params, job.tempo) ^ (uint64_t)job.oversampling_limit;
+        AutoSampleCache *c = auto_sample_cache_find(hash);
+        if (c) {
+            pthread_mutex_lock(&g_as_lock);
+            as->shared_hits++;
+            pthread_mutex_unlock(&g_as_lock);
+        } else {
+            __atomic_store_n(&as->state, AS_STATE_BUILDING, __ATOMIC_RELAXED);
+            uint64_t start = v2_now_ns();
+            c = v2_autosample_build(as, &job, hash);
+            if (!c) {
+                built_any = 0;  /* Patch moved mid-build, try again once it settles */
+                continue;
+            }
+            pthread_mutex_lock(&g_as_lock);
+            as->build_ms = (v2_now_ns() - start) * 1e-6f;
+            as->builds++;
+            pthread_mutex_unlock(&g_as_lock);
+            auto_sample_cache_publish(c);
+        }
+
+        AutoSampleHandoff *h = (AutoSampleHandoff*)malloc(sizeof(AutoSampleHandoff));
+        if (!h) {
+            auto_sample_cache_release(c);
+            built_any = 0;
+            continue;
+        }
+        h->cache = c;
+        h->version = version;
+        pthread_mutex_lock(&g_as_lock);
+        as->cache_kb = (uint32_t)(c->total_frames * 4 / 1024);
+        pthread_mutex_unlock(&g_as_lock);
+        auto_sample_handoff_free(__atomic_exchange_n(&as->next, h, __ATOMIC_ACQ_REL));
+        __atomic_store_n(&as->state, AS_STATE_READY, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+static void v2_autosample_stop(AutoSampler *as) {
+    if (!as->running) return;
+    __atomic_store_n(&as->stop, 1, __ATOMIC_RELAXED);
+    pthread_join(as->thread, NULL);
+    as->running = 0;
+}
+
+/* Sampler state, allocated on first use and kept until destroy */
+static AutoSampler* v2_autosample_state(obxd_instance_t *inst) {
+    AutoSampler *as = inst->autosample;
+    if (as) return as;
+    as = (AutoSampler*)calloc(1, sizeof(AutoSampler));
+    if (!as) return NULL;
+    as->inst = inst;
+    as->load_pct = AS_LOAD_DEFAULT;
+    memset(as->note_voice, AS_NO_VOICE, sizeof(as->note_voice));
+    __atomic_store_n(&inst->autosample, as, __ATOMIC_RELEASE);
+    return as;
+}
+
+/* set_param("autosample") - start or stop the worker */
+static void v2_autosample_enable(obxd_instance_t *inst, int enable) {
+    if (!enable && !inst->autosample) return;
+    AutoSampler *as = v2_autosample_state(inst);
+    if (!as) return;
+
+    if (enable && !as->running) {
+        as->stop = 0;
+        if (pthread_create(&as->thread, NULL, v2_autosample_worker, as) != 0) return;
+        as->running = 1;
+        v2_autosample_publish(inst);
+    } else if (!enable) {
+        v2_autosample_stop(as);
+    }
+    __atomic_store_n(&as->enabled, enable, __ATOMIC_RELEASE);
+}
+
+static void v2_autosample_free(obxd_instance_t *inst) {
+    AutoSampler *as = inst->autosample;
+    if (!as) return;
+    v2_autosample_stop(as);
+    auto_sample_cache_release(as->cache);
+    auto_sample_handoff_free(as->next);
+    auto_sample_handoff_free(as->retired);
+    free(as);
+    inst->autosample = NULL;
+}
+
+/* Sampler voice for a new note: free, else the quietest released, else the oldest */
+static AutoSampleVoice* v2_autosample_voice(AutoSampler *as) {
+    AutoSampleVoice *best = NULL;
+    for (int v = 0; v < AS_VOICES; v++) {
+        AutoSampleVoice *vo = &as->voices[v];
+        if (!vo->active) return vo;
+        if (!best) {
+            best = vo;
+        } else if (!vo->held && (best->held || vo->gain < best->gain)) {
+            best = vo;
+        } else if (vo->held && best->held && vo->age < best->age) {
+            best = vo;
+        }
+    }
+    if (best->held) as->note_voice[best->note] = AS_NO_VOICE;
+    return best;
+}
+
+/* Note-on: returns 1 if the sampler took the note, 0 to play it on the engine */
+static int v2_autosample_note_on(obxd_instance_t *inst, int note, float velocity) {
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (!as) return 0;
+
+    int zone = auto_sample_zone(note);
+    if (!__atomic_load_n(&as->enabled, __ATOMIC_ACQUIRE) || !as->pressure || zone < 0 || !as->cache ||
+        as->cache_version != __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE) ||
+        as->bend != 0 || as->modwheel != 0 || inst->synth->getVoiceCount() <= 1) {
+        as->synth_held[note] = 1;
+        return 0;
+    }
+
+    if (as->synth_held[note]) {
+        inst->synth->procNoteOff(note);
+        as->synth_held[note] = 0;
+    }
+    if (as->note_voice[note] != AS_NO_VOICE) {
+        AutoSampleVoice *old = &as->voices[as->note_voice[note]];
+        old->held = 0;
+        old->release = as->cache->release_coef;
+    }
+
+    AutoSampleVoice *vo = v2_autosample_voice(as);
+    vo->active = 1;
+    vo->note = (uint8_t)note;
+    vo->held = 1;
+    vo->sustained = 0;
+    vo->zone = &as->cache->zones[zone];
+    vo->velocity = velocity;
+    vo->pos = 0.0;
+    vo->inc = powf(2.0f, (note - auto_sample_root(zone)) / 12.0f);
+    auto_sample_layer_gains(velocity, vo->layer_gain);
+    vo->gain = 1.0f;
+    vo->release = 1.0f;
+    vo->age = as->age++;
+    as->note_voice[note] = (uint8_t)(vo - as->voices);
+    as->playing++;
+    as->sampled_notes++;
+    return 1;
+}
+
+/* Note-off: returns 1 if the note was playing on the sampler */
+static int v2_autosample_note_off(obxd_instance_t *inst, int note) {
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (!as) return 0;
+    as->synth_held[note] = 0;
+
+    int v = as->note_voice[note];
+    if (v == AS_NO_VOICE) return 0;
+    as->note_voice[note] = AS_NO_VOICE;
+
+    AutoSampleVoice *vo = &as->voices[v];
+    if (!vo->active || !vo->held || vo->note != note) return 1;
+    if (as->sustain) {
+        vo->sustained = 1;
+    } else {
+        vo->held = 0;
+        vo->release = as->cache->release_coef;
+    }
+    return 1;
+}
+
+static void v2_autosample_sustain(obxd_instance_t *inst, int on) {
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (!as) return;
+    as->sustain = on;
+    if (on) return;
+    for (int v = 0; v < AS_VOICES; v++) {
+        AutoSampleVoice *vo = &as->voices[v];
+        if (vo->active && vo->sustained) {
+            vo->sustained = 0;
+            vo->held = 0;
+            vo->release = as->cache->release_coef;
+        }
+    }
+}
+
+/* CC120/CC123 */
+static void v2_autosample_all_off(obxd_instance_t *inst) {
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (!as) return;
+    for (int v = 0; v < AS_VOICES; v++) {
+        AutoSampleVoice *vo = &as->voices[v];
+        if (vo->active && vo->held) {
+            vo->held = 0;
+            vo->sustained = 0;
+            vo->release = as->cache->release_coef;
+        }
+    }
+    memset(as->note_voice, AS_NO_VOICE, sizeof(as->note_voice));
+}
+
+/*
+ * Block start: hand stale sampler notes back to the engine, take a newly
+ * published cache once no voice reads the current one.
+ */
+static void v2_autosample_block_start(obxd_instance_t *inst, AutoSampler *as) {
+    if (as->playing && as->cache_version != __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE)) {
+        const float fade = expf(logf(AS_SILENCE) / (MOVE_SAMPLE_RATE * AS_HANDBACK_MS * 0.001f));
+        for (int v = 0; v < AS_VOICES; v++) {
+            AutoSampleVoice *vo = &as->voices[v];
+            if (!vo->active || vo->release == fade) continue;
+            if (vo->held && !vo->sustained) {
+                inst->synth->procNoteOn(vo->note, vo->velocity);
+                as->synth_held[vo->note] = 1;
+                as->note_voice[vo->note] = AS_NO_VOICE;
+                as->handbacks++;
+            }
+            vo->held = 0;
+            vo->release = fade;
+        }
+    }
+
+    if (!as->playing && __atomic_load_n(&as->next, __ATOMIC_RELAXED) &&
+        !__atomic_load_n(&as->retired, __ATOMIC_ACQUIRE)) {
+        AutoSampleHandoff *h = __atomic_exchange_n(&as->next, (AutoSampleHandoff*)NULL, __ATOMIC_ACQ_REL);
+        if (h) {
+            AutoSampleCache *old = as->cache;
+            as->cache = h->cache;
+            as->cache_version = h->version;
+            h->cache = old;
+            __atomic_store_n(&as->retired, h, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+/* Mix sampler voices into rendered output */
+static void v2_autosample_mix(obxd_instance_t *inst, AutoSampler *as, int16_t *out_interleaved_lr, int frames) {
+    float mix[MOVE_FRAMES_PER_BLOCK * 2];
+    float scale = inst->output_gain * 32767.0f;
+    for (int pos = 0; pos < frames; pos += MOVE_FRAMES_PER_BLOCK) {
+        int n = frames - pos < MOVE_FRAMES_PER_BLOCK ? frames - pos : MOVE_FRAMES_PER_BLOCK;
+        memset(mix, 0, sizeof(float) * n * 2);
+        as->playing = auto_sample_render(as->cache, as->voices, mix, n);
+        int16_t *out = out_interleaved_lr + pos * 2;
+        for (int i = 0; i < n * 2; i++) {
+            int32_t s = out[i] + (int32_t)(mix[i] * scale);
+            if (s > 32767) s = 32767;
+            if (s < -32768) s = -32768;
+            out[i] = (int16_t)s;
+        }
+    }
+}
+
+/* Block end: smoothed load with hysteresis decides where new notes go */
+static void v2_autosample_update_load(AutoSampler *as, int frames, uint64_t elapsed_ns) {
+    float load = (float)elapsed_ns * 1e-3f / (frames * 1e6f / MOVE_SAMPLE_RATE) * 100.0f;
+    as->load_avg += (load - as->load_avg) * 0.05f;
+    if (!as->pressure && as->load_avg > as->load_pct) as->pressure = 1;
+    else if (as->pressure && as->load_avg < as->load_pct * 0.7f) as->pressure = 0;
+}
+
+/* get_param("autosample") */
+static int v2_autosample_status(obxd_instance_t *inst, char *buf, int buf_len) {
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (!as) return snprintf(buf, buf_len, "{\"enabled\":0}");
+    int ready = as->cache && as->cache_version == __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE);
+    int state = __atomic_load_n(&as->state, __ATOMIC_RELAXED);
+    pthread_mutex_lock(&g_as_lock);
+    const char *reason = as->reason;
+    uint32_t cache_kb = as->cache_kb, builds = as->builds, shared_hits = as->shared_hits;
+    float build_ms = as->build_ms;
+    pthread_mutex_unlock(&g_as_lock);
+    return snprintf(buf, buf_len,
+        "{\"enabled\":%d,\"state\":\"%s\",\"reason\":\"%s\",\"ready\":%d,\"pressure\":%d,"
+        "\"load_avg\":%.1f,\"load_pct\":%.0f,\"playing\":%d,\"cache_kb\":%u,\"build_ms\":%.1f,"
+        "\"builds\":%u,\"shared_hits\":%u,\"sampled_notes\":%u,\"handbacks\":%u}",
+        as->enabled, g_as_state_names[state],
+        state == AS_STATE_INELIGIBLE && reason ? reason : "",
+        ready, as->pressure, as->load_avg, as->load_pct, as->playing,
+        cache_kb, build_ms,
+        builds, shared_hits, as->sampled_notes, as->handbacks);
+}
+
+/* v2 helper: Arena layout as JSON, offsets in bytes from the arena start */
+static int v2_format_layout(obxd_instance_t *inst, char *buf, int buf_len) {
+    const char *base = (const char*)inst;
+    size_t voices = (size_t)((const char*)inst->synth->getVoices() - base);
+    return snprintf(buf, buf_len,
+        "{\"arena_bytes\":%zu,\"align\":%d,\"base_aligned\":%d,"
+        "\"instance\":{\"offset\":0,\"bytes\":%zu,\"hot_bytes\":%zu},"
+        "\"engine\":{\"offset\":%zu,\"bytes\":%zu},"
+        "\"voices\":{\"offset\":%zu,\"stride\":%zu},"
+        "\"cold\":{\"offset\":%zu,\"bytes\":%zu}}",
+        inst->arena_size, ARENA_ALIGN, ((uintptr_t)base % ARENA_ALIGN) == 0,
+        sizeof(obxd_instance_t), offsetof(obxd_instance_t, params),
+        (size_t)((const char*)inst->synth - base), sizeof(SynthEngine),
+        voices, sizeof(ObxdVoice),
+        (size_t)((const char*)inst->cold - base), sizeof(obxd_instance_cold_t));
+}
+
+/* v2 API: Create instance */
+static void* v2_create_instance(const char *module_dir, const char *json_defaults) {
+    (void)json_defaults;
+
+    obxd_instance_t *inst = v2_arena_alloc();
+    if (!inst) return NULL;
+
+    strncpy(inst->cold->module_dir, module_dir, sizeof(inst->cold->module_dir) - 1);
+    inst->output_gain = 0.5f;
+    inst->tempo_bpm = 120.0f;
+    snprintf(inst->cold->preset_name, sizeof(inst->cold->preset_name), "Init");
+    new (&inst->cold->midi_maps[0]) MidiMap();
+    new (&inst->cold->midi_maps[1]) MidiMap();
+    inst->midi_learn_param = -1;
+    inst->stats_budget_pct = 100.0f;
+    inst->kernels = g_kernels;
+
+    new (inst->synth) SynthEngine();
+
+    inst->synth->setSampleRate((float)MOVE_SAMPLE_RATE);
+    inst->synth->setPlayHead(inst->tempo_bpm, 0.0f);
+    inst->oversampling_limit = SynthEngine::OVERSAMPLE_1X;
+    inst->synth->setOversamplingLimit(inst->oversampling_limit);
+
+    v2_init_default_patch(inst);
+
+    /* Scan presets folder for all .fxb banks and load the first */
+    v2_scan_banks(inst, module_dir);
+    inst->cold->cost_index = v2_load_cost_index(module_dir);
+    if (inst->cold->bank_count > 0) {
+        inst->cold->current_bank = -1;  /* Force load */
+        v2_switch_bank(inst, 0);
+    }
+
+    plugin_log("OB-Xd v2: Instance created");
+    plugin_log_drain();
+    return inst;
+}
+
+/* v2 API: Destroy instance */
+static void v2_destroy_instance(void *instance) {
+    obxd_instance_t *inst = (obxd_instance_t*)instance;
+    if (!inst) return;
+
+    v2_autosample_free(inst);
+    inst->synth->~SynthEngine();
+    bank_data_release(inst->cold->bank_data);
+    cost_index_release(inst->cold->cost_index);
+    v2_telemetry_close(inst);
+    free(inst);  /* The whole arena */
+    plugin_log("OB-Xd v2: Instance destroyed");
+    plugin_log_drain();
+}
+
+#define CLONE_WAIT_US 10000     /* How long a rendering source gets to take the copy */
+
+/* Raw copy of the whole instance into a fresh arena - run by whoever owns src */
+static void v2_clone_copy(obxd_instance_t *dst, const obxd_instance_t *src) {
+    SynthEngine *synth = dst->synth;
+    obxd_instance_cold_t *cold = dst->cold;
+    memcpy(dst, src, sizeof(obxd_instance_t));
+    memcpy(cold, src->cold, sizeof(obxd_instance_cold_t));
+    new (synth) SynthEngine(*src->synth);
+    dst->synth = synth;
+    dst->cold = cold;
+}
+
+/*
+ * Ext API: Clone instance - copies engine state and params, shares bank presets.
+ * Control thread; the source may be rendering meanwhile (see the clone handshake).
+ */
+static void* ext_clone_instance(void *instance) {
+    obxd_instance_t *src = (obxd_instance_t*)instance;
+    if (!src || !src->synth) return NULL;
+
+    obxd_instance_t *inst = v2_arena_alloc();
+    if (!inst) return NULL;
+    SynthEngine *synth = inst->synth;
+    obxd_instance_cold_t *cold = inst->cold;
+
+    uint32_t state = OWNER_AUDIO;
+    src->clone_target = inst;
+    if (!__atomic_compare_exchange_n(&src->owner_state, &state, (uint32_t)CLONE_REQUESTED, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        free(inst);
+        plugin_log("OB-Xd v2: Clone failed, another clone of this instance is running");
+        return NULL;
+    }
+
+    int copied = 0;
+    for (int waited = 0; waited < CLAIM_TIMEOUT_US && !copied; waited += 100) {
+        state = __atomic_load_n(&src->owner_state, __ATOMIC_ACQUIRE);
+        if (state == CLONE_DONE) {
+            copied = 1;
+            break;
+        }
+        /* Not rendering: nothing took the request, copy here unless an entry point is running */
+        if (state == CLONE_REQUESTED && waited >= CLONE_WAIT_US && v2_control_claim(src, CLONE_REQUESTED)) {
+            v2_clone_copy(inst, src);
+            copied = 1;
+            break;
+        }
+        usleep(100);
+    }
+
+    /* Withdraw a request nobody took; if the audio thread took it just now, wait it out */
+    state = CLONE_REQUESTED;
+    if (!copied && !__atomic_compare_exchange_n(&src->owner_state, &state, (uint32_t)OWNER_AUDIO, false,
+                                                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        while (__atomic_load_n(&src->owner_state, __ATOMIC_ACQUIRE) == CLONE_COPYING) usleep(100);
+        copied = 1;
+    }
+    v2_control_release(src, OWNER_AUDIO);
+    if (!copied) {
+        free(inst);
+        plugin_log("OB-Xd v2: Clone failed, source busy");
+        return NULL;
+    }
+    inst->synth = synth;
+    inst->cold = cold;
+    inst->arena_size = ARENA_SIZE;
+    inst->audio_seq = 0;
+    inst->owner_state = OWNER_AUDIO;
+    inst->render_ns = 0;
+    inst->clone_target = NULL;
+
+    /* History is the source's: the clone starts with empty stats and trace */
+    memset(&inst->stats, 0, sizeof(inst->stats));
+    synth->resetTrace();
+    cold->trace_cursor = 0;
+    cold->trace_lost = 0;
+
+    /* Queued work stays with the source, the clone starts with empty queues */
+    inst->batch_read = inst->batch_write = 0;
+    inst->pending_midi_count = 0;
+    cold->pending_sysex_len = 0;
+    inst->midi_learn_param = -1;
+    inst->telemetry = NULL;
+    cold->telemetry_shm[0] = '\0';
+    bank_data_retain(inst->cold->bank_data);
+    cost_index_retain(inst->cold->cost_index);
+
+    /* Own sampler state; the cache itself is shared once the worker finds it */
+    inst->autosample = NULL;
+    if (src->autosample) {
+        AutoSampler *as = v2_autosample_state(inst);
+        if (as) as->load_pct = src->autosample->load_pct;
+        v2_autosample_enable(inst, src->autosample->enabled);
+    }
+
+    plugin_log("OB-Xd v2: Instance cloned");
+    return inst;
+}
+
+/*
+ * CC map ownership. Only the control thread writes the map: it edits the
+ * spare copy and publishes it by flipping midi_map_live, then waits out an
+ * audio call that may still be reading the old copy. A learn on the audio
+ * thread is posted in midi_learned instead; it overrides the lookup until
+ * the control thread folds it into the map on its next get_param/set_param.
+ */
+#define V2_LEARNED(cc, param) (0x80000000u | ((uint32_t)(cc) << 16) | (uint32_t)(param))
+#define V2_LEARNED_CC(l) ((int)(((l) >> 16) & 0x7F))
+#define V2_LEARNED_PARAM(l) ((int)((l) & 0xFFFF))
+
+/* Control thread: the spare CC map, a copy of the live one, to edit and then publish */
+static MidiMap* v2_midi_map_edit(obxd_instance_t *inst) {
+    MidiMap *maps = inst->cold->midi_maps;
+    maps[inst->midi_map_live ^ 1] = maps[inst->midi_map_live];
+    return &maps[inst->midi_map_live ^ 1];
+}
+
+/* Control thread: make the edited CC map live; the old one is free again on return */
+static void v2_midi_map_publish(obxd_instance_t *inst) {
+    __atomic_store_n(&inst->midi_map_live, inst->midi_map_live ^ 1, __ATOMIC_SEQ_CST);
+    uint32_t seq = __atomic_load_n(&inst->audio_seq, __ATOMIC_SEQ_CST);
+    if (seq & 1) {
+        while (__atomic_load_n(&inst->audio_seq, __ATOMIC_ACQUIRE) == seq) usleep(50);
+    }
+}
+
+/* Control thread: fold a learn result posted by the audio thread into the map */
+static void v2_midi_map_sync(obxd_instance_t *inst) {
+    uint32_t learned = __atomic_load_n(&inst->midi_learned, __ATOMIC_ACQUIRE);
+    while (learned) {
+        v2_midi_map_edit(inst)->updateCC(V2_LEARNED_PARAM(learned), V2_LEARNED_CC(learned));
+        v2_midi_map_publish(inst);
+        if (__atomic_compare_exchange_n(&inst->midi_learned, &learned, 0u, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+}
+
+/* v2 helper: Controller CC - learn, or one table lookup into the engine setters */
+static void v2_handle_cc(obxd_instance_t *inst, int cc, int value) {
+    if (MidiMap::reserved(cc)) return;
+    int learn = __atomic_load_n(&inst->midi_learn_param, __ATOMIC_ACQUIRE);
+    if (learn >= 0 && __atomic_compare_exchange_n(&inst->midi_learn_param, &learn, -1, false,
+                                                  __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&inst->midi_learned, V2_LEARNED(cc, learn), __ATOMIC_RELEASE);
+        v2_mark_changed(inst);
+        return;
+    }
+    uint32_t live = __atomic_load_n(&inst->midi_map_live, __ATOMIC_ACQUIRE);
+    int param_idx = inst->cold->midi_maps[live].lookup(cc);
+    uint32_t learned = __atomic_load_n(&inst->midi_learned, __ATOMIC_ACQUIRE);
+    if (learned) {
+        /* Pending learn: the param lives on its new CC only */
+        if (cc == V2_LEARNED_CC(learned)) param_idx = V2_LEARNED_PARAM(learned);
+        else if (param_idx == V2_LEARNED_PARAM(learned)) param_idx = -1;
+    }
+    if (param_idx > MIDILEARN) {
+        v2_apply_param_direct(inst, param_idx, value / 127.0f);
+    }
+}
+
+/* v2 helper: Apply a whole patch, only touching params whose value changed */
+static void v2_apply_patch_diff(obxd_instance_t *inst, const float *values, int count) {
+    if (count > PARAM_COUNT) count = PARAM_COUNT;
+    for (int i = 0; i < count; i++) {
+        if (values[i] != inst->params[i]) {
+            v2_apply_param_direct(inst, i, values[i]);
+        }
+    }
+}
+
+/* v2 helper: SysEx - OB-Xd bulk patch dump (see patch_sysex.h) */
+static void v2_handle_sysex(obxd_instance_t *inst, const uint8_t *msg, int len) {
+    float values[PARAM_COUNT];
+    char name[PATCH_SYSEX_NAME_MAX + 1];
+
+    memcpy(values, inst->params, sizeof(values));
+    int count = patch_sysex_decode(msg, len, values, PARAM_COUNT, name);
+    if (count < 0) return;
+
+    v2_apply_patch_diff(inst, values, count);
+    if (name[0]) {
+        snprintf(inst->cold->preset_name, sizeof(inst->cold->preset_name), "%s", name);
+        v2_mark_changed(inst);
+    }
+}
+
+/* v2 helper: Dispatch one MIDI message to the engine */
+static void v2_dispatch_midi(obxd_instance_t *inst, const uint8_t *msg, int len, int source) {
+    if (len < 2) return;
+
+    if (msg[0] == 0xF0) {
+        v2_handle_sysex(inst, msg, len);
+        return;
+    }
+
+    uint8_t status = msg[0] & 0xF0;
+    uint8_t data1 = msg[1];
+    uint8_t data2 = (len > 2) ? msg[2] : 0;
+
+    int note = data1;
+    if (status == 0x90 || status == 0x80) {
+        note += inst->octave_transpose * 12;
+        if (note < 0) note = 0;
+        if (note > 127) note = 127;
+    }
+
+    switch (status) {
+        case 0x90:
+            if (data2 > 0) {
+                if (!v2_autosample_note_on(inst, note, data2 / 127.0f)) {
+                    inst->synth->procNoteOn(note, data2 / 127.0f);
+                }
+            } else if (!v2_autosample_note_off(inst, note)) {
+                inst->synth->procNoteOff(note);
             }
             break;
         case 0x80:
-            inst->synth->procNoteOff(note);
+            if (!v2_autosample_note_off(inst, note)) {
+                inst->synth->procNoteOff(note);
+            }
             break;
         case 0xB0:
             switch (data1) {
-                case 1: inst->synth->procModWheel(data2 / 127.0f); break;
+                case 1:
+                    inst->synth->procModWheel(data2 / 127.0f);
+                    if (inst->autosample) inst->autosample->modwheel = data2;
+                    break;
                 case 64:
                     if (data2 >= 64) inst->synth->sustainOn();
                     else inst->synth->sustainOff();
+                    v2_autosample_sustain(inst, data2 >= 64);
+                    break;
+                case 120:   /* All sound off: also cut the release tails */
+                    v2_autosample_all_off(inst);
+                    inst->synth->allSoundOff();
+                    break;
+                case 123:   /* All notes off */
+                    v2_autosample_all_off(inst);
+                    inst->synth->allNotesOff();
+                    break;
+                default:
+                    /* Move's own knobs arrive as internal CCs - those are routed via set_param */
+                    if (source != MOVE_MIDI_SOURCE_INTERNAL) v2_handle_cc(inst, data1, data2);
                     break;
             }
             break;
         case 0xE0: {
             int bend = ((data2 << 7) | data1) - 8192;
             inst->synth->procPitchWheel(bend / 8192.0f);
+            if (inst->autosample) inst->autosample->bend = bend;
             break;
         }
     }
 }
 
+/* v2 API: MIDI handler */
+static void v2_on_midi(void *instance, const uint8_t *msg, int len, int source) {
+    obxd_instance_t *inst = (obxd_instance_t*)instance;
+    if (!inst || !inst->synth) return;
+    if (!v2_audio_begin(inst)) return;
+    v2_dispatch_midi(inst, msg, len, source);
+    v2_audio_end(inst);
+}
+
+/* v2 helper: Dispatch one queued on_midi_batch event */
+static inline void v2_dispatch_queued(obxd_instance_t *inst, const obxd_midi_event_t *e) {
+    v2_dispatch_midi(inst, e->len > 3 ? e->sysex : e->data, e->len, e->source);
+}
+
+/*
+ * v2 helper: Queue full - play what is queued now, in order, so the next
+ * event cannot overtake a note-off. Timing is lost, notes are not.
+ */
+static void v2_flush_pending_midi(obxd_instance_t *inst) {
+    for (int q = 0; q < inst->pending_midi_count; q++) {
+        v2_dispatch_queued(inst, &inst->cold->pending_midi[q]);
+    }
+    inst->pending_midi_count = 0;
+    inst->cold->pending_sysex_len = 0;
+    inst->stats.midi_overflows++;
+}
+
+/* Ext API: Batched MIDI - queued for sample-accurate dispatch, SysEx as a copy */
+static void ext_on_midi_batch(void *instance, const obxd_midi_event_t *events, int count) {
+    obxd_instance_t *inst = (obxd_instance_t*)instance;
+    if (!inst || !events) return;
+
+    if (!v2_audio_begin(inst)) return;
+    obxd_instance_cold_t *cold = inst->cold;
+    for (int i = 0; i < count; i++) {
+        const obxd_midi_event_t *ev = &events[i];
+        if (ev->len > 3 && !ev->sysex) continue;
+        int sysex_len = ev->len > 3 ? ev->len : 0;
+        if (inst->pending_midi_count == MAX_PENDING_MIDI ||
+            (inst->pending_midi_count > 0 && cold->pending_sysex_len + sysex_len > MAX_PENDING_SYSEX)) {
+            v2_flush_pending_midi(inst);
+        }
+        if (sysex_len > MAX_PENDING_SYSEX) {
+            /* Larger than the whole buffer: everything before it has just played */
+            v2_dispatch_midi(inst, ev->sysex, ev->len, ev->source);
+            continue;
+        }
+        obxd_midi_event_t *q = &cold->pending_midi[inst->pending_midi_count++];
+        *q = *ev;
+        if (sysex_len) {
+            q->sysex = cold->pending_sysex + cold->pending_sysex_len;
+            memcpy(cold->pending_sysex + cold->pending_sysex_len, ev->sysex, sysex_len);
+            cold->pending_sysex_len += sysex_len;
+        }
+    }
+    v2_audio_end(inst);
+}
+
 /* v2 helper: Apply param directly to engine using ParamsEnum index */
 static void v2_apply_param_direct(obxd_instance_t *inst, int param_idx, float value) {
     if (param_idx < 0 || param_idx >= PARAM_COUNT) return;
@@ -744,7 +2385,13 @@ static void v2_apply_param_direct(obxd_instance_t *inst, int param_idx, float va
 
     /* Store value for state serialization */
     inst->params[param_idx] = value;
+    v2_mark_changed(inst);
 
+    v2_engine_set(synth, param_idx, value);
+}
+
+/* v2 helper: Route one ParamsEnum value to its engine setter */
+static void v2_engine_set(SynthEngine *synth, int param_idx, float value) {
     switch (param_idx) {
         /* Global */
         case VOLUME:        synth->processVolume(value); break;
@@ -785,6 +2432,7 @@ static void v2_apply_param_direct(obxd_instance_t *inst, int param_idx, float va
         case ENVELOPE_AMT:  synth->processFilterEnvelopeAmt(value); break;
         case FLT_KF:        synth->processFilterKeyFollow(value); break;
         case MULTIMODE:     synth->processMultimode(value); break;
+        case FILTER_WARM:   synth->processOversampling(value); break;
         case BANDPASS:      synth->processBandpassSw(value); break;
         case FOURPOLE:      synth->processFourPole(value); break;
         case SELF_OSC_PUSH: synth->processSelfOscPush(value); break;
@@ -825,11 +2473,62 @@ static void v2_apply_param_direct(obxd_instance_t *inst, int param_idx, float va
         case ENV_PITCH_BOTH:synth->processPitchModBoth(value); break;
         case BENDRANGE:     synth->procPitchWheelAmount(value); break;
         case BENDLFORATE:   synth->procModWheelFrequency(value); break;
+        case BENDOSC2:      synth->procPitchWheelOsc2Only(value); break;
+
+        /* Not exposed in the shadow UI - reachable through the CC map */
+        case ASPLAYEDALLOCATION: synth->procAsPlayedAlloc(value); break;
+        case OSCQuantize:   synth->processPitchQuantization(value); break;
+        case ENVDER:        synth->processEnvelopeDetune(value); break;
+        case FILTERDER:     synth->processFilterDetune(value); break;
+        case PORTADER:      synth->processPortamentoDetune(value); break;
+        case LEVEL_DIF:     synth->processLoudnessDetune(value); break;
+        case ECONOMY_MODE:  synth->procEconomyMode(value); break;
+        case PAN1: case PAN2: case PAN3: case PAN4:
+        case PAN5: case PAN6: case PAN7: case PAN8:
+                            synth->processPan(value, param_idx - PAN1 + 1); break;
 
         default: break;
     }
 }
 
+/* v2 helper: Serialize CC mappings that differ from the defaults as "cc=TAG,cc=-" */
+static int v2_format_cc_map(obxd_instance_t *inst, char *buf, int buf_len) {
+    v2_midi_map_sync(inst);
+    const MidiMap *map = &inst->cold->midi_maps[inst->midi_map_live];
+    int offset = 0;
+    buf[0] = '\0';
+    for (int cc = 0; cc < MidiMap::CC_COUNT && offset < buf_len - 32; cc++) {
+        if (map->controllers[cc] == map->controllers_default[cc]) continue;
+        const char *tag = map->controllers[cc] < 0 ? "-" : map->getTag(map->controllers[cc]);
+        offset += snprintf(buf + offset, buf_len - offset, "%s%d=%s",
+                           offset > 0 ? "," : "", cc, tag);
+    }
+    return offset;
+}
+
+/* v2 helper: Restore CC mappings from defaults plus a "cc=TAG,cc=-" override list; unknown tags are skipped */
+static void v2_parse_cc_map(obxd_instance_t *inst, const char *val) {
+    v2_midi_map_sync(inst);
+    MidiMap *map = v2_midi_map_edit(inst);
+    map->restoreDefaults();
+    const char *p = val;
+    while (*p) {
+        char *end;
+        long cc = strtol(p, &end, 10);
+        if (end == p || *end != '=') break;
+        const char *tag = end + 1;
+        int tag_len = strcspn(tag, ",");
+        int param = (tag_len == 1 && tag[0] == '-') ? -1 : map->getParaId(tag, tag_len);
+        bool known = param >= 0 || (tag_len == 1 && tag[0] == '-');
+        if (cc >= 0 && cc < MidiMap::CC_COUNT && !MidiMap::reserved(cc) && known) {
+            map->controllers[cc] = param;
+        }
+        p = tag + tag_len;
+        if (*p == ',') p++;
+    }
+    v2_midi_map_publish(inst);
+}
+
 /* v2 API: Set parameter */
 /* Helper to extract a JSON string value by key */
 static int json_get_string(const char *json, const char *key, char *out, int out_len) {
@@ -859,19 +2558,150 @@ static int json_get_number(const char *json, const char *key, float *out) {
     return 0;
 }
 
+/* Look up a shadow param definition by key */
+static const param_def_t* v2_find_shadow_param(const char *key, int key_len) {
+    for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params); i++) {
+        if (strncmp(key, g_shadow_params[i].key, key_len) == 0 &&
+            g_shadow_params[i].key[key_len] == '\0') {
+            return &g_shadow_params[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * v2 helper: A direct write on the control thread is newer than anything
+ * already queued, so queued batches must not undo it when render drains
+ * them. Stamp the param (or, with -1, every param) with the last queued
+ * seq; the drain skips writes from batches at or before the stamp.
+ */
+static void v2_supersede_batches(obxd_instance_t *inst, int param_idx) {
+    if (param_idx < 0) {
+        __atomic_store_n(&inst->cold->batch_superseded, inst->cold->batch_seq, __ATOMIC_RELEASE);
+    } else if (param_idx < PARAM_COUNT) {
+        __atomic_store_n(&inst->cold->param_stamp[param_idx], inst->cold->batch_seq, __ATOMIC_RELEASE);
+    }
+}
+
+/* Sequence order that survives wraparound */
+static inline bool v2_seq_after(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+/* v2 helper: Apply all queued params_batch writes - called at block start */
+static void v2_drain_param_batches(obxd_instance_t *inst) {
+    uint32_t r = inst->batch_read;
+    uint32_t w = __atomic_load_n(&inst->batch_write, __ATOMIC_ACQUIRE);
+    uint32_t superseded = __atomic_load_n(&inst->cold->batch_superseded, __ATOMIC_ACQUIRE);
+    while (r != w) {
+        const ParamBatch *b = &inst->cold->batches[r % PARAM_BATCH_SLOTS];
+        for (int i = 0; i < b->count && v2_seq_after(b->seq, superseded); i++) {
+            int idx = b->changes[i].index;
+            if (!v2_seq_after(b->seq, __atomic_load_n(&inst->cold->param_stamp[idx], __ATOMIC_ACQUIRE))) continue;
+            v2_apply_param_direct(inst, idx, b->changes[i].value);
+        }
+        r++;
+    }
+    __atomic_store_n(&inst->batch_read, r, __ATOMIC_RELEASE);
+}
+
+/* v2 helper: Wait for render to free a params_batch slot; false if it is not draining */
+static bool v2_wait_batch_slot(obxd_instance_t *inst) {
+    for (int waited = 0; waited < PARAM_BATCH_WAIT_US; waited += 100) {
+        uint32_t r = __atomic_load_n(&inst->batch_read, __ATOMIC_ACQUIRE);
+        if (inst->batch_write - r < PARAM_BATCH_SLOTS) return true;
+        uint64_t last = __atomic_load_n(&inst->render_ns, __ATOMIC_RELAXED);
+        if (v2_now_ns() - last > PARAM_BATCH_WAIT_US * 1000ull) return false;
+        usleep(100);
+    }
+    return false;
+}
+
+/*
+ * v2 helper: Parse "key=value,key=value,..." and queue it as one batch.
+ * Keys are resolved and values clamped here so render only does the apply.
+ * The ring has one producer and one consumer. When it is full and render
+ * is running, wait for the next block to free a slot. When render is not
+ * draining, claim the instance under the audio-idle check and apply the
+ * queued batches, then this one, in order on the control thread. Only if
+ * the claim never succeeds is the batch refused and counted (get_param
+ * "params_batch_dropped").
+ */
+static void v2_queue_param_batch(obxd_instance_t *inst, const char *val) {
+    bool owned = false;
+    uint32_t r = __atomic_load_n(&inst->batch_read, __ATOMIC_ACQUIRE);
+    if (inst->batch_write - r >= PARAM_BATCH_SLOTS && !v2_wait_batch_slot(inst)) {
+        for (int waited = 0; waited < CLAIM_TIMEOUT_US && !owned; waited += 100) {
+            owned = v2_control_claim(inst, OWNER_AUDIO);
+            if (!owned) usleep(100);
+        }
+        if (!owned) {
+            __atomic_add_fetch(&inst->cold->batch_dropped, 1, __ATOMIC_RELAXED);
+            plugin_log("params_batch dropped: ring full and the instance stays busy");
+            return;
+        }
+        v2_drain_param_batches(inst);
+    }
+
+    uint32_t w = inst->batch_write;
+
+    ParamBatch *b = &inst->cold->batches[w % PARAM_BATCH_SLOTS];
+    b->count = 0;
+
+    const char *p = val;
+    while (*p && b->count < PARAM_COUNT) {
+        while (*p == ',' || *p == ' ') p++;
+        const char *eq = strchr(p, '=');
+        if (!eq) break;
+        const param_def_t *def = v2_find_shadow_param(p, (int)(eq - p));
+        char value[32];
+        int value_len = (int)strcspn(eq + 1, ",");
+        snprintf(value, sizeof(value), "%.*s", value_len, eq + 1);
+        float fval;
+        if (def && param_helper_parse(def, value, &fval) == 0) {
+            b->changes[b->count].index = def->index;
+            b->changes[b->count].value = fval;
+            b->count++;
+        }
+        p = strchr(eq, ',');
+        if (!p) break;
+    }
+
+    if (b->count > 0) {
+        b->seq = ++inst->cold->batch_seq;
+        __atomic_store_n(&inst->batch_write, w + 1, __ATOMIC_RELEASE);
+    }
+    if (owned) {
+        v2_drain_param_batches(inst);
+        v2_control_release(inst, OWNER_AUDIO);
+        plugin_log("params_batch applied directly: render is not draining");
+    }
+}
+
+/* v2 helper: Oversampling rung by name ("2x-fast") or index, -1 if unknown */
+static int v2_find_oversampling(const char *name) {
+    for (int i = 0; i < SynthEngine::OVERSAMPLE_RUNGS; i++) {
+        if (strcmp(g_oversampling_names[i], name) == 0) return i;
+    }
+    if (name[0] >= '0' && name[0] < '0' + SynthEngine::OVERSAMPLE_RUNGS && name[1] == '\0') return name[0] - '0';
+    return -1;
+}
+
 static void v2_set_param(void *instance, const char *key, const char *val) {
     obxd_instance_t *inst = (obxd_instance_t*)instance;
     if (!inst) return;
+    v2_autosample_publish(inst);
 
     /* State restore from patch save */
     if (strcmp(key, "state") == 0) {
         float fval;
+        v2_supersede_batches(inst, -1);
 
         /* Restore bank by name (robust against .fxb files being added/removed) */
         char saved_bank[64] = "";
         if (json_get_string(val, "bank_name", saved_bank, sizeof(saved_bank)) == 0 && saved_bank[0]) {
-            for (int i = 0; i < inst->bank_count; i++) {
-                if (strcmp(inst->banks[i].name, saved_bank) == 0) {
+            for (int i = 0; i < inst->cold->bank_count; i++) {
+                if (strcmp(inst->cold->banks[i].name, saved_bank) == 0) {
                     v2_switch_bank(inst, i);
                     break;
                 }
@@ -879,15 +2709,15 @@ static void v2_set_param(void *instance, const char *key, const char *val) {
         } else if (json_get_number(val, "bank_index", &fval) == 0) {
             /* Fallback for old state that only saved bank_index */
             int idx = (int)fval;
-            if (idx >= 0 && idx < inst->bank_count) {
+            if (idx >= 0 && idx < inst->cold->bank_count) {
                 v2_switch_bank(inst, idx);
             }
         }
 
         if (json_get_number(val, "preset", &fval) == 0) {
             int idx = (int)fval;
-            if (idx >= 0 && idx < inst->preset_count) {
-                inst->current_preset = idx;
+            if (idx >= 0 && idx < inst->cold->preset_count) {
+                inst->cold->current_preset = idx;
                 v2_apply_preset(inst, idx);
             }
         }
@@ -897,6 +2727,7 @@ static void v2_set_param(void *instance, const char *key, const char *val) {
             inst->octave_transpose = (int)fval;
             if (inst->octave_transpose < -3) inst->octave_transpose = -3;
             if (inst->octave_transpose > 3) inst->octave_transpose = 3;
+            v2_mark_changed(inst);
         }
 
         /* Restore all shadow params */
@@ -907,51 +2738,175 @@ static void v2_set_param(void *instance, const char *key, const char *val) {
                 v2_apply_param_direct(inst, g_shadow_params[i].index, fval);
             }
         }
+
+        /* Restore learned CC mappings (absent = defaults) */
+        char cc_map[2048];
+        if (json_get_string(val, "cc_map", cc_map, sizeof(cc_map)) == 0) {
+            v2_parse_cc_map(inst, cc_map);
+        }
+        return;
+    }
+
+    /* MIDI learn: next external CC gets mapped to this shadow param */
+    if (strcmp(key, "midi_learn") == 0) {
+        const param_def_t *def = v2_find_shadow_param(val, strlen(val));
+        v2_midi_map_sync(inst);
+        __atomic_store_n(&inst->midi_learn_param, def ? def->index : -1, __ATOMIC_RELEASE);
+        return;
+    }
+    if (strcmp(key, "cc_map") == 0) {
+        v2_parse_cc_map(inst, val);
+        v2_mark_changed(inst);
+        return;
+    }
+    if (strcmp(key, "stats_reset") == 0) {
+        __atomic_add_fetch(&inst->stats_reset_request, 1, __ATOMIC_RELEASE);
+        return;
+    }
+    if (strcmp(key, "stats_budget_pct") == 0) {
+        float pct = atof(val);
+        if (pct > 0.0f) inst->stats_budget_pct = pct;
+        return;
+    }
+    if (strcmp(key, "autosample") == 0) {
+        v2_autosample_enable(inst, atoi(val) != 0);
+        return;
+    }
+    if (strcmp(key, "autosample_load_pct") == 0) {
+        float pct = atof(val);
+        AutoSampler *as = pct > 0.0f ? v2_autosample_state(inst) : NULL;
+        if (as) as->load_pct = pct;
+        return;
+    }
+    if (strcmp(key, "oversampling_limit") == 0) {
+        int rung = v2_find_oversampling(val);
+        if (rung >= 0 && inst->synth) {
+            inst->oversampling_limit = rung;
+            inst->synth->setOversamplingLimit(rung);
+            v2_mark_changed(inst);
+        }
+        return;
+    }
+    if (strcmp(key, "kernel_variant") == 0) {
+        const KernelVariant *k = v2_find_kernels(val);
+        if (k) __atomic_store_n(&inst->kernels, k, __ATOMIC_RELAXED);
+        return;
+    }
+    if (strcmp(key, "cc_map_reset") == 0) {
+        __atomic_store_n(&inst->midi_learn_param, -1, __ATOMIC_RELEASE);
+        v2_midi_map_sync(inst);
+        v2_midi_map_edit(inst)->restoreDefaults();
+        v2_midi_map_publish(inst);
+        v2_mark_changed(inst);
+        return;
+    }
+
+    /* Several params applied together at the next block boundary */
+    if (strcmp(key, "params_batch") == 0) {
+        v2_queue_param_batch(inst, val);
         return;
     }
 
     if (strcmp(key, "preset") == 0) {
         int idx = atoi(val);
-        if (idx >= 0 && idx < inst->preset_count && idx != inst->current_preset) {
-            inst->current_preset = idx;
+        if (idx >= 0 && idx < inst->cold->preset_count && idx != inst->cold->current_preset) {
+            inst->cold->current_preset = idx;
+            v2_supersede_batches(inst, -1);
             v2_apply_preset(inst, idx);
         }
     }
     else if (strcmp(key, "bank_index") == 0) {
         int idx = atoi(val);
+        v2_supersede_batches(inst, -1);
         v2_switch_bank(inst, idx);
     }
     else if (strcmp(key, "octave_transpose") == 0) {
         inst->octave_transpose = atoi(val);
         if (inst->octave_transpose < -3) inst->octave_transpose = -3;
         if (inst->octave_transpose > 3) inst->octave_transpose = 3;
+        v2_mark_changed(inst);
     }
     else if (strcmp(key, "param_bank") == 0) {
-        inst->param_bank = atoi(val);
-        if (inst->param_bank < 0) inst->param_bank = 0;
-        if (inst->param_bank > 2) inst->param_bank = 2;
+        inst->cold->param_bank = atoi(val);
+        if (inst->cold->param_bank < 0) inst->cold->param_bank = 0;
+        if (inst->cold->param_bank > 2) inst->cold->param_bank = 2;
     }
     else if (strncmp(key, "param_", 6) == 0) {
         int idx = atoi(key + 6);
         if (idx >= 0 && idx < 8) {
             float fval = atof(val);
-            v2_apply_param(inst, inst->param_bank, idx, fval);
+            v2_apply_param(inst, inst->cold->param_bank, idx, fval);
         }
     }
     else {
         /* Named parameter access via helper (for shadow UI) */
-        float fval = (float)atof(val);
-        /* Find the param and apply it */
-        for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params); i++) {
-            if (strcmp(key, g_shadow_params[i].key) == 0) {
-                /* Clamp value */
-                if (fval < g_shadow_params[i].min_val) fval = g_shadow_params[i].min_val;
-                if (fval > g_shadow_params[i].max_val) fval = g_shadow_params[i].max_val;
-                v2_apply_param_direct(inst, g_shadow_params[i].index, fval);
-                return;
-            }
+        float fval = 0.0f;
+        /* Find the param and apply it - clamped, or an enum option by name */
+        const param_def_t *def = v2_find_shadow_param(key, strlen(key));
+        if (def) {
+            if (param_helper_parse(def, val, &fval) != 0) param_helper_parse(def, "0", &fval);
+            v2_supersede_batches(inst, def->index);
+            v2_apply_param_direct(inst, def->index, fval);
+        }
+    }
+}
+
+/* v2 helper: Build the params_snapshot JSON - all shadow params plus preset/bank info */
+static int v2_build_snapshot(obxd_instance_t *inst, uint32_t version, char *buf, int buf_len) {
+    const char *bname = (inst->cold->current_bank >= 0 && inst->cold->current_bank < inst->cold->bank_count)
+        ? inst->cold->banks[inst->cold->current_bank].name : "OB-Xd";
+    int offset = snprintf(buf, buf_len,
+        "{\"v\":%u,\"preset\":%d,\"preset_count\":%d,\"preset_name\":\"%s\","
+        "\"bank_index\":%d,\"bank_count\":%d,\"bank_name\":\"%s\",\"octave_transpose\":%d",
+        version, inst->cold->current_preset, inst->cold->preset_count, inst->cold->preset_name,
+        inst->cold->current_bank, inst->cold->bank_count, bname, inst->octave_transpose);
+
+    for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params) && offset < buf_len; i++) {
+        float val = inst->params[g_shadow_params[i].index];
+        if (g_shadow_params[i].type == PARAM_TYPE_ENUM) {
+            char option[32];
+            param_helper_format(&g_shadow_params[i], val, option, sizeof(option));
+            offset += snprintf(buf + offset, buf_len - offset,
+                ",\"%s\":\"%s\"", g_shadow_params[i].key, option);
+        } else if (g_shadow_params[i].type == PARAM_TYPE_INT) {
+            offset += snprintf(buf + offset, buf_len - offset,
+                ",\"%s\":%d", g_shadow_params[i].key, (int)val);
+        } else {
+            offset += snprintf(buf + offset, buf_len - offset,
+                ",\"%s\":%.3f", g_shadow_params[i].key, val);
         }
     }
+    if (offset < buf_len) offset += snprintf(buf + offset, buf_len - offset, "}");
+    if (offset >= buf_len) return -1;
+    return offset;
+}
+
+/*
+ * v2 helper: Voice trace events since the last dump, as
+ *   "obxd-trace 1 <sample_rate> <lost>\n" + 16 hex chars per event
+ * (time, type, voice, note, aux). Events that don't fit stay for the next call.
+ */
+static int v2_dump_trace(obxd_instance_t *inst, char *buf, int buf_len) {
+    VoiceTraceEvent events[VoiceTrace::SIZE];
+    static const char hex[] = "0123456789abcdef";
+
+    int max_events = (buf_len - 64) / 16;
+    if (max_events <= 0) return -1;
+    if (max_events > VoiceTrace::SIZE) max_events = VoiceTrace::SIZE;
+
+    int n = inst->synth->getTrace().read(&inst->cold->trace_cursor, events, max_events, &inst->cold->trace_lost);
+    int len = snprintf(buf, buf_len, "obxd-trace 1 %d %u\n", MOVE_SAMPLE_RATE, inst->cold->trace_lost);
+    inst->cold->trace_lost = 0;
+
+    for (int i = 0; i < n; i++) {
+        const VoiceTraceEvent *e = &events[i];
+        uint32_t tail = ((uint32_t)e->type << 24) | ((uint32_t)e->voice << 16) |
+                        ((uint32_t)e->note << 8) | e->aux;
+        for (int b = 7; b >= 0; b--) buf[len++] = hex[(e->time >> (b * 4)) & 0xF];
+        for (int b = 7; b >= 0; b--) buf[len++] = hex[(tail >> (b * 4)) & 0xF];
+    }
+    buf[len] = '\0';
+    return len;
 }
 
 /* v2 API: Get parameter */
@@ -959,38 +2914,124 @@ static int v2_get_param(void *instance, const char *key, char *buf, int buf_len)
     obxd_instance_t *inst = (obxd_instance_t*)instance;
     if (!inst) return -1;
 
+    /* UI polls are the regular non-RT tick that flushes queued log records */
+    plugin_log_drain();
+    v2_autosample_publish(inst);
+
+    /* UI polling: check params_version first, only fetch params_snapshot when it moved */
+    if (strcmp(key, "params_version") == 0) {
+        return snprintf(buf, buf_len, "%u", __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE));
+    }
+    if (strcmp(key, "params_batch_dropped") == 0) {
+        return snprintf(buf, buf_len, "%u", __atomic_load_n(&inst->cold->batch_dropped, __ATOMIC_RELAXED));
+    }
+    if (strcmp(key, "trace") == 0) {
+        return v2_dump_trace(inst, buf, buf_len);
+    }
+    if (strcmp(key, "stats") == 0) {
+        return v2_format_stats(inst, buf, buf_len);
+    }
+    if (strcmp(key, "stats_budget_pct") == 0) {
+        return snprintf(buf, buf_len, "%.0f", inst->stats_budget_pct);
+    }
+    if (strcmp(key, "layout") == 0) {
+        return v2_format_layout(inst, buf, buf_len);
+    }
+    if (strcmp(key, "telemetry_shm") == 0) {
+        v2_telemetry_get(inst);
+        return snprintf(buf, buf_len, "%s", inst->cold->telemetry_shm);
+    }
+    if (strcmp(key, "kernel_variant") == 0) {
+        return snprintf(buf, buf_len, "%s", inst->kernels->name);
+    }
+    if (strcmp(key, "autosample") == 0) {
+        return v2_autosample_status(inst, buf, buf_len);
+    }
+    if (strcmp(key, "oversampling_limit") == 0) {
+        return snprintf(buf, buf_len, "%s", g_oversampling_names[inst->oversampling_limit]);
+    }
+    if (strcmp(key, "oversampling_active") == 0) {
+        return snprintf(buf, buf_len, "%s", g_oversampling_names[inst->synth->getOversamplingRung()]);
+    }
+    /* Variants this CPU can run, best first */
+    if (strcmp(key, "kernel_variants") == 0) {
+        int pos = snprintf(buf, buf_len, "[");
+        for (int i = 0; i < KERNEL_VARIANT_COUNT && pos < buf_len; i++) {
+            if (!g_kernel_variants[i].supported()) continue;
+            pos += snprintf(buf + pos, buf_len - pos, "%s\"%s\"", pos > 1 ? "," : "", g_kernel_variants[i].name);
+        }
+        if (pos >= buf_len - 1) return -1;
+        pos += snprintf(buf + pos, buf_len - pos, "]");
+        return pos;
+    }
+    if (strcmp(key, "params_snapshot") == 0) {
+        uint32_t version = __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE);
+        if (inst->cold->snapshot_len == 0 || inst->cold->snapshot_version != version) {
+            int len = v2_build_snapshot(inst, version, inst->cold->snapshot, sizeof(inst->cold->snapshot));
+            if (len < 0) return -1;
+            inst->cold->snapshot_len = len;
+            inst->cold->snapshot_version = version;
+        }
+        if (inst->cold->snapshot_len >= buf_len) return -1;
+        memcpy(buf, inst->cold->snapshot, inst->cold->snapshot_len + 1);
+        return inst->cold->snapshot_len;
+    }
+
     if (strcmp(key, "preset") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->current_preset);
+        return snprintf(buf, buf_len, "%d", inst->cold->current_preset);
     }
     if (strcmp(key, "preset_count") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->preset_count);
+        return snprintf(buf, buf_len, "%d", inst->cold->preset_count);
     }
     if (strcmp(key, "preset_name") == 0) {
-        return snprintf(buf, buf_len, "%s", inst->preset_name);
+        return snprintf(buf, buf_len, "%s", inst->cold->preset_name);
+    }
+    /* Surveyed render cost of the current preset, -1 if not in the cost index */
+    if (strcmp(key, "preset_cost") == 0) {
+        const PresetCost *c = v2_find_cost(inst, inst->cold->current_preset);
+        if (!c) return -1;
+        return snprintf(buf, buf_len,
+                        "{\"avg_us\":%.2f,\"peak_us\":%.2f,\"idle_us\":%.2f,\"block_us\":%.2f,"
+                        "\"rel\":%.2f,\"class\":\"%s\"}",
+                        c->avg_us, c->peak_us, c->idle_us, c->block_us, c->rel, v2_cost_class(c->rel));
+    }
+    /* Relative cost of every preset in the current bank, null where unknown */
+    if (strcmp(key, "preset_costs") == 0) {
+        if (!inst->cold->cost_index) return -1;
+        int count = inst->cold->bank_data ? inst->cold->bank_data->preset_count : 0;
+        int pos = snprintf(buf, buf_len, "[");
+        for (int i = 0; i < count && pos < buf_len - 8; i++) {
+            const PresetCost *c = v2_find_cost(inst, i);
+            if (c) pos += snprintf(buf + pos, buf_len - pos, "%s%.2f", i ? "," : "", c->rel);
+            else pos += snprintf(buf + pos, buf_len - pos, "%snull", i ? "," : "");
+        }
+        if (pos >= buf_len - 2) return -1;
+        pos += snprintf(buf + pos, buf_len - pos, "]");
+        return pos;
     }
     if (strcmp(key, "bank_index") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->current_bank);
+        return snprintf(buf, buf_len, "%d", inst->cold->current_bank);
     }
     if (strcmp(key, "bank_count") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->bank_count);
+        return snprintf(buf, buf_len, "%d", inst->cold->bank_count);
     }
     if (strcmp(key, "bank_name") == 0) {
-        if (inst->current_bank >= 0 && inst->current_bank < inst->bank_count)
-            return snprintf(buf, buf_len, "%s", inst->banks[inst->current_bank].name);
+        if (inst->cold->current_bank >= 0 && inst->cold->current_bank < inst->cold->bank_count)
+            return snprintf(buf, buf_len, "%s", inst->cold->banks[inst->cold->current_bank].name);
         return snprintf(buf, buf_len, "OB-Xd");
     }
     if (strcmp(key, "patch_in_bank") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->current_preset + 1);
+        return snprintf(buf, buf_len, "%d", inst->cold->current_preset + 1);
     }
     /* fxb_bank_list — JSON array for hierarchy items_param; rescan on each query */
     if (strcmp(key, "fxb_bank_list") == 0) {
-        v2_scan_banks(inst, inst->module_dir);
+        v2_scan_banks(inst, inst->cold->module_dir);
         int pos = 0;
         pos += snprintf(buf + pos, buf_len - pos, "[");
-        for (int i = 0; i < inst->bank_count && pos < buf_len - 2; i++) {
+        for (int i = 0; i < inst->cold->bank_count && pos < buf_len - 2; i++) {
             if (i > 0) pos += snprintf(buf + pos, buf_len - pos, ",");
             pos += snprintf(buf + pos, buf_len - pos,
-                "{\"label\":\"%s\",\"index\":%d}", inst->banks[i].name, i);
+                "{\"label\":\"%s\",\"index\":%d}", inst->cold->banks[i].name, i);
         }
         pos += snprintf(buf + pos, buf_len - pos, "]");
         return pos;
@@ -1002,18 +3043,18 @@ static int v2_get_param(void *instance, const char *key, char *buf, int buf_len)
         return snprintf(buf, buf_len, "%d", inst->octave_transpose);
     }
     if (strcmp(key, "param_bank") == 0) {
-        return snprintf(buf, buf_len, "%d", inst->param_bank);
+        return snprintf(buf, buf_len, "%d", inst->cold->param_bank);
     }
     if (strncmp(key, "param_name_", 11) == 0) {
         int idx = atoi(key + 11);
-        if (idx >= 0 && idx < 8 && inst->param_bank >= 0 && inst->param_bank < 3) {
-            return snprintf(buf, buf_len, "%s", g_param_names[inst->param_bank][idx]);
+        if (idx >= 0 && idx < 8 && inst->cold->param_bank >= 0 && inst->cold->param_bank < 3) {
+            return snprintf(buf, buf_len, "%s", g_param_names[inst->cold->param_bank][idx]);
         }
     }
     if (strncmp(key, "param_", 6) == 0) {
         int idx = atoi(key + 6);
         if (idx >= 0 && idx < 8) {
-            int param_idx = inst->param_bank * 8 + idx;
+            int param_idx = inst->cold->param_bank * 8 + idx;
             return snprintf(buf, buf_len, "%.3f", inst->params[param_idx]);
         }
     }
@@ -1025,91 +3066,9 @@ static int v2_get_param(void *instance, const char *key, char *buf, int buf_len)
 
     /* UI hierarchy for shadow parameter editor */
     if (strcmp(key, "ui_hierarchy") == 0) {
-        const char *hierarchy = "{"
-            "\"modes\":null,"
-            "\"levels\":{"
-                "\"root\":{"
-                    "\"list_param\":\"preset\","
-                    "\"count_param\":\"preset_count\","
-                    "\"name_param\":\"preset_name\","
-                    "\"children\":null,"
-                    "\"knobs\":[\"cutoff\",\"resonance\",\"filter_env\",\"attack\",\"decay\",\"sustain\",\"release\",\"octave_transpose\"],"
-                    "\"params\":["
-                        "{\"level\":\"banks\",\"label\":\"Banks\"},"
-                        "{\"level\":\"global\",\"label\":\"Global\"},"
-                        "{\"level\":\"osc1\",\"label\":\"Oscillator 1\"},"
-                        "{\"level\":\"osc2\",\"label\":\"Oscillator 2\"},"
-                        "{\"level\":\"osc_common\",\"label\":\"Osc Common\"},"
-                        "{\"level\":\"filter\",\"label\":\"Filter\"},"
-                        "{\"level\":\"filt_env\",\"label\":\"Filter Env\"},"
-                        "{\"level\":\"amp_env\",\"label\":\"Amp Env\"},"
-                        "{\"level\":\"lfo\",\"label\":\"LFO\"},"
-                        "{\"level\":\"lfo_dest\",\"label\":\"LFO Dest\"},"
-                        "{\"level\":\"pitch_mod\",\"label\":\"Pitch Mod\"}"
-                    "]"
-                "},"
-                "\"global\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"volume\",\"tune\",\"octave\",\"portamento\",\"unison\",\"unison_det\",\"legato\",\"octave_transpose\"],"
-                    "\"params\":[\"volume\",\"tune\",\"octave\",\"portamento\",\"unison\",\"unison_det\",\"legato\",\"octave_transpose\"]"
-                "},"
-                "\"osc1\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"osc1_saw\",\"osc1_pulse\",\"osc1_pitch\",\"osc1_mix\"],"
-                    "\"params\":[\"osc1_saw\",\"osc1_pulse\",\"osc1_pitch\",\"osc1_mix\"]"
-                "},"
-                "\"osc2\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"osc2_saw\",\"osc2_pulse\",\"osc2_pitch\",\"osc2_mix\",\"osc2_detune\",\"osc2_sync\"],"
-                    "\"params\":[\"osc2_saw\",\"osc2_pulse\",\"osc2_pitch\",\"osc2_mix\",\"osc2_detune\",\"osc2_sync\"]"
-                "},"
-                "\"osc_common\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"pw\",\"pw_env\",\"noise\",\"xmod\",\"brightness\"],"
-                    "\"params\":[\"pw\",\"pw_env\",\"pw_env_both\",\"pw_ofs\",\"noise\",\"xmod\",\"brightness\"]"
-                "},"
-                "\"filter\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"cutoff\",\"resonance\",\"filter_env\",\"key_follow\",\"multimode\",\"fourpole\"],"
-                    "\"params\":[\"cutoff\",\"resonance\",\"filter_env\",\"key_follow\",\"multimode\",\"bandpass\",\"fourpole\",\"self_osc\",\"fenv_inv\"]"
-                "},"
-                "\"filt_env\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"f_attack\",\"f_decay\",\"f_sustain\",\"f_release\",\"vel_filter\"],"
-                    "\"params\":[\"f_attack\",\"f_decay\",\"f_sustain\",\"f_release\",\"vel_filter\"]"
-                "},"
-                "\"amp_env\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"attack\",\"decay\",\"sustain\",\"release\",\"vel_amp\"],"
-                    "\"params\":[\"attack\",\"decay\",\"sustain\",\"release\",\"vel_amp\"]"
-                "},"
-                "\"lfo\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"lfo_rate\",\"lfo_sin\",\"lfo_square\",\"lfo_sh\",\"lfo_amt1\",\"lfo_amt2\"],"
-                    "\"params\":[\"lfo_rate\",\"lfo_sin\",\"lfo_square\",\"lfo_sh\",\"lfo_sync\",\"lfo_amt1\",\"lfo_amt2\"]"
-                "},"
-                "\"lfo_dest\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"lfo_osc1\",\"lfo_osc2\",\"lfo_filter\",\"lfo_pw1\",\"lfo_pw2\"],"
-                    "\"params\":[\"lfo_osc1\",\"lfo_osc2\",\"lfo_filter\",\"lfo_pw1\",\"lfo_pw2\"]"
-                "},"
-                "\"pitch_mod\":{"
-                    "\"children\":null,"
-                    "\"knobs\":[\"env_pitch\",\"bend_range\",\"vibrato\"],"
-                    "\"params\":[\"env_pitch\",\"env_pitch_both\",\"bend_range\",\"vibrato\"]"
-                "},"
-                "\"banks\":{"
-                    "\"name\":\"Banks\","
-                    "\"label\":\"Select Bank\","
-                    "\"items_param\":\"fxb_bank_list\","
-                    "\"select_param\":\"bank_index\","
-                    "\"navigate_to\":\"root\""
-                "}"
-            "}"
-        "}";
-        int len = strlen(hierarchy);
+        int len = (int)sizeof(g_ui_hierarchy_json) - 1;
         if (len < buf_len) {
-            strcpy(buf, hierarchy);
+            memcpy(buf, g_ui_hierarchy_json, len + 1);
             return len;
         }
         return -1;
@@ -1118,11 +3077,11 @@ static int v2_get_param(void *instance, const char *key, char *buf, int buf_len)
     /* State serialization for patch save/load */
     if (strcmp(key, "state") == 0) {
         int offset = 0;
-        const char *bname = (inst->current_bank >= 0 && inst->current_bank < inst->bank_count)
-            ? inst->banks[inst->current_bank].name : "";
+        const char *bname = (inst->cold->current_bank >= 0 && inst->cold->current_bank < inst->cold->bank_count)
+            ? inst->cold->banks[inst->cold->current_bank].name : "";
         offset += snprintf(buf + offset, buf_len - offset,
             "{\"preset\":%d,\"octave_transpose\":%d,\"bank_index\":%d,\"bank_name\":\"%s\"",
-            inst->current_preset, inst->octave_transpose, inst->current_bank, bname);
+            inst->cold->current_preset, inst->octave_transpose, inst->cold->current_bank, bname);
 
         /* Add all shadow params */
         for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params); i++) {
@@ -1131,33 +3090,176 @@ static int v2_get_param(void *instance, const char *key, char *buf, int buf_len)
                 ",\"%s\":%.4f", g_shadow_params[i].key, val);
         }
 
+        /* Learned CC mappings, only the ones that differ from the defaults */
+        char cc_map[2048];
+        if (v2_format_cc_map(inst, cc_map, sizeof(cc_map)) > 0) {
+            offset += snprintf(buf + offset, buf_len - offset, ",\"cc_map\":\"%s\"", cc_map);
+        }
+
         offset += snprintf(buf + offset, buf_len - offset, "}");
         return offset;
     }
+    if (strcmp(key, "cc_map") == 0) {
+        return v2_format_cc_map(inst, buf, buf_len);
+    }
+    if (strcmp(key, "midi_learn") == 0) {
+        for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params); i++) {
+            if (g_shadow_params[i].index == __atomic_load_n(&inst->midi_learn_param, __ATOMIC_ACQUIRE))
+                return snprintf(buf, buf_len, "%s", g_shadow_params[i].key);
+        }
+        return snprintf(buf, buf_len, "%s", "");
+    }
 
-    /* Chain params metadata for shadow parameter editor - dynamically generated */
+    /* Chain params metadata for shadow parameter editor - prebuilt at load */
     if (strcmp(key, "chain_params") == 0) {
-        /* Build JSON with preset/octave_transpose first, then all shadow params */
-        int offset = 0;
-        offset += snprintf(buf + offset, buf_len - offset,
-            "[{\"key\":\"preset\",\"name\":\"Preset\",\"type\":\"int\",\"min\":0,\"max\":9999},"
-            "{\"key\":\"octave_transpose\",\"name\":\"Octave\",\"type\":\"int\",\"min\":-3,\"max\":3}");
+        if (g_chain_params_len >= buf_len) return -1;
+        memcpy(buf, g_chain_params_json, g_chain_params_len + 1);
+        return g_chain_params_len;
+    }
 
-        /* Add all shadow params */
-        for (int i = 0; i < (int)PARAM_DEF_COUNT(g_shadow_params) && offset < buf_len - 100; i++) {
-            offset += snprintf(buf + offset, buf_len - offset,
-                ",{\"key\":\"%s\",\"name\":\"%s\",\"type\":\"%s\",\"min\":%g,\"max\":%g}",
-                g_shadow_params[i].key,
-                g_shadow_params[i].name[0] ? g_shadow_params[i].name : g_shadow_params[i].key,
-                g_shadow_params[i].type == PARAM_TYPE_INT ? "int" : "float",
-                g_shadow_params[i].min_val,
-                g_shadow_params[i].max_val);
+    return -1;
+}
+
+/* v2 helper: Render frames of audio with the engine as it currently stands */
+static inline void v2_render_frames(obxd_instance_t *inst, int16_t *out_interleaved_lr, int frames) {
+    const KernelVariant *k = __atomic_load_n(&inst->kernels, __ATOMIC_RELAXED);
+    k->render(inst->synth, inst->output_gain, out_interleaved_lr, frames);
+
+    AutoSampler *as = inst->autosample;
+    if (as && as->playing) v2_autosample_mix(inst, as, out_interleaved_lr, frames);
+}
+
+/* v2 helper: Render one block, dispatching queued events at their frames */
+static void v2_render_events(obxd_instance_t *inst, int16_t *out_interleaved_lr, int frames) {
+    /* Batched param writes land together, never half-applied mid-block */
+    if (inst->batch_read != __atomic_load_n(&inst->batch_write, __ATOMIC_ACQUIRE)) {
+        v2_drain_param_batches(inst);
+    }
+
+    AutoSampler *as = __atomic_load_n(&inst->autosample, __ATOMIC_ACQUIRE);
+    if (as) v2_autosample_block_start(inst, as);
+
+    if (inst->pending_midi_count == 0) {
+        v2_render_frames(inst, out_interleaved_lr, frames);
+        return;
+    }
+
+    /* Split the block at each queued event's frame */
+    int pos = 0;
+    int ev = 0;
+    while (pos < frames) {
+        while (ev < inst->pending_midi_count && (int)inst->cold->pending_midi[ev].frame <= pos) {
+            v2_dispatch_queued(inst, &inst->cold->pending_midi[ev++]);
         }
-        offset += snprintf(buf + offset, buf_len - offset, "]");
-        return offset;
+        int end = frames;
+        if (ev < inst->pending_midi_count && (int)inst->cold->pending_midi[ev].frame < end) {
+            end = inst->cold->pending_midi[ev].frame;
+        }
+        v2_render_frames(inst, out_interleaved_lr + pos * 2, end - pos);
+        pos = end;
     }
 
-    return -1;
+    /* Events stamped beyond this block carry over to the next one */
+    int kept = 0;
+    for (; ev < inst->pending_midi_count; ev++) {
+        inst->cold->pending_midi[kept] = inst->cold->pending_midi[ev];
+        inst->cold->pending_midi[kept].frame -= frames;
+        kept++;
+    }
+    inst->pending_midi_count = kept;
+    if (kept == 0) inst->cold->pending_sysex_len = 0;
+}
+
+/* v2 helper: Fold one block into the stats counters */
+static void v2_update_stats(obxd_instance_t *inst, int frames, uint64_t elapsed_ns, int active_voices) {
+    RenderStats *st = &inst->stats;
+
+    uint32_t request = __atomic_load_n(&inst->stats_reset_request, __ATOMIC_ACQUIRE);
+    if (request != inst->stats_reset_done) {
+        memset(st, 0, sizeof(*st));
+        inst->synth->resetTraceStats();
+        __atomic_store_n(&inst->stats_reset_done, request, __ATOMIC_RELEASE);
+    }
+
+    float block_us = (float)elapsed_ns * 0.001f;
+    float budget_us = frames * 1e6f / MOVE_SAMPLE_RATE * inst->stats_budget_pct * 0.01f;
+
+    st->blocks++;
+    st->frames += frames;
+    st->total_us += block_us;
+    if (block_us > st->max_block_us) st->max_block_us = block_us;
+    if (block_us > budget_us) st->over_budget++;
+    if (active_voices >= STATS_VOICE_BINS) active_voices = STATS_VOICE_BINS - 1;
+    st->voice_hist[active_voices]++;
+}
+
+/* v2 helper: stats counters as JSON */
+static int v2_format_stats(obxd_instance_t *inst, char *buf, int buf_len) {
+    const RenderStats *st = &inst->stats;
+    const VoiceTrace &tr = inst->synth->getTrace();
+
+    double seconds = (double)st->frames / MOVE_SAMPLE_RATE;
+    double minutes = seconds / 60.0;
+    uint32_t steals = tr.counts[VoiceTrace::STEAL];
+    uint32_t onsets = tr.onsetCount;
+
+    int top = STATS_VOICE_BINS - 1;
+    while (top > 0 && st->voice_hist[top] == 0) top--;
+
+    int len = snprintf(buf, buf_len,
+        "{\"seconds\":%.1f,\"blocks\":%llu,\"over_budget\":%llu,\"budget_pct\":%.0f,\"midi_overflows\":%llu,"
+        "\"max_block_us\":%.1f,\"avg_block_us\":%.1f,\"voice_count\":%d,\"active_voices_hist\":[",
+        seconds, (unsigned long long)st->blocks, (unsigned long long)st->over_budget,
+        inst->stats_budget_pct, (unsigned long long)st->midi_overflows, st->max_block_us,
+        st->blocks ? st->total_us / st->blocks : 0.0, inst->synth->getVoiceCount());
+    for (int i = 0; i <= top && len < buf_len; i++) {
+        len += snprintf(buf + len, buf_len - len, "%s%u", i ? "," : "", st->voice_hist[i]);
+    }
+    if (len >= buf_len) return -1;
+
+    len += snprintf(buf + len, buf_len - len,
+        "],\"note_ons\":%u,\"steals\":%u,\"steals_per_min\":%.1f,\"queued\":%u,"
+        "\"latency_ms\":{\"count\":%u,\"avg\":%.2f,\"max\":%.2f}}",
+        tr.counts[VoiceTrace::NOTE_ON], steals, minutes > 0 ? steals / minutes : 0.0,
+        tr.counts[VoiceTrace::QUEUED], onsets,
+        onsets ? (double)tr.onsetSamplesTotal / onsets * 1000.0 / MOVE_SAMPLE_RATE : 0.0,
+        tr.onsetMax * 1000.0 / MOVE_SAMPLE_RATE);
+    return len < buf_len ? len : -1;
+}
+
+/* v2 helper: Publish the block's telemetry through the seqlock */
+static void v2_publish_telemetry(obxd_instance_t *inst, const int16_t *out, int frames,
+                                 uint64_t elapsed_ns, int active_voices) {
+    obxd_telemetry_t *t = __atomic_load_n(&inst->telemetry, __ATOMIC_ACQUIRE);
+    if (!t) return;
+
+    int peak_l = 0, peak_r = 0;
+    for (int i = 0; i < frames; i++) {
+        int l = abs(out[i * 2]);
+        int r = abs(out[i * 2 + 1]);
+        if (l > peak_l) peak_l = l;
+        if (r > peak_r) peak_r = r;
+    }
+    uint32_t version = __atomic_load_n(&inst->param_version, __ATOMIC_ACQUIRE);
+    float block_us = (float)elapsed_ns * 0.001f;
+
+    obxd_telemetry_begin(t);
+    t->blocks++;
+    t->frames = frames;
+    t->active_voices = active_voices;
+    t->voice_count = inst->synth->getVoiceCount();
+    t->block_us = block_us;
+    t->block_load = frames > 0 ? block_us * (float)MOVE_SAMPLE_RATE / (frames * 1e6f) : 0.0f;
+    t->peak_l = peak_l / 32768.0f;
+    t->peak_r = peak_r / 32768.0f;
+    t->bank_index = inst->cold->current_bank;
+    t->preset_index = inst->cold->current_preset;
+    if (t->param_version != version) {
+        t->param_version = version;
+        t->param_count = PARAM_COUNT;
+        memcpy(t->params, inst->params, sizeof(inst->params));
+    }
+    obxd_telemetry_end(t);
 }
 
 /* v2 API: Render audio */
@@ -1168,24 +3270,42 @@ static void v2_render_block(void *instance, int16_t *out_interleaved_lr, int fra
         return;
     }
 
-    for (int i = 0; i < frames; i++) {
-        float left = 0.0f, right = 0.0f;
-        inst->synth->processSample(&left, &right);
-
-        left *= inst->output_gain;
-        right *= inst->output_gain;
+    if (!v2_audio_begin(inst)) {
+        memset(out_interleaved_lr, 0, frames * 4);
+        return;
+    }
+    uint64_t start = v2_now_ns();
+    __atomic_store_n(&inst->render_ns, start, __ATOMIC_RELAXED);
+    v2_render_events(inst, out_interleaved_lr, frames);
+    uint64_t elapsed = v2_now_ns() - start;
+
+    int active = inst->synth->getActiveVoiceCount();
+    v2_update_stats(inst, frames, elapsed, active);
+    if (inst->autosample) v2_autosample_update_load(inst->autosample, frames, elapsed);
+    v2_publish_telemetry(inst, out_interleaved_lr, frames, elapsed, active);
+    v2_audio_end(inst);
+}
 
-        int32_t l = (int32_t)(left * 32767.0f);
-        int32_t r = (int32_t)(right * 32767.0f);
+/* Ext API: In-process view of the telemetry region */
+static const obxd_telemetry_t* ext_get_telemetry(void *instance) {
+    obxd_instance_t *inst = (obxd_instance_t*)instance;
+    return inst ? v2_telemetry_get(inst) : NULL;
+}
 
-        if (l > 32767) l = 32767;
-        if (l < -32768) l = -32768;
-        if (r > 32767) r = 32767;
-        if (r < -32768) r = -32768;
+/* Ext API: Zero-copy access to the immutable metadata blobs */
+static int ext_get_param_blob(void *instance, const char *key, const char **out) {
+    (void)instance;
+    if (!key || !out) return -1;
 
-        out_interleaved_lr[i * 2] = (int16_t)l;
-        out_interleaved_lr[i * 2 + 1] = (int16_t)r;
+    if (strcmp(key, "ui_hierarchy") == 0) {
+        *out = g_ui_hierarchy_json;
+        return (int)sizeof(g_ui_hierarchy_json) - 1;
+    }
+    if (strcmp(key, "chain_params") == 0) {
+        *out = g_chain_params_json;
+        return g_chain_params_len;
     }
+    return -1;
 }
 
 /* OB-Xd doesn't require external assets, so no load errors */
@@ -1201,6 +3321,8 @@ static plugin_api_v2_t g_plugin_api_v2;
 
 extern "C" plugin_api_v2_t* move_plugin_init_v2(const host_api_v1_t *host) {
     g_host = host;
+    build_chain_params_json();
+    v2_select_kernels();
 
     memset(&g_plugin_api_v2, 0, sizeof(g_plugin_api_v2));
     g_plugin_api_v2.api_version = MOVE_PLUGIN_API_VERSION_2;
@@ -1214,3 +3336,20 @@ extern "C" plugin_api_v2_t* move_plugin_init_v2(const host_api_v1_t *host) {
 
     return &g_plugin_api_v2;
 }
+
+/* Extended API table */
+static obxd_ext_api_t g_ext_api;
+
+extern "C" const obxd_ext_api_t* move_plugin_ext_obxd(void) {
+    build_chain_params_json();
+
+    memset(&g_ext_api, 0, sizeof(g_ext_api));
+    g_ext_api.api_version = OBXD_EXT_API_VERSION;
+    g_ext_api.struct_size = sizeof(g_ext_api);
+    g_ext_api.clone_instance = ext_clone_instance;
+    g_ext_api.get_param_blob = ext_get_param_blob;
+    g_ext_api.on_midi_batch = ext_on_midi_batch;
+    g_ext_api.get_telemetry = ext_get_telemetry;
+
+    return &g_ext_api;
+}
@@ -0,0 +1,84 @@
+/*
+ * obxd_telemetry.h - Shared-memory telemetry and parameter mirror
+ *
+ * Each instance publishes one obxd_telemetry_t, rewritten at the end of
+ * every render_block. Readers never call into the plugin: they map the
+ * region (POSIX shm name from get_param("telemetry_shm"), or the pointer
+ * from the extended API in-process) and copy it out with
+ * obxd_telemetry_read(). The region is created on the first of those
+ * requests, not with the instance.
+ *
+ * Consistency is a seqlock: the writer bumps seq to odd, writes, bumps it
+ * back to even. A reader retries while seq is odd or changed under it.
+ */
+
+#ifndef OBXD_TELEMETRY_H
+#define OBXD_TELEMETRY_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OBXD_TELEMETRY_MAGIC 0x4458424F  /* "OBXD" */
+#define OBXD_TELEMETRY_VERSION 1
+#define OBXD_TELEMETRY_MAX_PARAMS 128
+#define OBXD_TELEMETRY_SHM_NAME_MAX 64
+
+typedef struct obxd_telemetry {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t struct_size;
+    uint32_t seq;               /* Odd while an update is in progress */
+
+    uint32_t blocks;            /* render_block calls since create */
+    uint32_t frames;            /* Frames in the last block */
+    uint32_t active_voices;     /* Voices with a running amp envelope */
+    uint32_t voice_count;       /* Configured polyphony */
+    float block_us;             /* Wall time of the last render_block */
+    float block_load;           /* block_us / block duration, 1.0 = deadline */
+    float peak_l;               /* Last block's output peak, 0..1 */
+    float peak_r;
+
+    int32_t bank_index;
+    int32_t preset_index;
+    uint32_t param_version;     /* Matches get_param("params_version") */
+    uint32_t param_count;
+    float params[OBXD_TELEMETRY_MAX_PARAMS];  /* ParamsEnum order, 0..1 */
+} obxd_telemetry_t;
+
+/* Writer side: enter / leave an update */
+static inline void obxd_telemetry_begin(obxd_telemetry_t *t) {
+    __atomic_store_n(&t->seq, t->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void obxd_telemetry_end(obxd_telemetry_t *t) {
+    __atomic_store_n(&t->seq, t->seq + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Reader side: take a consistent copy.
+ * Returns: 1 on success, 0 if the region is not a telemetry block or the
+ * writer kept it busy for every attempt.
+ */
+static inline int obxd_telemetry_read(const obxd_telemetry_t *t, obxd_telemetry_t *out) {
+    if (t->magic != OBXD_TELEMETRY_MAGIC || t->version != OBXD_TELEMETRY_VERSION) return 0;
+
+    for (int attempt = 0; attempt < 64; attempt++) {
+        uint32_t s0 = __atomic_load_n(&t->seq, __ATOMIC_ACQUIRE);
+        if (s0 & 1) continue;
+        memcpy(out, (const void*)t, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&t->seq, __ATOMIC_RELAXED) == s0) return 1;
+    }
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBXD_TELEMETRY_H */
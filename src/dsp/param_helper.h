@@ -20,19 +20,98 @@
 /* Parameter types */
 typedef enum {
     PARAM_TYPE_FLOAT = 0,
-    PARAM_TYPE_INT = 1
+    PARAM_TYPE_INT = 1,
+    PARAM_TYPE_ENUM = 2   /* Named options spread evenly over min..max */
 } param_type_t;
 
 /* Parameter definition */
 typedef struct {
     const char *key;      /* Parameter key (used in get/set) */
     const char *name;     /* Display name (for UI) */
-    param_type_t type;    /* float or int */
+    param_type_t type;    /* float, int or enum */
     int index;            /* Index into values array */
     float min_val;        /* Minimum value */
     float max_val;        /* Maximum value */
+    const char *const *options;  /* Enum option names, NULL-terminated, in value order */
 } param_def_t;
 
+/* Number of options of an enum param */
+static inline int param_helper_option_count(const param_def_t *def) {
+    int n = 0;
+    while (def->options && def->options[n]) n++;
+    return n;
+}
+
+/* Option an enum value falls on: the nearest one */
+static inline int param_helper_option_index(const param_def_t *def, float v) {
+    int n = param_helper_option_count(def);
+    if (n < 2 || def->max_val <= def->min_val) return 0;
+    int i = (int)((v - def->min_val) / (def->max_val - def->min_val) * (n - 1) + 0.5f);
+    if (i < 0) i = 0;
+    if (i > n - 1) i = n - 1;
+    return i;
+}
+
+/* Value of an enum option */
+static inline float param_helper_option_value(const param_def_t *def, int i) {
+    int n = param_helper_option_count(def);
+    if (n < 2) return def->min_val;
+    return def->min_val + (def->max_val - def->min_val) * i / (n - 1);
+}
+
+/*
+ * Parse a value for a param: a number clamped to min/max, or for an enum
+ * also an option name. An enum number snaps to the nearest option.
+ * Returns: 0 on success, -1 if val is neither
+ */
+static inline int param_helper_parse(const param_def_t *def, const char *val, float *out) {
+    if (def->type == PARAM_TYPE_ENUM) {
+        for (int i = 0; def->options && def->options[i]; i++) {
+            if (strcmp(val, def->options[i]) == 0) {
+                *out = param_helper_option_value(def, i);
+                return 0;
+            }
+        }
+    }
+    char *end;
+    float v = strtof(val, &end);
+    if (end == val) return -1;
+    if (v < def->min_val) v = def->min_val;
+    if (v > def->max_val) v = def->max_val;
+    if (def->type == PARAM_TYPE_ENUM) v = param_helper_option_value(def, param_helper_option_index(def, v));
+    *out = v;
+    return 0;
+}
+
+/*
+ * Format a param value: enums by option name, ints truncated, floats to 3 places.
+ * Returns: length written to buf
+ */
+static inline int param_helper_format(const param_def_t *def, float v, char *buf, int buf_len) {
+    if (def->type == PARAM_TYPE_ENUM) {
+        int n = param_helper_option_count(def);
+        return snprintf(buf, buf_len, "%s", n > 0 ? def->options[param_helper_option_index(def, v)] : "");
+    }
+    if (def->type == PARAM_TYPE_INT) return snprintf(buf, buf_len, "%d", (int)v);
+    return snprintf(buf, buf_len, "%.3f", v);
+}
+
+/*
+ * chain_params JSON type for a param: the type name, plus the option list for an enum.
+ * Returns: length written to buf
+ */
+static inline int param_helper_type_json(const param_def_t *def, char *buf, int buf_len) {
+    if (def->type != PARAM_TYPE_ENUM) {
+        return snprintf(buf, buf_len, "\"type\":\"%s\"", def->type == PARAM_TYPE_INT ? "int" : "float");
+    }
+    int offset = snprintf(buf, buf_len, "\"type\":\"enum\",\"options\":[");
+    for (int i = 0; def->options && def->options[i] && offset < buf_len; i++) {
+        offset += snprintf(buf + offset, buf_len - offset, "%s\"%s\"", i ? "," : "", def->options[i]);
+    }
+    if (offset < buf_len) offset += snprintf(buf + offset, buf_len - offset, "]");
+    return offset;
+}
+
 /*
  * Get a parameter value by key.
  * Returns: length written to buf, or -1 if key not found
@@ -47,11 +126,7 @@ static inline int param_helper_get(
 ) {
     for (int i = 0; i < def_count; i++) {
         if (strcmp(key, defs[i].key) == 0) {
-            if (defs[i].type == PARAM_TYPE_INT) {
-                return snprintf(buf, buf_len, "%d", (int)values[defs[i].index]);
-            } else {
-                return snprintf(buf, buf_len, "%.3f", values[defs[i].index]);
-            }
+            return param_helper_format(&defs[i], values[defs[i].index], buf, buf_len);
         }
     }
     return -1;  /* Key not found */
@@ -70,10 +145,8 @@ static inline int param_helper_set(
 ) {
     for (int i = 0; i < def_count; i++) {
         if (strcmp(key, defs[i].key) == 0) {
-            float v = (float)atof(val);
-            /* Clamp to min/max */
-            if (v < defs[i].min_val) v = defs[i].min_val;
-            if (v > defs[i].max_val) v = defs[i].max_val;
+            float v = 0.0f;
+            if (param_helper_parse(&defs[i], val, &v) != 0) param_helper_parse(&defs[i], "0", &v);
             values[defs[i].index] = v;
             return 0;
         }
@@ -94,13 +167,15 @@ static inline int param_helper_chain_params_json(
     int offset = 0;
     offset += snprintf(buf + offset, buf_len - offset, "[");
 
+    char type[256];
     for (int i = 0; i < def_count && offset < buf_len - 100; i++) {
         if (i > 0) offset += snprintf(buf + offset, buf_len - offset, ",");
+        param_helper_type_json(&defs[i], type, sizeof(type));
         offset += snprintf(buf + offset, buf_len - offset,
-            "{\"key\":\"%s\",\"name\":\"%s\",\"type\":\"%s\",\"min\":%g,\"max\":%g}",
+            "{\"key\":\"%s\",\"name\":\"%s\",%s,\"min\":%g,\"max\":%g}",
             defs[i].key,
             defs[i].name[0] ? defs[i].name : defs[i].key,
-            defs[i].type == PARAM_TYPE_INT ? "int" : "float",
+            type,
             defs[i].min_val,
             defs[i].max_val);
     }
@@ -0,0 +1,126 @@
+/*
+ * patch_sysex.h - OB-Xd bulk patch dump over SysEx
+ *
+ * Carries a complete float[PARAM_COUNT] patch in one message, so an editor
+ * can send a patch change atomically instead of ~70 single param messages.
+ *
+ * Layout:
+ *   F0 7D 4F 58          non-commercial manufacturer id, "OX"
+ *   01                   command: patch dump
+ *   01                   format version
+ *   cc cc                param count, 7-bit little endian
+ *   [count x 5 bytes]    IEEE float bits, 7-bit little endian groups
+ *   [name bytes]         optional 7-bit ASCII preset name
+ *   F7
+ *
+ * Values are normalized params, 0..1. A dump comes from outside (any
+ * controller can send SysEx), so the decoder is the trust boundary: it
+ * rejects a dump with a NaN or infinite value, clamps the rest to 0..1 and
+ * keeps only printable name characters other than '"' and '\\'.
+ */
+
+#ifndef PATCH_SYSEX_H
+#define PATCH_SYSEX_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PATCH_SYSEX_CMD_DUMP 0x01
+#define PATCH_SYSEX_VERSION 0x01
+#define PATCH_SYSEX_HEADER_LEN 8
+#define PATCH_SYSEX_NAME_MAX 31
+
+/* Size in bytes of a dump carrying param_count values and a name */
+static inline int patch_sysex_size(int param_count, int name_len) {
+    return PATCH_SYSEX_HEADER_LEN + param_count * 5 + name_len + 1;
+}
+
+/*
+ * Encode a patch dump.
+ * Returns: bytes written, or -1 if out is too small
+ */
+static inline int patch_sysex_encode(const float *params, int param_count, const char *name,
+                                     uint8_t *out, int out_len) {
+    int name_len = name ? (int)strlen(name) : 0;
+    if (name_len > PATCH_SYSEX_NAME_MAX) name_len = PATCH_SYSEX_NAME_MAX;
+    if (param_count < 0 || param_count > 0x3FFF) return -1;
+    if (patch_sysex_size(param_count, name_len) > out_len) return -1;
+
+    int pos = 0;
+    out[pos++] = 0xF0;
+    out[pos++] = 0x7D;
+    out[pos++] = 0x4F;
+    out[pos++] = 0x58;
+    out[pos++] = PATCH_SYSEX_CMD_DUMP;
+    out[pos++] = PATCH_SYSEX_VERSION;
+    out[pos++] = param_count & 0x7F;
+    out[pos++] = (param_count >> 7) & 0x7F;
+
+    for (int i = 0; i < param_count; i++) {
+        uint32_t bits;
+        memcpy(&bits, &params[i], sizeof(bits));
+        for (int b = 0; b < 5; b++) {
+            out[pos++] = (bits >> (b * 7)) & 0x7F;
+        }
+    }
+    for (int i = 0; i < name_len; i++) {
+        out[pos++] = name[i] & 0x7F;
+    }
+    out[pos++] = 0xF7;
+    return pos;
+}
+
+/* 7-bit little endian float bits at msg */
+static inline uint32_t patch_sysex_bits(const uint8_t *msg) {
+    uint32_t bits = 0;
+    for (int b = 0; b < 5; b++) {
+        bits |= (uint32_t)(msg[b] & 0x7F) << (b * 7);
+    }
+    return bits;
+}
+
+/*
+ * Decode a patch dump. Values beyond max_params are skipped, the rest are
+ * clamped to 0..1. params is left untouched unless the dump is valid.
+ * name must hold PATCH_SYSEX_NAME_MAX + 1 bytes (may be NULL).
+ * Returns: number of params in the dump, or -1 if msg is not a valid dump
+ * or carries a NaN or infinite value
+ */
+static inline int patch_sysex_decode(const uint8_t *msg, int len, float *params, int max_params,
+                                     char *name) {
+    if (len < PATCH_SYSEX_HEADER_LEN + 1) return -1;
+    if (msg[0] != 0xF0 || msg[1] != 0x7D || msg[2] != 0x4F || msg[3] != 0x58) return -1;
+    if (msg[4] != PATCH_SYSEX_CMD_DUMP || msg[5] != PATCH_SYSEX_VERSION) return -1;
+    if (msg[len - 1] != 0xF7) return -1;
+
+    int count = msg[6] | (msg[7] << 7);
+    int pos = PATCH_SYSEX_HEADER_LEN;
+    if (pos + count * 5 > len - 1) return -1;
+
+    /* All exponent bits set is inf or NaN */
+    for (int i = 0; i < count; i++) {
+        if ((patch_sysex_bits(msg + pos + i * 5) & 0x7F800000u) == 0x7F800000u) return -1;
+    }
+
+    for (int i = 0; i < count && i < max_params; i++) {
+        uint32_t bits = patch_sysex_bits(msg + pos + i * 5);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        params[i] = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    }
+    pos += count * 5;
+
+    if (name) {
+        int name_len = (len - 1) - pos;
+        if (name_len > PATCH_SYSEX_NAME_MAX) name_len = PATCH_SYSEX_NAME_MAX;
+        int out = 0;
+        for (int i = 0; i < name_len; i++) {
+            uint8_t c = msg[pos + i];
+            if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\') name[out++] = (char)c;
+        }
+        name[out] = '\0';
+    }
+    return count;
+}
+
+#endif /* PATCH_SYSEX_H */
@@ -0,0 +1,738 @@
+/*
+ * api_check.cpp - Behavioural checks of the control and MIDI API
+ *
+ * Each check drives dsp.so through the plugin API the way a host or an
+ * external controller would, and fails on the first expectation that does
+ * not hold, printing what it saw. They cover the contracts rtcheck and the
+ * benchmarks cannot see: what a call does, not how long it takes.
+ */
+
+#include "harness_host.h"
+#include "patch_sysex.h"
+#include "Engine/SynthEngine.h"
+#include "Engine/ParamsEnum.h"
+
+#include <math.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+    const char *name;
+    int (*run)(harness_t *h);
+} api_check_t;
+
+#define API_EXPECT(cond, ...)                                   \
+    do {                                                        \
+        if (!(cond)) {                                          \
+            fprintf(stderr, "api-check: %s:%d: ", __FILE__, __LINE__); \
+            fprintf(stderr, __VA_ARGS__);                       \
+            fprintf(stderr, "\n");                              \
+            return 0;                                           \
+        }                                                       \
+    } while (0)
+
+static float api_get_float(harness_t *h, void *inst, const char *key) {
+    char buf[64];
+    if (h->api->get_param(inst, key, buf, sizeof(buf)) <= 0) return NAN;
+    return (float)atof(buf);
+}
+
+static void api_render(harness_t *h, void *inst, int blocks) {
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    for (int b = 0; b < blocks; b++) h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+}
+
+/* Voices sounding after the last block, from the telemetry mirror (request it before rendering) */
+static int api_active_voices(harness_t *h, void *inst) {
+    obxd_telemetry_t t;
+    const obxd_telemetry_t *tel = h->ext->get_telemetry(inst);
+    if (!tel || !obxd_telemetry_read(tel, &t)) return -1;
+    return (int)t.active_voices;
+}
+
+/* Minimal JSON validator: enough to catch unescaped quotes and truncation */
+static const char *json_skip_value(const char *p);
+
+static const char *json_skip_ws(const char *p) {
+    while (*p == ' ' || *p == '\n' || *p == '\t' || *p == '\r') p++;
+    return p;
+}
+
+static const char *json_skip_string(const char *p) {
+    if (*p != '"') return NULL;
+    for (p++; *p && *p != '"'; p++) {
+        if ((unsigned char)*p < 0x20) return NULL;
+        if (*p == '\\' && !*++p) return NULL;
+    }
+    return *p == '"' ? p + 1 : NULL;
+}
+
+static const char *json_skip_value(const char *p) {
+    p = json_skip_ws(p);
+    if (*p == '"') return json_skip_string(p);
+    if (*p == '{' || *p == '[') {
+        char close = *p == '{' ? '}' : ']';
+        p = json_skip_ws(p + 1);
+        if (*p == close) return p + 1;
+        for (;;) {
+            if (close == '}') {
+                p = json_skip_string(json_skip_ws(p));
+                if (!p) return NULL;
+                p = json_skip_ws(p);
+                if (*p++ != ':') return NULL;
+            }
+            p = json_skip_value(p);
+            if (!p) return NULL;
+            p = json_skip_ws(p);
+            if (*p == close) return p + 1;
+            if (*p++ != ',') return NULL;
+        }
+    }
+    const char *start = p;
+    while (*p && (strchr("+-.eE", *p) || (*p >= '0' && *p <= '9') || (*p >= 'a' && *p <= 'z'))) p++;
+    return p > start ? p : NULL;
+}
+
+static int json_valid(const char *json) {
+    const char *end = json_skip_value(json);
+    return end && *json_skip_ws(end) == '\0';
+}
+
+/* =====================================================================
+ * clone: copies are independent of their source and of each other
+ * ===================================================================== */
+
+typedef struct {
+    harness_t *h;
+    void *inst;
+    int stop;
+    uint32_t blocks;
+} clone_audio_t;
+
+/* Audio thread for the concurrent clone check: notes and a block per block period, as a host would */
+static void *clone_audio_thread(void *arg) {
+    clone_audio_t *a = (clone_audio_t*)arg;
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    uint32_t seed = 99;
+    while (!__atomic_load_n(&a->stop, __ATOMIC_RELAXED)) {
+        int note = 36 + harness_rand(&seed) % 48;
+        harness_note(a->h, a->inst, 1, note, 100);
+        a->h->api->render_block(a->inst, audio, MOVE_FRAMES_PER_BLOCK);
+        harness_note(a->h, a->inst, 0, note, 0);
+        __atomic_add_fetch(&a->blocks, 1, __ATOMIC_RELAXED);
+        usleep(MOVE_FRAMES_PER_BLOCK * 1000000 / MOVE_SAMPLE_RATE);
+    }
+    return NULL;
+}
+
+static int check_clone(harness_t *h) {
+    char name_a[64], name_b[64];
+    void *a = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(a, "create_instance failed");
+    h->ext->get_telemetry(a);   /* Opened on first request, before the blocks it should see */
+    h->api->set_param(a, "cutoff", "0.3");
+    harness_note(h, a, 1, 60, 100);
+    api_render(h, a, 4);
+
+    /* Work queued on the source must not be replayed by the clone */
+    h->api->set_param(a, "params_batch", "cutoff=0.9");
+    obxd_midi_event_t ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.len = 3;
+    ev.data[0] = 0x90;
+    ev.data[1] = 64;
+    ev.data[2] = 100;
+    h->ext->on_midi_batch(a, &ev, 1);
+
+    void *b = h->ext->clone_instance(a);
+    API_EXPECT(b, "clone_instance failed");
+    h->ext->get_telemetry(b);
+
+    /* The source's render history is not the clone's */
+    char stats[2048], trace[256];
+    h->api->get_param(b, "stats", stats, sizeof(stats));
+    API_EXPECT(strstr(stats, "\"blocks\":0,") && strstr(stats, "\"note_ons\":0,"), "clone inherited stats: %s", stats);
+    int trace_len = h->api->get_param(b, "trace", trace, sizeof(trace));
+    API_EXPECT(trace_len > 0 && trace[trace_len - 1] == '\n' && !strchr(trace, '\n')[1],
+               "clone inherited trace events: %s", trace);
+    api_render(h, b, 4);
+    api_render(h, a, 4);
+    API_EXPECT(fabsf(api_get_float(h, b, "cutoff") - 0.3f) < 1e-3f,
+               "clone cutoff %.3f, expected 0.300 (source's queued batch replayed?)", api_get_float(h, b, "cutoff"));
+    API_EXPECT(fabsf(api_get_float(h, a, "cutoff") - 0.9f) < 1e-3f,
+               "source cutoff %.3f after its batch, expected 0.900", api_get_float(h, a, "cutoff"));
+    API_EXPECT(api_active_voices(h, b) == 1, "clone has %d voices, expected the 1 held note", api_active_voices(h, b));
+    API_EXPECT(api_active_voices(h, a) == 2, "source has %d voices, expected 2", api_active_voices(h, a));
+
+    /* Writes to either side stay on that side */
+    h->api->set_param(b, "cutoff", "0.1");
+    h->api->set_param(b, "preset", "5");
+    API_EXPECT(fabsf(api_get_float(h, a, "cutoff") - 0.9f) < 1e-3f, "clone write reached the source");
+    API_EXPECT(api_get_float(h, a, "preset") == 0.0f, "clone preset change reached the source");
+    h->api->set_param(a, "resonance", "0.77");
+    API_EXPECT(fabsf(api_get_float(h, b, "resonance") - 0.77f) > 1e-3f, "source write reached the clone");
+
+    if (h->api->get_param(a, "telemetry_shm", name_a, sizeof(name_a)) > 0 &&
+        h->api->get_param(b, "telemetry_shm", name_b, sizeof(name_b)) > 0 && name_a[0]) {
+        API_EXPECT(strcmp(name_a, name_b) != 0, "clone shares the telemetry region %s", name_a);
+    }
+
+    /* Shared bank presets outlive the source */
+    h->api->destroy_instance(a);
+    h->api->set_param(b, "preset", "7");
+    api_render(h, b, 8);
+    API_EXPECT(h->api->get_param(b, "preset_name", name_b, sizeof(name_b)) > 0 && name_b[0],
+               "clone lost its bank after the source was destroyed");
+    h->api->destroy_instance(b);
+
+    /* Clone while the source renders on another thread */
+    clone_audio_t audio;
+    audio.h = h;
+    audio.inst = h->api->create_instance(h->module_dir, NULL);
+    audio.stop = 0;
+    audio.blocks = 0;
+    API_EXPECT(audio.inst, "create_instance failed");
+    h->api->set_param(audio.inst, "cutoff", "0.42");
+    pthread_t thread;
+    API_EXPECT(pthread_create(&thread, NULL, clone_audio_thread, &audio) == 0, "pthread_create failed");
+    int failed = 0, clones = 0;
+    /* At least 200 clones spread over 100 source blocks */
+    for (int i = 0; !failed && i < 20000 && (i < 200 || __atomic_load_n(&audio.blocks, __ATOMIC_RELAXED) < 100); i++) {
+        void *c = h->ext->clone_instance(audio.inst);
+        if (!c) {
+            failed = 1;
+            break;
+        }
+        clones++;
+        if (fabsf(api_get_float(h, c, "cutoff") - 0.42f) > 1e-3f) failed = 2;
+        api_render(h, c, 1);
+        h->api->destroy_instance(c);
+    }
+    __atomic_store_n(&audio.stop, 1, __ATOMIC_RELAXED);
+    pthread_join(thread, NULL);
+    h->api->destroy_instance(audio.inst);
+    API_EXPECT(failed != 1, "clone_instance failed while the source was rendering");
+    API_EXPECT(failed != 2, "clone taken while rendering has the wrong params");
+    API_EXPECT(audio.blocks > 0, "audio thread never rendered");
+    if (g_harness_verbose) fprintf(stderr, "clone: %d clones over %u source blocks\n", clones, audio.blocks);
+    return 1;
+}
+
+/* =====================================================================
+ * snapshot: params_version moves on every change and only then
+ * ===================================================================== */
+
+static uint32_t api_version(harness_t *h, void *inst) {
+    char buf[32];
+    return h->api->get_param(inst, "params_version", buf, sizeof(buf)) > 0 ? (uint32_t)strtoul(buf, NULL, 10) : 0;
+}
+
+static int check_snapshot(harness_t *h) {
+    static char snap[4096], again[4096];
+    char expect[96];
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(inst, "create_instance failed");
+
+    uint32_t v0 = api_version(h, inst);
+    API_EXPECT(h->api->get_param(inst, "params_snapshot", snap, sizeof(snap)) > 0, "no params_snapshot");
+    API_EXPECT(json_valid(snap), "params_snapshot is not valid JSON: %s", snap);
+    snprintf(expect, sizeof(expect), "{\"v\":%u,", v0);
+    API_EXPECT(strncmp(snap, expect, strlen(expect)) == 0, "snapshot does not start with %s: %.40s", expect, snap);
+
+    /* Reads, renders and notes are not changes */
+    harness_note(h, inst, 1, 60, 100);
+    api_render(h, inst, 8);
+    harness_note(h, inst, 0, 60, 0);
+    api_render(h, inst, 8);
+    API_EXPECT(api_version(h, inst) == v0, "params_version moved from %u to %u without a change", v0, api_version(h, inst));
+    h->api->get_param(inst, "params_snapshot", again, sizeof(again));
+    API_EXPECT(strcmp(snap, again) == 0, "snapshot changed without a version change");
+
+    /* Each kind of change moves the version and shows in the snapshot */
+    h->api->set_param(inst, "cutoff", "0.25");
+    uint32_t v1 = api_version(h, inst);
+    API_EXPECT(v1 != v0, "set_param did not move params_version");
+    h->api->get_param(inst, "params_snapshot", snap, sizeof(snap));
+    API_EXPECT(strstr(snap, "\"cutoff\":0.250"), "snapshot misses the new cutoff: %s", snap);
+    snprintf(expect, sizeof(expect), "{\"v\":%u,", v1);
+    API_EXPECT(strncmp(snap, expect, strlen(expect)) == 0, "snapshot not rebuilt at version %u", v1);
+
+    h->api->set_param(inst, "preset", "3");
+    uint32_t v2 = api_version(h, inst);
+    API_EXPECT(v2 != v1, "preset change did not move params_version");
+    char name[64];
+    h->api->get_param(inst, "preset_name", name, sizeof(name));
+    h->api->get_param(inst, "params_snapshot", snap, sizeof(snap));
+    snprintf(expect, sizeof(expect), "\"preset\":3,");
+    API_EXPECT(strstr(snap, expect), "snapshot misses the preset change: %.80s", snap);
+    API_EXPECT(json_valid(snap), "params_snapshot is not valid JSON: %s", snap);
+
+    h->api->set_param(inst, "octave_transpose", "2");
+    API_EXPECT(api_version(h, inst) != v2, "octave_transpose did not move params_version");
+
+    /* A buffer too small gets -1, never a truncated snapshot */
+    char small[32];
+    API_EXPECT(h->api->get_param(inst, "params_snapshot", small, sizeof(small)) == -1,
+               "params_snapshot into a 32 byte buffer did not fail");
+    h->api->destroy_instance(inst);
+
+    /* A bank file appearing shows up through fxb_bank_list and moves the version */
+    char dir[] = "/tmp/obxd-api-check-XXXXXX", path[600], factory[PATH_MAX], list[1024];
+    API_EXPECT(mkdtemp(dir), "mkdtemp failed");
+    snprintf(path, sizeof(path), "%s/presets/factory.fxb", h->module_dir);
+    API_EXPECT(realpath(path, factory), "no %s", path);
+    snprintf(path, sizeof(path), "%s/presets", dir);
+    mkdir(path, 0755);
+    snprintf(path, sizeof(path), "%s/presets/factory.fxb", dir);
+    API_EXPECT(symlink(factory, path) == 0, "symlink %s failed", path);
+    inst = h->api->create_instance(dir, NULL);
+    API_EXPECT(inst, "create_instance in %s failed", dir);
+    h->api->get_param(inst, "fxb_bank_list", list, sizeof(list));
+    uint32_t v3 = api_version(h, inst);
+    h->api->get_param(inst, "fxb_bank_list", list, sizeof(list));
+    API_EXPECT(api_version(h, inst) == v3, "a rescan that found nothing new moved params_version");
+    char extra[600];
+    snprintf(extra, sizeof(extra), "%s/presets/Extra.fxb", dir);
+    API_EXPECT(symlink(factory, extra) == 0, "symlink %s failed", extra);
+    h->api->get_param(inst, "fxb_bank_list", list, sizeof(list));
+    API_EXPECT(api_version(h, inst) != v3, "a new bank did not move params_version");
+    h->api->get_param(inst, "params_snapshot", snap, sizeof(snap));
+    API_EXPECT(strstr(snap, "\"bank_count\":2,"), "snapshot misses the new bank: %.200s", snap);
+    h->api->destroy_instance(inst);
+    unlink(extra);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s/presets", dir);
+    rmdir(path);
+    rmdir(dir);
+    return 1;
+}
+
+/* =====================================================================
+ * params_batch: lands at the next block, never over a newer direct write,
+ * and a full ring on an idle instance applies everything in order at once
+ * ===================================================================== */
+
+/* Matches MAX_PENDING_MIDI in obxd_plugin.cpp, as documented in obxd_ext_api.h */
+#define MAX_PENDING_MIDI_EVENTS 256
+
+#define API_NEAR(a, b) (fabsf((a) - (b)) < 0.0015f)
+
+static int check_params_batch(harness_t *h) {
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(inst, "create_instance failed");
+    api_render(h, inst, 1);
+
+    /* Applied at the block boundary, not before */
+    h->api->set_param(inst, "cutoff", "0.5");
+    h->api->set_param(inst, "params_batch", "cutoff=0.1,resonance=0.6");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.5f), "batch applied before render");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.1f), "batch not applied by render");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "resonance"), 0.6f), "batch applied partly");
+
+    /* A direct write after the batch wins for its param only */
+    h->api->set_param(inst, "params_batch", "cutoff=0.2,resonance=0.7");
+    h->api->set_param(inst, "cutoff", "0.9");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.9f), "direct write not visible");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.9f),
+               "queued batch overrode a later direct write: cutoff %.3f", api_get_float(h, inst, "cutoff"));
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "resonance"), 0.7f), "rest of the batch was lost");
+
+    /* A batch queued after the direct write applies as usual */
+    h->api->set_param(inst, "params_batch", "cutoff=0.3");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.3f), "batch after a direct write was skipped");
+
+    /* A preset change voids everything queued before it */
+    h->api->set_param(inst, "params_batch", "cutoff=0.77");
+    h->api->set_param(inst, "preset", "2");
+    float preset_cutoff = api_get_float(h, inst, "cutoff");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), preset_cutoff), "queued batch overrode a preset change");
+
+    /* Full ring, render idle: the queued batches and the extra one apply in order, none lost */
+    usleep(20000);
+    const char *queued[] = {"cutoff=0.11,resonance=0.21", "cutoff=0.12", "cutoff=0.13", "cutoff=0.14"};
+    for (int i = 0; i < 4; i++) h->api->set_param(inst, "params_batch", queued[i]);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), preset_cutoff), "batch applied before the ring was full");
+    h->api->set_param(inst, "params_batch", "cutoff=0.99");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.99f), "full ring did not apply the extra batch last");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "resonance"), 0.21f), "full ring lost a queued batch");
+    h->api->set_param(inst, "params_batch", "cutoff=0.15");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.99f), "ring not usable again after the direct apply");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.15f), "batch after the direct apply was lost");
+    API_EXPECT(api_get_float(h, inst, "params_batch_dropped") == 0.0f, "a batch was dropped");
+
+    h->api->destroy_instance(inst);
+    return 1;
+}
+
+/* =====================================================================
+ * midi_map: learn, persist with the state, reset; channel mode messages
+ * silence the synth and are never learned
+ * ===================================================================== */
+
+static void api_cc(harness_t *h, void *inst, int cc, int value) {
+    uint8_t msg[3] = {0xB0, (uint8_t)cc, (uint8_t)value};
+    h->api->on_midi(inst, msg, 3, MOVE_MIDI_SOURCE_EXTERNAL);
+}
+
+static int check_midi_map(harness_t *h) {
+    static char state[16384];
+    char map[512];
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(inst, "create_instance failed");
+    h->ext->get_telemetry(inst);
+
+    /* Defaults: CC 74 is cutoff, structural params have no CC */
+    api_cc(h, inst, 74, 127);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 1.0f), "CC 74 does not drive cutoff");
+    float voices = api_get_float(h, inst, "voice_count");
+    api_cc(h, inst, 15, voices > 0.5f ? 0 : 127);
+    API_EXPECT(api_get_float(h, inst, "voice_count") == voices, "CC 15 changed voice_count");
+
+    /* Learn moves cutoff to CC 20; reserved CCs are passed over while armed */
+    h->api->set_param(inst, "midi_learn", "cutoff");
+    api_cc(h, inst, 123, 0);
+    api_cc(h, inst, 120, 0);
+    char learn[32];
+    h->api->get_param(inst, "midi_learn", learn, sizeof(learn));
+    API_EXPECT(strcmp(learn, "cutoff") == 0, "a channel mode message was learned");
+    api_cc(h, inst, 20, 0);
+    h->api->get_param(inst, "midi_learn", learn, sizeof(learn));
+    API_EXPECT(learn[0] == '\0', "learn still armed after CC 20");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 1.0f), "the learning CC also set the value");
+    api_cc(h, inst, 20, 0);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.0f), "CC 20 does not drive cutoff after learn");
+    api_cc(h, inst, 74, 127);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.0f), "CC 74 still drives cutoff after learn");
+    API_EXPECT(h->api->get_param(inst, "cc_map", map, sizeof(map)) > 0 && strstr(map, "20=CUTOFF"),
+               "cc_map misses the learned CC: %s", map);
+
+    /* Reserved CCs cannot be mapped through cc_map either */
+    h->api->set_param(inst, "cc_map", "20=CUTOFF,74=-,123=RESONANCE,64=RESONANCE");
+    h->api->get_param(inst, "cc_map", map, sizeof(map));
+    API_EXPECT(!strstr(map, "123=") && !strstr(map, "64="), "cc_map accepted a reserved CC: %s", map);
+
+    /* An unknown tag leaves its CC as it was, it does not unmap it */
+    h->api->set_param(inst, "cc_map", "20=CUTOFF,74=-,71=NO_SUCH_TAG");
+    h->api->get_param(inst, "cc_map", map, sizeof(map));
+    API_EXPECT(!strstr(map, "71="), "cc_map took an unknown tag: %s", map);
+    api_cc(h, inst, 71, 127);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "volume"), 1.0f), "an unknown tag unmapped CC 71");
+
+    /* The mapping travels with the state */
+    API_EXPECT(h->api->get_param(inst, "state", state, sizeof(state)) > 0, "no state");
+    void *other = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(other, "second create_instance failed");
+    h->api->set_param(other, "state", state);
+    api_cc(h, other, 20, 127);
+    API_EXPECT(API_NEAR(api_get_float(h, other, "cutoff"), 1.0f), "learned CC lost in the state round trip");
+    h->api->set_param(other, "cc_map_reset", "1");
+    API_EXPECT(h->api->get_param(other, "cc_map", map, sizeof(map)) == 0, "cc_map_reset left %s", map);
+    api_cc(h, other, 74, 0);
+    API_EXPECT(API_NEAR(api_get_float(h, other, "cutoff"), 0.0f), "CC 74 not back on cutoff after cc_map_reset");
+    h->api->destroy_instance(other);
+
+    /* CC 123 releases every note, CC 120 also cuts the release */
+    h->api->set_param(inst, "release", "0.0");
+    harness_note(h, inst, 1, 60, 100);
+    harness_note(h, inst, 1, 64, 100);
+    api_render(h, inst, 4);
+    API_EXPECT(api_active_voices(h, inst) == 2, "expected 2 voices, got %d", api_active_voices(h, inst));
+    api_cc(h, inst, 123, 0);
+    api_render(h, inst, 64);
+    API_EXPECT(api_active_voices(h, inst) == 0, "CC 123 left %d voices held", api_active_voices(h, inst));
+    h->api->set_param(inst, "release", "1.0");
+    harness_note(h, inst, 1, 60, 100);
+    harness_note(h, inst, 1, 64, 100);
+    api_render(h, inst, 4);
+    api_cc(h, inst, 120, 0);
+    api_render(h, inst, 1);
+    API_EXPECT(api_active_voices(h, inst) == 0, "CC 120 left %d voices sounding", api_active_voices(h, inst));
+
+    h->api->destroy_instance(inst);
+    return 1;
+}
+
+/* =====================================================================
+ * sysex: a hostile patch dump is clamped or rejected, never trusted;
+ * on_midi_batch applies a dump at its frame and keeps order when its
+ * queue overflows
+ * ===================================================================== */
+
+static void api_sysex(harness_t *h, void *inst, const float *patch, const char *name) {
+    uint8_t msg[1024];
+    int len = patch_sysex_encode(patch, PARAM_COUNT, name, msg, sizeof(msg));
+    h->api->on_midi(inst, msg, len, MOVE_MIDI_SOURCE_EXTERNAL);
+}
+
+static int check_sysex(harness_t *h) {
+    static char json[16384];
+    char name[64];
+    float patch[PARAM_COUNT];
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(inst, "create_instance failed");
+    h->ext->get_telemetry(inst);
+
+    /* Out of range values are clamped, the name is made safe for JSON */
+    for (int i = 0; i < PARAM_COUNT; i++) patch[i] = 0.5f;
+    patch[VOICE_COUNT] = 4.0f;
+    patch[CUTOFF] = -3.0f;
+    patch[RESONANCE] = 1e30f;
+    api_sysex(h, inst, patch, "Evil\"Name\\\x01");
+    API_EXPECT(api_get_float(h, inst, "voice_count") <= 1.0f, "VOICE_COUNT 4.0 not clamped");
+    API_EXPECT(api_get_float(h, inst, "cutoff") == 0.0f, "cutoff -3 not clamped to 0");
+    API_EXPECT(api_get_float(h, inst, "resonance") == 1.0f, "resonance 1e30 not clamped to 1");
+    h->api->get_param(inst, "preset_name", name, sizeof(name));
+    API_EXPECT(strcmp(name, "EvilName") == 0, "name not sanitized: %s", name);
+    API_EXPECT(h->api->get_param(inst, "params_snapshot", json, sizeof(json)) > 0 && json_valid(json),
+               "params_snapshot is not valid JSON after the dump: %s", json);
+    API_EXPECT(h->api->get_param(inst, "state", json, sizeof(json)) > 0 && json_valid(json),
+               "state is not valid JSON after the dump: %s", json);
+    for (int n = 0; n < 40; n++) harness_note(h, inst, 1, 36 + n, 100);
+    api_render(h, inst, 8);
+    API_EXPECT(api_active_voices(h, inst) >= 1 && api_active_voices(h, inst) <= 32,
+               "%d voices after the clamped dump", api_active_voices(h, inst));
+
+    /* A NaN or infinite value rejects the whole dump */
+    h->api->set_param(inst, "cutoff", "0.5");
+    for (int i = 0; i < PARAM_COUNT; i++) patch[i] = 0.25f;
+    patch[RESONANCE] = NAN;
+    api_sysex(h, inst, patch, "NaN");
+    patch[RESONANCE] = 0.25f;
+    patch[VOLUME] = -INFINITY;
+    api_sysex(h, inst, patch, "Inf");
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.5f), "a dump with NaN or inf was applied");
+    h->api->get_param(inst, "preset_name", name, sizeof(name));
+    API_EXPECT(strcmp(name, "EvilName") == 0, "a rejected dump renamed the preset to %s", name);
+
+    /* A batched dump lands at its frame, after what comes before it, even in a later block */
+    uint8_t dump[1024];
+    for (int i = 0; i < PARAM_COUNT; i++) patch[i] = 0.25f;
+    int dump_len = patch_sysex_encode(patch, PARAM_COUNT, "Batched", dump, sizeof(dump));
+    obxd_midi_event_t batch[2] = {
+        {MOVE_FRAMES_PER_BLOCK + 5, 3, MOVE_MIDI_SOURCE_EXTERNAL, {0xB0, 74, 127}, NULL},
+        {MOVE_FRAMES_PER_BLOCK + 10, (uint16_t)dump_len, MOVE_MIDI_SOURCE_EXTERNAL, {0, 0, 0}, dump},
+    };
+    h->api->set_param(inst, "cutoff", "0.5");
+    h->ext->on_midi_batch(inst, batch, 2);
+    memset(dump, 0, sizeof(dump));
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.5f), "batched dump applied before render");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.5f), "batched dump applied a block early");
+    api_render(h, inst, 1);
+    API_EXPECT(API_NEAR(api_get_float(h, inst, "cutoff"), 0.25f),
+               "batched dump overtaken by an earlier CC: cutoff %.3f", api_get_float(h, inst, "cutoff"));
+    h->api->get_param(inst, "preset_name", name, sizeof(name));
+    API_EXPECT(strcmp(name, "Batched") == 0, "batched dump not applied from its copy: %s", name);
+
+    /* More events than the queue holds: the overflow may not overtake a queued note-on */
+    static obxd_midi_event_t events[MAX_PENDING_MIDI_EVENTS + 1];
+    h->api->set_param(inst, "release", "0.0");
+    harness_note(h, inst, 0, 0, 0);
+    for (int n = 0; n < 40; n++) harness_note(h, inst, 0, 36 + n, 0);
+    api_render(h, inst, 64);
+    API_EXPECT(api_active_voices(h, inst) == 0, "voices still sounding before the overflow test");
+    h->api->set_param(inst, "stats_reset", "1");
+    api_render(h, inst, 1);
+    int count = 0;
+    for (; count < MAX_PENDING_MIDI_EVENTS - 1; count++) {
+        obxd_midi_event_t e = {0, 3, MOVE_MIDI_SOURCE_EXTERNAL, {0xB0, 1, (uint8_t)(count & 0x7F)}, NULL};
+        events[count] = e;
+    }
+    obxd_midi_event_t on = {10, 3, MOVE_MIDI_SOURCE_EXTERNAL, {0x90, 60, 100}, NULL};
+    obxd_midi_event_t off = {20, 3, MOVE_MIDI_SOURCE_EXTERNAL, {0x80, 60, 0}, NULL};
+    events[count++] = on;
+    events[count++] = off;
+    h->ext->on_midi_batch(inst, events, count);
+    api_render(h, inst, 64);
+    API_EXPECT(api_active_voices(h, inst) == 0, "note stuck after an on_midi_batch overflow");
+    h->api->get_param(inst, "stats", json, sizeof(json));
+    API_EXPECT(strstr(json, "\"midi_overflows\":1,"), "overflow not counted: %s", json);
+
+    h->api->destroy_instance(inst);
+    return 1;
+}
+
+/* =====================================================================
+ * log_ring: records from many threads arrive whole, and every one is
+ * either delivered or counted as dropped
+ * ===================================================================== */
+
+#define LOG_PRODUCERS 4
+#define LOG_PER_PRODUCER 2000
+
+static const char g_log_full_msg[] = "[obxd] params_batch applied directly: render is not draining";
+static uint32_t g_log_seen;
+static uint32_t g_log_dropped;
+static uint32_t g_log_torn;
+
+static void log_tap(const char *msg) {
+    unsigned dropped;
+    if (strcmp(msg, g_log_full_msg) == 0) {
+        __atomic_add_fetch(&g_log_seen, 1, __ATOMIC_RELAXED);
+    } else if (sscanf(msg, "[obxd] %u log messages dropped", &dropped) == 1) {
+        __atomic_add_fetch(&g_log_dropped, dropped, __ATOMIC_RELAXED);
+    } else if (strncmp(msg, "[obxd] params_batch", 19) == 0) {
+        __atomic_add_fetch(&g_log_torn, 1, __ATOMIC_RELAXED);
+    }
+}
+
+typedef struct {
+    harness_t *h;
+    void *inst;
+    int done;
+} log_thread_t;
+
+/* Render never runs: every fifth params_batch finds the ring full, applies directly and logs once */
+static void *log_producer(void *arg) {
+    log_thread_t *a = (log_thread_t*)arg;
+    for (int i = 0; i < LOG_PER_PRODUCER * 5; i++) {
+        a->h->api->set_param(a->inst, "params_batch", "cutoff=0.5");
+    }
+    return NULL;
+}
+
+/* get_param drains the ring while the producers fill it */
+static void *log_drainer(void *arg) {
+    log_thread_t *a = (log_thread_t*)arg;
+    char buf[32];
+    while (!__atomic_load_n(&a->done, __ATOMIC_ACQUIRE)) {
+        a->h->api->get_param(a->inst, "params_version", buf, sizeof(buf));
+        sched_yield();
+    }
+    return NULL;
+}
+
+static int check_log_ring(harness_t *h) {
+    log_thread_t producers[LOG_PRODUCERS], drainer;
+    pthread_t threads[LOG_PRODUCERS], drain_thread;
+    char buf[32];
+
+    for (int i = 0; i < LOG_PRODUCERS; i++) {
+        producers[i].h = h;
+        producers[i].inst = h->api->create_instance(h->module_dir, NULL);
+        producers[i].done = 0;
+        API_EXPECT(producers[i].inst, "create_instance failed");
+        /* Fill the params_batch ring so the first batch of each producer applies directly */
+        for (int b = 0; b < 4; b++) h->api->set_param(producers[i].inst, "params_batch", "cutoff=0.5");
+    }
+    drainer = producers[0];
+    h->api->get_param(drainer.inst, "params_version", buf, sizeof(buf));
+
+    g_log_seen = g_log_dropped = g_log_torn = 0;
+    g_harness_log_tap = log_tap;
+    pthread_create(&drain_thread, NULL, log_drainer, &drainer);
+    for (int i = 0; i < LOG_PRODUCERS; i++) pthread_create(&threads[i], NULL, log_producer, &producers[i]);
+    for (int i = 0; i < LOG_PRODUCERS; i++) pthread_join(threads[i], NULL);
+    __atomic_store_n(&drainer.done, 1, __ATOMIC_RELEASE);
+    pthread_join(drain_thread, NULL);
+    h->api->get_param(drainer.inst, "params_version", buf, sizeof(buf));
+    g_harness_log_tap = NULL;
+
+    uint32_t expect = LOG_PRODUCERS * LOG_PER_PRODUCER;
+    API_EXPECT(g_log_torn == 0, "%u log records arrived torn", g_log_torn);
+    API_EXPECT(g_log_seen > 0, "no log record was delivered");
+    API_EXPECT(g_log_seen + g_log_dropped == expect,
+               "%u records delivered + %u dropped, expected %u in total", g_log_seen, g_log_dropped, expect);
+
+    for (int i = 0; i < LOG_PRODUCERS; i++) h->api->destroy_instance(producers[i].inst);
+    return 1;
+}
+
+/* =====================================================================
+ * oversampling: an enum whose options run in order and read back by
+ * name; bank patches with the legacy HQ switch on load at 2x
+ * ===================================================================== */
+
+static int check_oversampling(harness_t *h) {
+    static const struct { const char *limit, *param, *value, *rung; } cases[] = {
+        {"4x", "0", "1x", "1x"},
+        {"4x", "0.33", "2x-fast", "2x-fast"},
+        {"4x", "0.67", "2x", "2x"},
+        {"4x", "1", "4x", "4x"},
+        {"4x", "2x-fast", "2x-fast", "2x-fast"},
+        {"2x", "4x", "4x", "2x"},
+        {"1x", "2x", "2x", "1x"},
+    };
+    static char buf[8192];
+    char value[16], active[16];
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    API_EXPECT(inst, "create_instance failed");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        h->api->set_param(inst, "oversampling_limit", cases[i].limit);
+        h->api->set_param(inst, "oversampling", cases[i].param);
+        h->api->get_param(inst, "oversampling", value, sizeof(value));
+        h->api->get_param(inst, "oversampling_active", active, sizeof(active));
+        API_EXPECT(strcmp(value, cases[i].value) == 0, "oversampling=%s reads back as %s, expected %s",
+                   cases[i].param, value, cases[i].value);
+        API_EXPECT(strcmp(active, cases[i].rung) == 0, "oversampling=%s under limit %s runs %s, expected %s",
+                   cases[i].param, cases[i].limit, active, cases[i].rung);
+    }
+
+    /* The UI sees the options, the snapshot and params_batch use the names */
+    h->api->get_param(inst, "chain_params", buf, sizeof(buf));
+    API_EXPECT(strstr(buf, "\"key\":\"oversampling\",\"name\":\"Oversampling\",\"type\":\"enum\","
+                           "\"options\":[\"1x\",\"2x-fast\",\"2x\",\"4x\"]"),
+               "chain_params does not list the oversampling options");
+    h->api->set_param(inst, "oversampling_limit", "4x");
+    h->api->set_param(inst, "params_batch", "oversampling=2x-fast");
+    api_render(h, inst, 1);
+    h->api->get_param(inst, "params_snapshot", buf, sizeof(buf));
+    API_EXPECT(strstr(buf, "\"oversampling\":\"2x-fast\""), "snapshot misses the oversampling option: %.200s", buf);
+
+    /* Bank patches store 0 or 1: HQ on loads as 2x, never as another rung */
+    int presets = (int)api_get_float(h, inst, "preset_count"), hq = 0;
+    for (int i = 1; i <= presets; i++) {
+        int p = i % presets;  /* Preset 0, already current, last */
+        snprintf(buf, sizeof(buf), "%d", p);
+        h->api->set_param(inst, "preset", buf);
+        h->api->get_param(inst, "oversampling", value, sizeof(value));
+        API_EXPECT(strcmp(value, "1x") == 0 || strcmp(value, "2x") == 0, "preset %d loads oversampling %s", p, value);
+        hq += strcmp(value, "2x") == 0;
+    }
+    API_EXPECT(hq > 0, "no bank patch has HQ on, the legacy mapping went unchecked");
+    h->api->destroy_instance(inst);
+    return 1;
+}
+
+static const api_check_t g_api_checks[] = {
+    {"clone", check_clone},
+    {"snapshot", check_snapshot},
+    {"params_batch", check_params_batch},
+    {"midi_map", check_midi_map},
+    {"sysex", check_sysex},
+    {"log_ring", check_log_ring},
+    {"oversampling", check_oversampling},
+};
+
+/* api-check [--only NAME] */
+int cmd_api_check(harness_t *h, int argc, char **argv) {
+    const char *only = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) only = argv[++i];
+    }
+    if (!h->ext || !h->ext->clone_instance || !h->ext->on_midi_batch || !h->ext->get_telemetry) {
+        fprintf(stderr, "api-check: dsp.so has no extended API\n");
+        return 1;
+    }
+
+    int failed = 0, ran = 0;
+    for (size_t i = 0; i < sizeof(g_api_checks) / sizeof(g_api_checks[0]); i++) {
+        if (only && strcmp(only, g_api_checks[i].name) != 0) continue;
+        int ok = g_api_checks[i].run(h);
+        printf("{\"api_check\":{\"name\":\"%s\",\"ok\":%d}}\n", g_api_checks[i].name, ok);
+        if (!ok) failed++;
+        ran++;
+    }
+    if (ran == 0) {
+        fprintf(stderr, "api-check: no check named %s\n", only);
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * autosample.cpp - Auto-sampled fallback check and benchmark
+ *
+ * Plays the same chord pattern on two instances of one preset: one on
+ * engine voices only, one with set_param("autosample") on and its load
+ * threshold forced low, so every note it can take goes to the sampler.
+ * Reports block time and output level of both, the sampler status, and
+ * real-time violations on the sampled instance (render_block and on_midi
+ * run under rtcheck; the cache worker thread is not checked).
+ *
+ * Halfway through, the cutoff is moved on the sampled instance to check
+ * that held notes are handed back to the engine and the cache rebuilt.
+ */
+
+#include "harness_host.h"
+
+#include <math.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+typedef struct {
+    std::vector<double> block_us;
+    double sum_sq;
+    uint64_t samples;
+} autosample_run_t;
+
+/* Render blocks in real time-ish until the status matches, or timeout */
+static int autosample_wait(harness_t *h, void *inst, const char *needle, double timeout_s, std::string *status) {
+    char buf[1024];
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    uint64_t deadline = harness_now_ns() + (uint64_t)(timeout_s * 1e9);
+    while (harness_now_ns() < deadline) {
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        if (h->api->get_param(inst, "autosample", buf, sizeof(buf)) > 0) {
+            *status = buf;
+            if (strstr(buf, needle) || strstr(buf, "\"ineligible\"")) return strstr(buf, needle) != NULL;
+        }
+        usleep(2000);
+    }
+    return 0;
+}
+
+static void autosample_block(harness_t *h, void *inst, autosample_run_t *run, int checked) {
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    if (checked) rtcheck_enter("render_block");
+    uint64_t t0 = harness_now_ns();
+    h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+    uint64_t t1 = harness_now_ns();
+    if (checked) rtcheck_leave();
+    run->block_us.push_back((t1 - t0) / 1000.0);
+    for (int i = 0; i < MOVE_FRAMES_PER_BLOCK * 2; i++) run->sum_sq += (double)audio[i] * audio[i];
+    run->samples += MOVE_FRAMES_PER_BLOCK * 2;
+}
+
+static void autosample_note(harness_t *h, void *inst, int on, int note, int velocity, int checked) {
+    if (checked) rtcheck_enter("on_midi");
+    harness_note(h, inst, on, note, velocity);
+    if (checked) rtcheck_leave();
+}
+
+static void autosample_print_run(const char *name, autosample_run_t *run) {
+    std::vector<double> sorted = run->block_us;
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    double total = 0;
+    for (size_t i = 0; i < n; i++) total += sorted[i];
+    double rms = run->samples ? sqrt(run->sum_sq / run->samples) / 32768.0 : 0;
+    printf("\"%s\":{\"block_us\":{\"avg\":%.2f,\"p99\":%.2f,\"max\":%.2f},\"rms_db\":%.1f}",
+           name, n ? total / n : 0, n ? sorted[(n * 99) / 100] : 0, n ? sorted[n - 1] : 0,
+           rms > 0 ? 20.0 * log10(rms) : -120.0);
+}
+
+/* autosample [--bank N] [--preset N] [--seconds N] [--voices N] */
+int cmd_autosample(harness_t *h, int argc, char **argv) {
+    int bank = -1, preset = 0, voices = 6;
+    double seconds = 4.0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bank") == 0 && i + 1 < argc) bank = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--preset") == 0 && i + 1 < argc) preset = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--voices") == 0 && i + 1 < argc) voices = atoi(argv[++i]);
+    }
+    if (voices < 1) voices = 1;
+    if (voices > 16) voices = 16;
+
+    void *inst[2];
+    char buf[64];
+    for (int k = 0; k < 2; k++) {
+        inst[k] = h->api->create_instance(h->module_dir, NULL);
+        if (!inst[k]) {
+            fprintf(stderr, "autosample: create_instance failed\n");
+            return 1;
+        }
+        if (bank >= 0) {
+            snprintf(buf, sizeof(buf), "%d", bank);
+            h->api->set_param(inst[k], "bank_index", buf);
+        }
+        snprintf(buf, sizeof(buf), "%d", preset);
+        h->api->set_param(inst[k], "preset", buf);
+    }
+    h->api->set_param(inst[1], "autosample_load_pct", "0.01");
+    h->api->set_param(inst[1], "autosample", "1");
+
+    std::string status;
+    uint64_t t0 = harness_now_ns();
+    int ready = autosample_wait(h, inst[1], "\"ready\":1", 20.0, &status);
+    double ready_ms = (harness_now_ns() - t0) / 1e6;
+    if (!ready) {
+        h->api->destroy_instance(inst[0]);
+        h->api->destroy_instance(inst[1]);
+        int ineligible = strstr(status.c_str(), "\"ineligible\"") != NULL;
+        printf("{\"autosample\":{\"preset\":%d,\"status\":%s}}\n", preset, status.empty() ? "null" : status.c_str());
+        if (!ineligible) fprintf(stderr, "autosample: cache never became ready\n");
+        return ineligible ? 0 : 1;
+    }
+
+    /* Same chords on both: a new one every half second, cutoff moved halfway */
+    autosample_run_t runs[2];
+    for (int k = 0; k < 2; k++) {
+        runs[k].sum_sq = 0;
+        runs[k].samples = 0;
+    }
+    uint64_t violations_before = rtcheck_violations();
+    const int chord_frames = MOVE_SAMPLE_RATE / 2;
+    int total_blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    int chord[16];
+    int held = 0;
+    uint32_t seed = 4242;
+    int frame = 0;
+    for (int b = 0; b < total_blocks; b++) {
+        if (b == 0 || frame / chord_frames != (frame + MOVE_FRAMES_PER_BLOCK) / chord_frames) {
+            int root = 40 + harness_rand(&seed) % 24;
+            int vel = 40 + harness_rand(&seed) % 87;
+            for (int k = 0; k < 2; k++) {
+                for (int c = 0; c < held; c++) autosample_note(h, inst[k], 0, chord[c], 0, k);
+            }
+            held = voices;
+            for (int c = 0; c < held; c++) chord[c] = root + (c * 7) % 24 + (c / 4) * 12;
+            for (int k = 0; k < 2; k++) {
+                for (int c = 0; c < held; c++) autosample_note(h, inst[k], 1, chord[c], vel, k);
+            }
+        }
+        if (b == total_blocks / 2) h->api->set_param(inst[1], "cutoff", "0.3");
+        for (int k = 0; k < 2; k++) autosample_block(h, inst[k], &runs[k], k);
+        frame += MOVE_FRAMES_PER_BLOCK;
+    }
+    uint64_t violations = rtcheck_violations() - violations_before;
+
+    /* Let the worker rebuild for the moved patch */
+    int rebuilt = autosample_wait(h, inst[1], "\"ready\":1", 20.0, &status);
+    h->api->destroy_instance(inst[0]);
+    h->api->destroy_instance(inst[1]);
+
+    double avg[2];
+    for (int k = 0; k < 2; k++) {
+        double total = 0;
+        for (size_t i = 0; i < runs[k].block_us.size(); i++) total += runs[k].block_us[i];
+        avg[k] = runs[k].block_us.empty() ? 0 : total / runs[k].block_us.size();
+    }
+
+    printf("{\"autosample\":{\"preset\":%d,\"voices\":%d,\"ready_ms\":%.0f,", preset, voices, ready_ms);
+    autosample_print_run("synth", &runs[0]);
+    printf(",");
+    autosample_print_run("sampled", &runs[1]);
+    printf(",\"speedup\":%.2f,\"rebuilt\":%d,\"rt_violations\":%llu,\"status\":%s}}\n",
+           avg[1] > 0 ? avg[0] / avg[1] : 0, rebuilt, (unsigned long long)violations, status.c_str());
+
+    int sampled = strstr(status.c_str(), "\"sampled_notes\":0,") == NULL;
+    return violations == 0 && sampled && rebuilt ? 0 : 1;
+}
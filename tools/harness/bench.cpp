@@ -0,0 +1,269 @@
+/*
+ * bench.cpp - Whole-plugin render benchmark
+ *
+ * Plays held chords through render_block and reports per-block timing
+ * (average, p50, p99, max, load against the 128-frame budget). With
+ * --counters the MIDI and render regions are also wrapped in perf_event
+ * counter groups, so a slowdown can be attributed to cache misses, branch
+ * misses or plain instruction count. Per-kernel regions are available
+ * from bench-dsp --counters.
+ */
+
+#include "harness_host.h"
+#include "perf_counters.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+typedef struct {
+    double seconds;
+    int bank, preset, voices, counters;
+    const char *oversampling;   /* Rung forced on the preset, NULL = as the preset has it */
+} bench_opts_t;
+
+/*
+ * Held chords of `voices` notes, a new one every half second, released
+ * just before it. Appends each render_block time to block_us; with a
+ * counter group, MIDI and render are also accumulated as regions.
+ */
+static void bench_play(harness_t *h, void *inst, int voices, int total_blocks, const perf_group_t *group,
+                       perf_region_t *midi_region, perf_region_t *render_region, std::vector<double> *block_us) {
+    const int chord_frames = MOVE_SAMPLE_RATE / 2;
+    int chord[32];
+    int held = 0;
+    uint32_t seed = 777;
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+
+    block_us->reserve(block_us->size() + total_blocks);
+    int frame = 0;
+    for (int b = 0; b < total_blocks; b++) {
+        int event = frame / chord_frames != (frame + MOVE_FRAMES_PER_BLOCK) / chord_frames || b == 0;
+        if (event) {
+            if (group) perf_region_begin(group, midi_region);
+            for (int c = 0; c < held; c++) harness_note(h, inst, 0, chord[c], 0);
+            int root = 36 + harness_rand(&seed) % 24;
+            held = voices < 32 ? voices : 32;
+            for (int c = 0; c < held; c++) {
+                chord[c] = root + (c * 7) % 36 + (c / 5) * 12;
+                harness_note(h, inst, 1, chord[c], 70 + harness_rand(&seed) % 50);
+            }
+            if (group) perf_region_end(group, midi_region);
+        }
+
+        if (group) perf_region_begin(group, render_region);
+        uint64_t t0 = harness_now_ns();
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        uint64_t t1 = harness_now_ns();
+        if (group) perf_region_end(group, render_region);
+
+        block_us->push_back((t1 - t0) / 1000.0);
+        frame += MOVE_FRAMES_PER_BLOCK;
+    }
+}
+
+/* One run with the given render kernel variant (NULL = the plugin's pick) */
+static int bench_run(harness_t *h, const bench_opts_t *o, const char *kernels) {
+    double seconds = o->seconds;
+    int bank = o->bank, preset = o->preset, voices = o->voices, counters = o->counters;
+
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "bench: create_instance failed\n");
+        return 1;
+    }
+    char buf[64];
+    if (kernels) h->api->set_param(inst, "kernel_variant", kernels);
+    if (h->api->get_param(inst, "kernel_variant", buf, sizeof(buf)) <= 0) snprintf(buf, sizeof(buf), "unknown");
+    std::string kernel_name = buf;
+    if (bank >= 0) {
+        snprintf(buf, sizeof(buf), "%d", bank);
+        h->api->set_param(inst, "bank_index", buf);
+    }
+    if (preset >= 0) {
+        snprintf(buf, sizeof(buf), "%d", preset);
+        h->api->set_param(inst, "preset", buf);
+    }
+    if (o->oversampling) {
+        /* Patch asks for the top rung, the limit brings it down to the one wanted */
+        h->api->set_param(inst, "oversampling_limit", o->oversampling);
+        h->api->set_param(inst, "oversampling", "4x");
+    }
+    if (h->api->get_param(inst, "oversampling_active", buf, sizeof(buf)) <= 0) snprintf(buf, sizeof(buf), "1x");
+    std::string oversampling = buf;
+
+    perf_group_t group;
+    memset(&group, 0, sizeof(group));
+    int opened = counters ? perf_group_open(&group) : 0;
+    if (counters && opened == 0) fprintf(stderr, "bench: perf_event_open refused, counters unavailable\n");
+    perf_region_t midi_region, render_region;
+    perf_region_reset(&midi_region);
+    perf_region_reset(&render_region);
+
+    int total_blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    std::vector<double> block_us;
+    bench_play(h, inst, voices, total_blocks, counters ? &group : NULL, &midi_region, &render_region, &block_us);
+    h->api->destroy_instance(inst);
+    if (kernels && strcmp(kernels, kernel_name.c_str()) != 0 && strcmp(kernels, "auto") != 0) {
+        fprintf(stderr, "bench: kernel variant %s not supported here, ran %s\n", kernels, kernel_name.c_str());
+    }
+
+    double total = 0;
+    for (size_t i = 0; i < block_us.size(); i++) total += block_us[i];
+    std::vector<double> sorted = block_us;
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    double budget_us = MOVE_FRAMES_PER_BLOCK * 1e6 / MOVE_SAMPLE_RATE;
+    double avg = n ? total / n : 0;
+
+    printf("{\"bench\":{\"kernels\":\"%s\",\"oversampling\":\"%s\",\"blocks\":%zu,\"voices\":%d,\"block_us\":{\"avg\":%.2f,\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f},"
+           "\"load_pct\":%.2f",
+           kernel_name.c_str(), oversampling.c_str(), n, voices, avg, n ? sorted[n / 2] : 0, n ? sorted[(n * 99) / 100] : 0, n ? sorted[n - 1] : 0,
+           avg * 100.0 / budget_us);
+    if (counters) {
+        printf(",\"regions\":[{\"name\":\"midi\",\"calls\":%llu,\"us\":%.1f,",
+               (unsigned long long)midi_region.calls, midi_region.ns / 1000.0);
+        perf_region_print_json(&group, &midi_region, 0, NULL);
+        printf("},{\"name\":\"render_block\",\"calls\":%llu,\"us\":%.1f,",
+               (unsigned long long)render_region.calls, render_region.ns / 1000.0);
+        perf_region_print_json(&group, &render_region, (double)n * MOVE_FRAMES_PER_BLOCK, "sample");
+        printf("}]");
+        perf_group_close(&group);
+    }
+    printf("}}\n");
+    return 0;
+}
+
+/* bench [--seconds N] [--bank N] [--preset N] [--voices N] [--counters] [--kernels NAME|all] [--oversampling RUNG|all] */
+int cmd_bench(harness_t *h, int argc, char **argv) {
+    bench_opts_t o = {10.0, -1, -1, 6, 0, NULL};
+    const char *kernels = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) o.seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--bank") == 0 && i + 1 < argc) o.bank = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--preset") == 0 && i + 1 < argc) o.preset = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--voices") == 0 && i + 1 < argc) o.voices = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--counters") == 0) o.counters = 1;
+        else if (strcmp(argv[i], "--kernels") == 0 && i + 1 < argc) kernels = argv[++i];
+        else if (strcmp(argv[i], "--oversampling") == 0 && i + 1 < argc) o.oversampling = argv[++i];
+    }
+    if (o.voices < 1) o.voices = 1;
+    if (o.oversampling && strcmp(o.oversampling, "all") == 0) {
+        /* Cost of each rung of the ladder, cheapest first */
+        static const char *rungs[] = {"1x", "2x-fast", "2x", "4x"};
+        int failed = 0;
+        for (int r = 0; r < 4; r++) {
+            o.oversampling = rungs[r];
+            failed |= bench_run(h, &o, kernels);
+        }
+        return failed;
+    }
+    if (!kernels || strcmp(kernels, "all") != 0) return bench_run(h, &o, kernels);
+
+    /* One run per variant this CPU supports, as listed by the plugin */
+    char list[256];
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "bench: create_instance failed\n");
+        return 1;
+    }
+    int len = h->api->get_param(inst, "kernel_variants", list, sizeof(list));
+    h->api->destroy_instance(inst);
+    if (len <= 0) {
+        fprintf(stderr, "bench: dsp.so has no kernel variants\n");
+        return 1;
+    }
+
+    int failed = 0;
+    const char *p = list;
+    while ((p = strchr(p, '"')) != NULL) {
+        const char *end = strchr(p + 1, '"');
+        if (!end) break;
+        std::string name(p + 1, end - p - 1);
+        failed |= bench_run(h, &o, name.c_str());
+        p = end + 1;
+    }
+    return failed;
+}
+
+/* Average block time of one fresh instance playing the bench pattern on a preset */
+static double compare_preset_us(harness_t *h, int preset, int blocks, int voices) {
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) return -1.0;
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%d", preset);
+    h->api->set_param(inst, "preset", buf);
+
+    std::vector<double> block_us;
+    bench_play(h, inst, voices, blocks, NULL, NULL, NULL, &block_us);
+    h->api->destroy_instance(inst);
+
+    double total = 0;
+    for (size_t i = 0; i < block_us.size(); i++) total += block_us[i];
+    return total / block_us.size();
+}
+
+/*
+ * compare BASE.so NEW.so [--seconds N] [--rounds N] [--voices N] [--step N]
+ *
+ * Runs the bench pattern over every --step'th preset with both builds,
+ * alternating between them so thermal and frequency drift hit both alike.
+ * Each preset keeps its best round per build. Reports the summed average
+ * block time per build and the speedup of NEW over BASE.
+ */
+int cmd_compare(harness_t *h, int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: compare BASE.so NEW.so [--seconds N] [--rounds N] [--voices N] [--step N]\n");
+        return 2;
+    }
+    double seconds = 1.0;
+    int rounds = 3, voices = 6, step = 8;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) rounds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--voices") == 0 && i + 1 < argc) voices = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--step") == 0 && i + 1 < argc) step = atoi(argv[++i]);
+    }
+    if (rounds < 1) rounds = 1;
+    if (step < 1) step = 1;
+
+    harness_t builds[2];
+    for (int b = 0; b < 2; b++) {
+        memset(&builds[b], 0, sizeof(builds[b]));
+        if (harness_load(&builds[b], argv[1 + b], h->module_dir) != 0) return 1;
+    }
+
+    int preset_count = 1;
+    char buf[32];
+    void *probe = builds[0].api->create_instance(h->module_dir, NULL);
+    if (probe) {
+        if (builds[0].api->get_param(probe, "preset_count", buf, sizeof(buf)) > 0) preset_count = atoi(buf);
+        builds[0].api->destroy_instance(probe);
+    }
+
+    int blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    double sum[2] = {0, 0};
+    int presets = 0;
+    for (int p = 0; p < preset_count; p += step) {
+        double best[2] = {1e30, 1e30};
+        for (int r = 0; r < rounds; r++) {
+            for (int b = 0; b < 2; b++) {
+                /* Alternate which build goes first */
+                int which = (r & 1) ? 1 - b : b;
+                double us = compare_preset_us(&builds[which], p, blocks, voices);
+                if (us >= 0 && us < best[which]) best[which] = us;
+            }
+        }
+        sum[0] += best[0];
+        sum[1] += best[1];
+        presets++;
+        if (g_harness_verbose) {
+            fprintf(stderr, "preset %d: base %.2f us, new %.2f us\n", p, best[0], best[1]);
+        }
+    }
+
+    printf("{\"compare\":{\"base\":\"%s\",\"new\":\"%s\",\"presets\":%d,\"rounds\":%d,"
+           "\"base_block_us\":%.2f,\"new_block_us\":%.2f,\"speedup\":%.3f}}\n",
+           argv[1], argv[2], presets, rounds, sum[0] / presets, sum[1] / presets, sum[0] / sum[1]);
+    return 0;
+}
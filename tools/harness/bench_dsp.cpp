@@ -0,0 +1,326 @@
+/*
+ * bench_dsp.cpp - Per-component DSP micro-benchmarks
+ *
+ * Each kernel runs over a table of parameters drawn from the ranges the
+ * engine actually feeds it (cutoffs across the audio band, oscillator
+ * deltas for notes 24..96, envelope times from presets, ...), so a change
+ * to one kernel can be measured in isolation and compared across
+ * x86_64 and aarch64 builds of the same source.
+ */
+
+#include "harness_host.h"
+#include "perf_counters.h"
+#include "Engine/SynthEngine.h"
+
+#include <algorithm>
+#include <vector>
+
+#define BENCH_TABLE 4096  /* Parameter table length, power of two */
+#define BENCH_RUNS 7      /* Timed runs per kernel, median reported */
+
+typedef struct {
+    float in[BENCH_TABLE];       /* Audio-ish input in -1..1 */
+    float cutoff[BENCH_TABLE];   /* Filter cutoff in Hz, log-uniform 30..18000 */
+    float delta[BENCH_TABLE];    /* Oscillator phase increment, notes 24..96 */
+    float pw[BENCH_TABLE];       /* Pulse width 0.1..0.9 */
+    float pitch[BENCH_TABLE];    /* getPitch index (note - 81 + osc offsets), -60..40 */
+} bench_tables_t;
+
+static volatile float g_sink;
+
+static void bench_tables_init(bench_tables_t *t) {
+    uint32_t seed = 4242;
+    for (int i = 0; i < BENCH_TABLE; i++) {
+        float u = (harness_rand(&seed) & 0xFFFF) / 65535.0f;
+        t->in[i] = u * 2.0f - 1.0f;
+        t->cutoff[i] = 30.0f * powf(600.0f, (harness_rand(&seed) & 0xFFFF) / 65535.0f);
+        float note = 24.0f + (harness_rand(&seed) % 7200) / 100.0f;
+        t->delta[i] = getPitch(note - 81.0f) / MOVE_SAMPLE_RATE;
+        t->pw[i] = 0.1f + 0.8f * ((harness_rand(&seed) & 0xFFFF) / 65535.0f);
+        t->pitch[i] = -60.0f + (harness_rand(&seed) % 10000) / 100.0f;
+    }
+}
+
+/* ---- Kernels: each processes n samples and returns an accumulated value ---- */
+
+static float k_filter_2pole(const bench_tables_t *t, int n) {
+    Filter f;
+    f.setSampleRate(MOVE_SAMPLE_RATE);
+    f.setResonance(0.6f);
+    f.setMultimode(0.2f);
+    float acc = 0;
+    for (int i = 0; i < n; i++) {
+        int k = i & (BENCH_TABLE - 1);
+        acc += f.Apply(t->in[k], t->cutoff[k]);
+    }
+    return acc;
+}
+
+static float k_filter_4pole(const bench_tables_t *t, int n) {
+    Filter f;
+    f.setSampleRate(MOVE_SAMPLE_RATE);
+    f.setResonance(0.6f);
+    f.setMultimode(0.2f);
+    float acc = 0;
+    for (int i = 0; i < n; i++) {
+        int k = i & (BENCH_TABLE - 1);
+        acc += f.Apply4Pole(t->in[k], t->cutoff[k]);
+    }
+    return acc;
+}
+
+/* Same phase bookkeeping as ObxdOscillatorB::ProcessSample, note changes every 256 samples */
+template <typename Osc>
+static float osc_master(Osc &o, const bench_tables_t *t, int n, float (*value)(Osc &, float, float)) {
+    float x = 0, acc = 0;
+    for (int i = 0; i < n; i++) {
+        float fs = t->delta[(i >> 8) & (BENCH_TABLE - 1)];
+        x += fs;
+        o.processMaster(x, fs);
+        if (x >= 1.0f) x -= 1.0f;
+        acc += value(o, x, 0) + o.aliasReduction();
+    }
+    return acc;
+}
+
+template <typename Osc>
+static float osc_slave(Osc &o, const bench_tables_t *t, int n, bool sync, float (*value)(Osc &, float, float)) {
+    float x1 = 0, x2 = 0, acc = 0;
+    for (int i = 0; i < n; i++) {
+        int k = (i >> 8) & (BENCH_TABLE - 1);
+        float fs1 = t->delta[k];
+        float fs2 = fs1 * 1.4983f;  /* Osc2 a fifth up */
+        x1 += fs1;
+        bool hsr = false;
+        float hsfrac = 0;
+        if (x1 >= 1.0f) {
+            x1 -= 1.0f;
+            hsfrac = x1 / fs1;
+            hsr = sync;
+        }
+        x2 += fs2;
+        o.processSlave(x2, fs2, hsr, hsfrac);
+        if (x2 >= 1.0f) x2 -= 1.0f;
+        if (hsr) x2 = fs2 * hsfrac;
+        acc += value(o, x2, 0) + o.aliasReduction();
+    }
+    return acc;
+}
+
+static float saw_value(SawOsc &o, float x, float) { return o.getValue(x); }
+static float tri_value(TriangleOsc &o, float x, float) { return o.getValue(x); }
+
+static float k_saw_master(const bench_tables_t *t, int n) { SawOsc o; return osc_master(o, t, n, saw_value); }
+static float k_saw_slave(const bench_tables_t *t, int n) { SawOsc o; return osc_slave(o, t, n, false, saw_value); }
+static float k_saw_sync(const bench_tables_t *t, int n) { SawOsc o; return osc_slave(o, t, n, true, saw_value); }
+static float k_tri_master(const bench_tables_t *t, int n) { TriangleOsc o; return osc_master(o, t, n, tri_value); }
+static float k_tri_slave(const bench_tables_t *t, int n) { TriangleOsc o; return osc_slave(o, t, n, false, tri_value); }
+static float k_tri_sync(const bench_tables_t *t, int n) { TriangleOsc o; return osc_slave(o, t, n, true, tri_value); }
+
+/* PulseOsc takes the pulse width, current and previous, as extra arguments */
+static float pulse_run(const bench_tables_t *t, int n, int slave, bool sync) {
+    PulseOsc o;
+    float x1 = 0, x2 = 0, acc = 0, pww = 0.5f;
+    for (int i = 0; i < n; i++) {
+        int k = (i >> 8) & (BENCH_TABLE - 1);
+        float pw = t->pw[k];
+        float fs1 = t->delta[k];
+        x1 += fs1;
+        if (!slave) {
+            o.processMaster(x1, fs1, pw, pww);
+            if (x1 >= 1.0f) x1 -= 1.0f;
+            acc += o.getValue(x1, pw) + o.aliasReduction();
+        } else {
+            float fs2 = fs1 * 1.4983f;
+            bool hsr = false;
+            float hsfrac = 0;
+            if (x1 >= 1.0f) {
+                x1 -= 1.0f;
+                hsfrac = x1 / fs1;
+                hsr = sync;
+            }
+            x2 += fs2;
+            o.processSlave(x2, fs2, hsr, hsfrac, pw, pww);
+            if (x2 >= 1.0f) x2 -= 1.0f;
+            if (hsr) x2 = fs2 * hsfrac;
+            acc += o.getValue(x2, pw) + o.aliasReduction();
+        }
+        pww = pw;
+    }
+    return acc;
+}
+
+static float k_pulse_master(const bench_tables_t *t, int n) { return pulse_run(t, n, 0, false); }
+static float k_pulse_slave(const bench_tables_t *t, int n) { return pulse_run(t, n, 1, false); }
+static float k_pulse_sync(const bench_tables_t *t, int n) { return pulse_run(t, n, 1, true); }
+
+/* Notes of 2000..12000 samples with preset-like times, all four stages visited */
+static float k_adsr(const bench_tables_t *t, int n) {
+    AdsrEnvelope e;
+    e.setSampleRate(MOVE_SAMPLE_RATE);
+    float acc = 0;
+    int next = 0, note = 0;
+    bool held = false;
+    for (int i = 0; i < n; i++) {
+        if (i >= next) {
+            int k = note++ & (BENCH_TABLE - 1);
+            if (!held) {
+                e.setAttack(1.0f + 200.0f * (t->pw[k] - 0.1f));
+                e.setDecay(5.0f + 800.0f * (t->pw[(k + 1) & (BENCH_TABLE - 1)] - 0.1f));
+                e.setSustain(t->pw[(k + 2) & (BENCH_TABLE - 1)]);
+                e.setRelease(10.0f + 1500.0f * (t->pw[(k + 3) & (BENCH_TABLE - 1)] - 0.1f));
+                e.triggerAttack();
+            } else {
+                e.triggerRelease();
+            }
+            held = !held;
+            next = i + 2000 + (int)(t->pw[k] * 12500.0f);
+        }
+        acc += e.processSample();
+    }
+    return acc;
+}
+
+static float k_decimator17(const bench_tables_t *t, int n) {
+    Decimator17 d;
+    float acc = 0;
+    for (int i = 0; i < n; i++) {
+        int k = i & (BENCH_TABLE - 1);
+        acc += d.Calc(t->in[k], t->in[(k + 1) & (BENCH_TABLE - 1)]);
+    }
+    return acc;
+}
+
+static float k_decimator9(const bench_tables_t *t, int n) {
+    Decimator9 d;
+    float acc = 0;
+    for (int i = 0; i < n; i++) {
+        int k = i & (BENCH_TABLE - 1);
+        acc += d.Calc(t->in[k], t->in[(k + 1) & (BENCH_TABLE - 1)]);
+    }
+    return acc;
+}
+
+static float k_lfo(const bench_tables_t *t, int n) {
+    Lfo l;
+    l.setSamlpeRate(MOVE_SAMPLE_RATE);
+    l.waveForm = 7;  /* Sine + square + S&H: every branch of getVal */
+    float acc = 0;
+    for (int i = 0; i < n; i++) {
+        if ((i & 4095) == 0) l.setFrequency(0.1f + t->pw[(i >> 12) & (BENCH_TABLE - 1)] * 40.0f);
+        l.update();
+        acc += l.getVal();
+    }
+    return acc;
+}
+
+static float k_get_pitch(const bench_tables_t *t, int n) {
+    float acc = 0;
+    for (int i = 0; i < n; i++) acc += getPitch(t->pitch[i & (BENCH_TABLE - 1)]);
+    return acc;
+}
+
+typedef struct {
+    const char *name;
+    float (*run)(const bench_tables_t *t, int n);
+} bench_kernel_t;
+
+static const bench_kernel_t g_kernels[] = {
+    {"filter_apply",       k_filter_2pole},
+    {"filter_apply4pole",  k_filter_4pole},
+    {"saw_master",         k_saw_master},
+    {"saw_slave",          k_saw_slave},
+    {"saw_slave_sync",     k_saw_sync},
+    {"pulse_master",       k_pulse_master},
+    {"pulse_slave",        k_pulse_slave},
+    {"pulse_slave_sync",   k_pulse_sync},
+    {"triangle_master",    k_tri_master},
+    {"triangle_slave",     k_tri_slave},
+    {"triangle_slave_sync", k_tri_sync},
+    {"adsr_process",       k_adsr},
+    {"decimator17_calc",   k_decimator17},
+    {"decimator9_calc",    k_decimator9},
+    {"lfo_update",         k_lfo},
+    {"get_pitch",          k_get_pitch},
+};
+
+static const char *bench_arch(void) {
+#if defined(__aarch64__)
+    return "aarch64";
+#elif defined(__x86_64__)
+    return "x86_64";
+#else
+    return "unknown";
+#endif
+}
+
+/* bench-dsp [--samples N] [--only SUBSTR] [--ghz F] [--counters] */
+int cmd_bench_dsp(harness_t *h, int argc, char **argv) {
+    (void)h;
+    int samples = 1 << 18;
+    const char *only = NULL;
+    double ghz = 0;
+    int counters = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) samples = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) only = argv[++i];
+        else if (strcmp(argv[i], "--ghz") == 0 && i + 1 < argc) ghz = atof(argv[++i]);
+        else if (strcmp(argv[i], "--counters") == 0) counters = 1;
+    }
+
+    bench_tables_t *tables = new bench_tables_t;
+    bench_tables_init(tables);
+
+    cycle_counter_t cc;
+    cycle_counter_open(&cc, ghz);
+
+    /* Each kernel's timed runs form one counter region */
+    perf_group_t group;
+    if (counters && perf_group_open(&group) == 0) {
+        fprintf(stderr, "bench-dsp: perf_event_open refused, counters unavailable\n");
+    }
+
+    printf("{\"bench_dsp\":{\"arch\":\"%s\",\"samples\":%d,\"cycles_source\":\"%s\",\"kernels\":[",
+           bench_arch(), samples, cc.source);
+
+    int first = 1;
+    for (size_t k = 0; k < sizeof(g_kernels) / sizeof(g_kernels[0]); k++) {
+        if (only && !strstr(g_kernels[k].name, only)) continue;
+
+        g_sink = g_kernels[k].run(tables, samples / 8);  /* Warm caches and branch predictors */
+
+        std::vector<double> ns(BENCH_RUNS), cycles(BENCH_RUNS);
+        perf_region_t region;
+        perf_region_reset(&region);
+        for (int r = 0; r < BENCH_RUNS; r++) {
+            if (counters) perf_region_begin(&group, &region);
+            uint64_t c0 = cycle_counter_read(&cc);
+            uint64_t t0 = harness_now_ns();
+            g_sink = g_kernels[k].run(tables, samples);
+            uint64_t t1 = harness_now_ns();
+            uint64_t c1 = cycle_counter_read(&cc);
+            if (counters) perf_region_end(&group, &region);
+            ns[r] = (double)(t1 - t0) / samples;
+            cycles[r] = cycle_counter_cycles(&cc, c0, c1, t1 - t0) / samples;
+        }
+        std::vector<double> sorted_ns = ns;
+        std::sort(sorted_ns.begin(), sorted_ns.end());
+        std::sort(cycles.begin(), cycles.end());
+
+        printf("%s\n  {\"name\":\"%s\",\"ns_per_sample\":%.3f,\"min_ns_per_sample\":%.3f",
+               first ? "" : ",", g_kernels[k].name, sorted_ns[BENCH_RUNS / 2], sorted_ns[0]);
+        if (cycles[BENCH_RUNS / 2] >= 0) printf(",\"cycles_per_sample\":%.2f", cycles[BENCH_RUNS / 2]);
+        if (counters) {
+            printf(",");
+            perf_region_print_json(&group, &region, (double)samples * BENCH_RUNS, "sample");
+        }
+        printf("}");
+        first = 0;
+    }
+    printf("\n]}}\n");
+
+    if (counters) perf_group_close(&group);
+    cycle_counter_close(&cc);
+    delete tables;
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * cost_survey.cpp - Preset CPU cost survey
+ *
+ * Renders the same note pattern through every preset of every bank and
+ * writes presets/cost_index.tsv, which the plugin loads at create time and
+ * serves as get_param("preset_cost") / get_param("preset_costs").
+ *
+ * Cost is measured per sounding voice: block time minus the preset's idle
+ * block time, divided by the active voice count the plugin publishes in
+ * its telemetry. The idle time is kept as its own column since presets with
+ * economy mode off run every voice whether it sounds or not; the relative
+ * cost is based on the mean block time, which covers both. The pattern is played several times and each block keeps
+ * its fastest run, which filters out scheduler noise.
+ */
+
+#include "harness_host.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define SURVEY_IDLE_BLOCKS 32
+
+typedef struct {
+    std::string bank;
+    std::string name;
+    int preset;
+    double avg_us;      /* Per sounding voice, above the idle floor */
+    double peak_us;
+    double idle_us;     /* Block time with no notes (all voices run when economy mode is off) */
+    double block_us;    /* Mean block time over the pattern, what rel is based on */
+} survey_entry_t;
+
+/* Note pattern, frames from the start of the run: held chord, release tail, fast repeats */
+#define SURVEY_CHORD_NOTES 6
+static const int g_chord[SURVEY_CHORD_NOTES] = {36, 48, 55, 60, 64, 79};
+
+static void survey_events(harness_t *h, void *inst, int frame, int block_frames, int pattern_frames) {
+    const int release_at = pattern_frames / 2;
+    const int repeat_at = pattern_frames * 3 / 4;
+    const int repeat_step = MOVE_SAMPLE_RATE / 20;
+    int end = frame + block_frames;
+
+    if (frame == 0) {
+        for (int i = 0; i < SURVEY_CHORD_NOTES; i++) harness_note(h, inst, 1, g_chord[i], 100);
+    }
+    if (frame <= release_at && release_at < end) {
+        for (int i = 0; i < SURVEY_CHORD_NOTES; i++) harness_note(h, inst, 0, g_chord[i], 0);
+    }
+    for (int t = repeat_at; t < pattern_frames; t += repeat_step) {
+        if (t < frame || t >= end) continue;
+        int note = 40 + ((t - repeat_at) / repeat_step) * 7 % 48;
+        harness_note(h, inst, 1, note, 90);
+        harness_note(h, inst, 0, note, 0);
+    }
+}
+
+/* Render one preset: returns 0 and fills the cost fields of e, -1 if no voice sounded */
+static int survey_preset(harness_t *h, void *inst, int pattern_blocks, int repeats, survey_entry_t *e) {
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    const obxd_telemetry_t *tel = h->ext->get_telemetry(inst);
+
+    /* Idle cost with no notes: the floor subtracted from every block */
+    std::vector<double> idle(SURVEY_IDLE_BLOCKS);
+    for (int b = 0; b < SURVEY_IDLE_BLOCKS; b++) {
+        uint64_t t0 = harness_now_ns();
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        idle[b] = (harness_now_ns() - t0) / 1000.0;
+    }
+    std::sort(idle.begin(), idle.end());
+    double idle_us = idle[SURVEY_IDLE_BLOCKS / 2];
+
+    std::vector<double> best(pattern_blocks, 1e30);
+    std::vector<int> voices(pattern_blocks, 0);
+    for (int r = 0; r < repeats; r++) {
+        for (int b = 0; b < pattern_blocks; b++) {
+            survey_events(h, inst, b * MOVE_FRAMES_PER_BLOCK, MOVE_FRAMES_PER_BLOCK,
+                          pattern_blocks * MOVE_FRAMES_PER_BLOCK);
+            uint64_t t0 = harness_now_ns();
+            h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+            double us = (harness_now_ns() - t0) / 1000.0;
+            if (us < best[b]) best[b] = us;
+            if (r == 0) voices[b] = tel->active_voices;
+        }
+        /* Let release tails die before the next repeat (up to 2 s) */
+        uint8_t all_off[3] = {0xB0, 123, 0};
+        h->api->on_midi(inst, all_off, 3, MOVE_MIDI_SOURCE_INTERNAL);
+        for (int b = 0; b < 700 && tel->active_voices > 0; b++) {
+            h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        }
+    }
+
+    double total_us = 0, peak = 0, block_total = 0;
+    long voice_blocks = 0;
+    for (int b = 0; b < pattern_blocks; b++) {
+        block_total += best[b];
+        if (voices[b] <= 0) continue;
+        double cost = best[b] - idle_us;
+        if (cost < 0) cost = 0;
+        total_us += cost;
+        voice_blocks += voices[b];
+        if (cost / voices[b] > peak) peak = cost / voices[b];
+    }
+    if (voice_blocks == 0) return -1;
+    e->avg_us = total_us / voice_blocks;
+    e->peak_us = peak;
+    e->idle_us = idle_us;
+    e->block_us = block_total / pattern_blocks;
+    return 0;
+}
+
+/* cost-survey [--seconds N] [--repeats N] [--out FILE] */
+int cmd_cost_survey(harness_t *h, int argc, char **argv) {
+    double seconds = 1.0;
+    int repeats = 3;
+    std::string out = std::string(h->module_dir) + "/presets/cost_index.tsv";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) repeats = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) out = argv[++i];
+    }
+    if (repeats < 1) repeats = 1;
+    if (!h->ext || h->ext->struct_size <= offsetof(obxd_ext_api_t, get_telemetry)) {
+        fprintf(stderr, "cost-survey: dsp.so has no get_telemetry, cannot count voices\n");
+        return 1;
+    }
+
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "cost-survey: create_instance failed\n");
+        return 1;
+    }
+
+    int pattern_blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    if (pattern_blocks < 16) pattern_blocks = 16;
+
+    char buf[256];
+    int bank_count = 1;
+    if (h->api->get_param(inst, "bank_count", buf, sizeof(buf)) > 0) bank_count = atoi(buf);
+
+    std::vector<survey_entry_t> entries;
+    int silent = 0;
+    for (int bank = 0; bank < bank_count; bank++) {
+        snprintf(buf, sizeof(buf), "%d", bank);
+        h->api->set_param(inst, "bank_index", buf);
+        std::string bank_name;
+        if (h->api->get_param(inst, "bank_name", buf, sizeof(buf)) > 0) bank_name = buf;
+        int preset_count = 0;
+        if (h->api->get_param(inst, "preset_count", buf, sizeof(buf)) > 0) preset_count = atoi(buf);
+
+        for (int preset = 0; preset < preset_count; preset++) {
+            snprintf(buf, sizeof(buf), "%d", preset);
+            h->api->set_param(inst, "preset", buf);
+            survey_entry_t e;
+            e.bank = bank_name;
+            e.preset = preset;
+            if (h->api->get_param(inst, "preset_name", buf, sizeof(buf)) > 0) e.name = buf;
+            if (survey_preset(h, inst, pattern_blocks, repeats, &e) != 0) {
+                silent++;
+                continue;
+            }
+            entries.push_back(e);
+            if (g_harness_verbose) {
+                fprintf(stderr, "%s/%d %s: avg %.2f us peak %.2f us per voice, idle %.2f us, block %.2f us\n",
+                        e.bank.c_str(), preset, e.name.c_str(), e.avg_us, e.peak_us, e.idle_us, e.block_us);
+            }
+        }
+    }
+    h->api->destroy_instance(inst);
+
+    if (entries.empty()) {
+        fprintf(stderr, "cost-survey: no presets produced sound\n");
+        return 1;
+    }
+    std::vector<double> blocks;
+    for (size_t i = 0; i < entries.size(); i++) blocks.push_back(entries[i].block_us);
+    std::sort(blocks.begin(), blocks.end());
+    double median = blocks[blocks.size() / 2] > 0 ? blocks[blocks.size() / 2] : 1e-9;
+
+    FILE *f = fopen(out.c_str(), "w");
+    if (!f) {
+        perror(out.c_str());
+        return 1;
+    }
+    fprintf(f, "# obxd-cost-index 1 sr=%d block=%d median_block_us=%.3f\n",
+            MOVE_SAMPLE_RATE, MOVE_FRAMES_PER_BLOCK, median);
+    fprintf(f, "# bank\tpreset\tavg_us\tpeak_us\tidle_us\tblock_us\trel\tname\n");
+    for (size_t i = 0; i < entries.size(); i++) {
+        const survey_entry_t *e = &entries[i];
+        fprintf(f, "%s\t%d\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%s\n", e->bank.c_str(), e->preset,
+                e->avg_us, e->peak_us, e->idle_us, e->block_us, e->block_us / median, e->name.c_str());
+    }
+    fclose(f);
+
+    /* Summary: the most expensive presets first */
+    std::vector<size_t> order(entries.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return entries[a].block_us > entries[b].block_us; });
+    printf("{\"cost_survey\":{\"out\":\"%s\",\"presets\":%zu,\"silent\":%d,\"median_block_us\":%.3f,\"heaviest\":[",
+           out.c_str(), entries.size(), silent, median);
+    for (size_t i = 0; i < order.size() && i < 5; i++) {
+        const survey_entry_t *e = &entries[order[i]];
+        printf("%s{\"bank\":\"%s\",\"preset\":%d,\"avg_us\":%.2f,\"peak_us\":%.2f,\"idle_us\":%.2f,\"rel\":%.2f}",
+               i ? "," : "", e->bank.c_str(), e->preset, e->avg_us, e->peak_us, e->idle_us, e->block_us / median);
+    }
+    printf("]}}\n");
+    return 0;
+}
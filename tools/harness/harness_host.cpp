@@ -0,0 +1,51 @@
+/*
+ * harness_host.cpp - dsp.so loader for the harness
+ */
+
+#include "harness_host.h"
+
+int g_harness_verbose = 0;
+void (*g_harness_log_tap)(const char *msg) = NULL;
+
+static void harness_log(const char *msg) {
+    if (g_harness_verbose) fprintf(stderr, "%s\n", msg);
+    if (g_harness_log_tap) g_harness_log_tap(msg);
+}
+
+static host_api_v1_t g_host = {
+    1,                      /* api_version */
+    MOVE_SAMPLE_RATE,
+    MOVE_FRAMES_PER_BLOCK,
+    NULL,                   /* mapped_memory */
+    0,
+    0,
+    harness_log,
+    NULL,
+    NULL,
+};
+
+int harness_load(harness_t *h, const char *plugin_path, const char *module_dir) {
+    memset(h, 0, sizeof(*h));
+    h->module_dir = module_dir;
+
+    h->dl = dlopen(plugin_path, RTLD_NOW | RTLD_LOCAL);
+    if (!h->dl) {
+        fprintf(stderr, "harness: %s\n", dlerror());
+        return -1;
+    }
+
+    move_plugin_init_v2_fn init = (move_plugin_init_v2_fn)dlsym(h->dl, "move_plugin_init_v2");
+    if (!init) {
+        fprintf(stderr, "harness: %s has no move_plugin_init_v2\n", plugin_path);
+        return -1;
+    }
+    h->api = init(&g_host);
+    if (!h->api) {
+        fprintf(stderr, "harness: move_plugin_init_v2 failed\n");
+        return -1;
+    }
+
+    obxd_ext_api_fn ext = (obxd_ext_api_fn)dlsym(h->dl, OBXD_EXT_API_SYMBOL);
+    h->ext = ext ? ext() : NULL;
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * harness_host.h - Minimal Move host for driving dsp.so off-device
+ *
+ * Loads a natively built dsp.so through the same entry points the Move host
+ * uses (move_plugin_init_v2, plus the optional OB-Xd extended API) so the
+ * harness exercises exactly the code that ships.
+ */
+
+#ifndef HARNESS_HOST_H
+#define HARNESS_HOST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <dlfcn.h>
+
+#include "obxd_ext_api.h"
+
+/* Copy plugin_api_v1.h definitions inline, as the plugin does */
+extern "C" {
+#define MOVE_SAMPLE_RATE 44100
+#define MOVE_FRAMES_PER_BLOCK 128
+#define MOVE_MIDI_SOURCE_INTERNAL 0
+#define MOVE_MIDI_SOURCE_EXTERNAL 2
+
+typedef struct host_api_v1 {
+    uint32_t api_version;
+    int sample_rate;
+    int frames_per_block;
+    uint8_t *mapped_memory;
+    int audio_out_offset;
+    int audio_in_offset;
+    void (*log)(const char *msg);
+    int (*midi_send_internal)(const uint8_t *msg, int len);
+    int (*midi_send_external)(const uint8_t *msg, int len);
+} host_api_v1_t;
+
+typedef struct plugin_api_v2 {
+    uint32_t api_version;
+    void* (*create_instance)(const char *module_dir, const char *json_defaults);
+    void (*destroy_instance)(void *instance);
+    void (*on_midi)(void *instance, const uint8_t *msg, int len, int source);
+    void (*set_param)(void *instance, const char *key, const char *val);
+    int (*get_param)(void *instance, const char *key, char *buf, int buf_len);
+    int (*get_error)(void *instance, char *buf, int buf_len);
+    void (*render_block)(void *instance, int16_t *out_interleaved_lr, int frames);
+} plugin_api_v2_t;
+
+typedef plugin_api_v2_t* (*move_plugin_init_v2_fn)(const host_api_v1_t *host);
+}
+
+typedef struct {
+    void *dl;
+    plugin_api_v2_t *api;
+    const obxd_ext_api_t *ext;  /* NULL if dsp.so predates the extended API */
+    const char *module_dir;     /* Passed to create_instance (holds presets/) */
+} harness_t;
+
+extern int g_harness_verbose;
+/* When set, also receives every line dsp.so logs through the host */
+extern void (*g_harness_log_tap)(const char *msg);
+
+/* Load dsp.so and run move_plugin_init_v2. Returns 0 on success. */
+int harness_load(harness_t *h, const char *plugin_path, const char *module_dir);
+
+static inline uint64_t harness_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* Deterministic LCG for reproducible scenarios */
+static inline uint32_t harness_rand(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static inline void harness_note(harness_t *h, void *inst, int on, int note, int velocity) {
+    uint8_t msg[3] = { (uint8_t)(on ? 0x90 : 0x80), (uint8_t)note, (uint8_t)(on ? velocity : 0) };
+    h->api->on_midi(inst, msg, 3, MOVE_MIDI_SOURCE_INTERNAL);
+}
+
+/* Commands, one source file each. argv[0] is the command name. */
+int cmd_trace(harness_t *h, int argc, char **argv);
+int cmd_trace2json(harness_t *h, int argc, char **argv);
+int cmd_rtcheck(harness_t *h, int argc, char **argv);
+int cmd_bench(harness_t *h, int argc, char **argv);
+int cmd_compare(harness_t *h, int argc, char **argv);
+int cmd_bench_dsp(harness_t *h, int argc, char **argv);
+int cmd_cost_survey(harness_t *h, int argc, char **argv);
+int cmd_storm(harness_t *h, int argc, char **argv);
+int cmd_scale(harness_t *h, int argc, char **argv);
+int cmd_autosample(harness_t *h, int argc, char **argv);
+int cmd_layout(harness_t *h, int argc, char **argv);
+int cmd_worst_case(harness_t *h, int argc, char **argv);
+int cmd_preview(harness_t *h, int argc, char **argv);
+int cmd_api_check(harness_t *h, int argc, char **argv);
+
+/* rtcheck.cpp: flag allocator, file and lock calls made between enter and leave */
+void rtcheck_enter(const char *context);
+void rtcheck_leave(void);
+uint64_t rtcheck_violations(void);
+
+#endif /* HARNESS_HOST_H */
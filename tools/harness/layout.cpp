@@ -0,0 +1,81 @@
+/*
+ * layout.cpp - Instance arena layout report
+ *
+ * Prints get_param("layout") for a fresh instance and, when the extended
+ * API is there, for a clone: the arena size and where the hot instance
+ * fields, the engine (with its voice array) and the cold control data
+ * sit in it. Fails if the arena or any part of it is not on a cache line,
+ * the parts overlap, or the engine does not follow the hot fields within
+ * LAYOUT_ENGINE_MAX_OFFSET bytes (queues and tables belong in the cold part).
+ */
+
+#include "harness_host.h"
+
+#define LAYOUT_ENGINE_MAX_OFFSET 1024
+
+/* Pull a numeric field out of the flat layout JSON: "name":{..."key":N */
+static long layout_field(const char *json, const char *section, const char *key) {
+    char pat[64];
+    const char *p = json;
+    if (section) {
+        snprintf(pat, sizeof(pat), "\"%s\":{", section);
+        p = strstr(json, pat);
+        if (!p) return -1;
+    }
+    snprintf(pat, sizeof(pat), "\"%s\":", key);
+    p = strstr(p, pat);
+    return p ? atol(p + strlen(pat)) : -1;
+}
+
+static int layout_check(const char *name, const char *json) {
+    long align = layout_field(json, NULL, "align");
+    long arena = layout_field(json, NULL, "arena_bytes");
+    long inst_end = layout_field(json, "instance", "bytes");
+    long engine = layout_field(json, "engine", "offset");
+    long engine_end = engine + layout_field(json, "engine", "bytes");
+    long cold = layout_field(json, "cold", "offset");
+    long cold_end = cold + layout_field(json, "cold", "bytes");
+
+    int ok = align > 0 && layout_field(json, NULL, "base_aligned") == 1 &&
+             engine % align == 0 && cold % align == 0 &&
+             inst_end <= engine && engine_end <= cold && cold_end <= arena;
+    int near = engine >= 0 && engine <= LAYOUT_ENGINE_MAX_OFFSET;
+    printf("{\"layout\":{\"instance\":\"%s\",\"ok\":%d,\"report\":%s}}\n", name, ok && near, json);
+    if (!ok) fprintf(stderr, "layout: %s arena is misaligned or overlapping\n", name);
+    if (!near) fprintf(stderr, "layout: %s engine at offset %ld, more than %d bytes behind the instance start\n",
+                       name, engine, LAYOUT_ENGINE_MAX_OFFSET);
+    ok = ok && near;
+    return ok;
+}
+
+/* layout */
+int cmd_layout(harness_t *h, int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    char buf[1024];
+
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "layout: create_instance failed\n");
+        return 1;
+    }
+    if (h->api->get_param(inst, "layout", buf, sizeof(buf)) <= 0) {
+        fprintf(stderr, "layout: dsp.so does not report a layout\n");
+        h->api->destroy_instance(inst);
+        return 1;
+    }
+    int ok = layout_check("created", buf);
+
+    if (h->ext && h->ext->clone_instance) {
+        void *clone = h->ext->clone_instance(inst);
+        if (!clone || h->api->get_param(clone, "layout", buf, sizeof(buf)) <= 0) {
+            fprintf(stderr, "layout: clone_instance failed\n");
+            ok = 0;
+        } else {
+            ok = layout_check("cloned", buf) && ok;
+        }
+        if (clone) h->api->destroy_instance(clone);
+    }
+    h->api->destroy_instance(inst);
+    return ok ? 0 : 1;
+}
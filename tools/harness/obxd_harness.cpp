@@ -0,0 +1,104 @@
+/*
+ * obxd_harness - Off-device test and measurement driver for dsp.so
+ *
+ * Usage: obxd_harness [--plugin PATH] [--module-dir DIR] [-v] <command> [args]
+ *
+ * Build and run through scripts/harness.sh, which compiles dsp.so natively.
+ */
+
+#include "harness_host.h"
+
+typedef struct {
+    const char *name;
+    int (*run)(harness_t *h, int argc, char **argv);
+    int needs_plugin;
+    const char *help;
+} harness_command_t;
+
+static int cmd_check(harness_t *h, int argc, char **argv);
+
+static const harness_command_t g_commands[] = {
+    {"trace",      cmd_trace,      1, "[--seconds N] [--out FILE] [--dump FILE]  arpeggio storm, voice trace as Chrome JSON"},
+    {"trace2json", cmd_trace2json, 0, "DUMP OUT  convert saved get_param(\"trace\") dumps to Chrome JSON"},
+    {"rtcheck",    cmd_rtcheck,    1, "[--seconds N]  flag allocation, file I/O and locks inside render_block/on_midi"},
+    {"bench",      cmd_bench,      1, "[--seconds N] [--bank N] [--preset N] [--voices N] [--counters] [--kernels NAME|all] [--oversampling RUNG|all]  render_block timing"},
+    {"compare",    cmd_compare,    0, "BASE.so NEW.so [--seconds N] [--rounds N] [--voices N] [--step N]  speedup of one build over another"},
+    {"bench-dsp",  cmd_bench_dsp,  0, "[--samples N] [--only SUBSTR] [--ghz F] [--counters]  per-kernel ns/sample and cycles/sample"},
+    {"cost-survey", cmd_cost_survey, 1, "[--seconds N] [--repeats N] [--out FILE]  per-voice cost of every preset, writes presets/cost_index.tsv"},
+    {"storm",      cmd_storm,      1, "[--seconds N] [--rate N] [--preset N] [--mode NAME]  allocator tail latency under MIDI storms"},
+    {"scale",      cmd_scale,      1, "[--max N] [--seconds N] [--clone] [--counters]  block time, RSS and cache misses for 1..N instances"},
+    {"autosample", cmd_autosample, 1, "[--bank N] [--preset N] [--seconds N] [--voices N]  sampled fallback vs engine voices, hand-back on param change"},
+    {"worst-case", cmd_worst_case, 1, "[--iterations N] [--seconds N] [--voices N] [--top N] [--seed N] [--limit RUNG] [--out FILE] [--replay FILE]  search params for the most expensive patches"},
+    {"preview",    cmd_preview,    1, "[--out DIR] [--jobs N] [--bank N] [--seconds N] [--hold N] [--note N] [--mono]  render ADPCM previews of every preset plus a manifest"},
+    {"api-check",  cmd_api_check,  1, "[--only NAME]  behavioural checks: clone, snapshot, params_batch, midi_map, sysex, log_ring, oversampling"},
+    {"layout",     cmd_layout,     1, "instance arena layout and alignment, of a created and a cloned instance"},
+    {"check",      cmd_check,      1, "standard pre-release run, non-zero exit on any failure"},
+};
+
+/* The standard test run: every pass/fail check the harness has */
+static int cmd_check(harness_t *h, int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    int failed = 0;
+
+    char *rt_argv[] = {(char*)"rtcheck"};
+    if (cmd_rtcheck(h, 1, rt_argv) != 0) failed++;
+
+    char *api_argv[] = {(char*)"api-check"};
+    if (cmd_api_check(h, 1, api_argv) != 0) failed++;
+
+    char *layout_argv[] = {(char*)"layout"};
+    if (cmd_layout(h, 1, layout_argv) != 0) failed++;
+
+    char *as_argv[] = {(char*)"autosample", (char*)"--preset", (char*)"6", (char*)"--seconds", (char*)"2"};
+    if (cmd_autosample(h, 5, as_argv) != 0) failed++;
+
+    printf("{\"check\":\"%s\"}\n", failed ? "FAILED" : "ok");
+    return failed ? 1 : 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: obxd_harness [--plugin PATH] [--module-dir DIR] [--kernels NAME] [-v] <command> [args]\n\n");
+    for (size_t i = 0; i < sizeof(g_commands) / sizeof(g_commands[0]); i++) {
+        fprintf(stderr, "  %-12s %s\n", g_commands[i].name, g_commands[i].help);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *plugin = "build/native/dsp.so";
+    const char *module_dir = "src";
+
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-'; i++) {
+        if (strcmp(argv[i], "--plugin") == 0 && i + 1 < argc) {
+            plugin = argv[++i];
+        } else if (strcmp(argv[i], "--module-dir") == 0 && i + 1 < argc) {
+            module_dir = argv[++i];
+        } else if (strcmp(argv[i], "--kernels") == 0 && i + 1 < argc) {
+            /* Read by move_plugin_init_v2, so it must be set before loading */
+            setenv("OBXD_KERNELS", argv[++i], 1);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            g_harness_verbose = 1;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (i >= argc) {
+        usage();
+        return 2;
+    }
+
+    for (size_t c = 0; c < sizeof(g_commands) / sizeof(g_commands[0]); c++) {
+        if (strcmp(argv[i], g_commands[c].name) != 0) continue;
+
+        harness_t h;
+        memset(&h, 0, sizeof(h));
+        h.module_dir = module_dir;
+        if (g_commands[c].needs_plugin && harness_load(&h, plugin, module_dir) != 0) return 1;
+        return g_commands[c].run(&h, argc - i, argv + i);
+    }
+
+    usage();
+    return 2;
+}
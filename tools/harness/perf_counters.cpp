@@ -0,0 +1,189 @@
+/*
+ * perf_counters.cpp - CPU cycle and hardware event counting for the harness
+ */
+
+#include "perf_counters.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static int perf_open_in_group(uint32_t type, uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+static int perf_open(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+void cycle_counter_open(cycle_counter_t *c, double ghz) {
+    c->fd = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    c->ghz = ghz;
+    if (c->fd >= 0) {
+        c->source = "perf";
+        return;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    c->source = "tsc";
+#else
+    c->source = ghz > 0 ? "ghz" : "none";
+#endif
+}
+
+void cycle_counter_close(cycle_counter_t *c) {
+    if (c->fd >= 0) close(c->fd);
+    c->fd = -1;
+}
+
+uint64_t cycle_counter_read(const cycle_counter_t *c) {
+    if (c->fd >= 0) {
+        uint64_t value = 0;
+        if (read(c->fd, &value, sizeof(value)) != sizeof(value)) return 0;
+        return value;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+double cycle_counter_cycles(const cycle_counter_t *c, uint64_t start, uint64_t end, uint64_t elapsed_ns) {
+    if (strcmp(c->source, "perf") == 0 || strcmp(c->source, "tsc") == 0) return (double)(end - start);
+    if (strcmp(c->source, "ghz") == 0) return (double)elapsed_ns * c->ghz;
+    return -1.0;
+}
+
+/* ---- Event groups ---- */
+
+static const struct {
+    const char *name;
+    uint32_t type;
+    uint64_t config;
+    int hardware;
+} g_perf_events[PERF_EV_COUNT] = {
+    {"cycles",           PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 1},
+    {"instructions",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 1},
+    {"l1d_misses",       PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), 1},
+    {"branch_misses",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, 1},
+    {"llc_misses",       PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), 1},
+    {"page_faults",      PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, 0},
+    {"context_switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, 0},
+};
+
+int perf_group_open(perf_group_t *g) {
+    g->hw_leader = g->sw_leader = -1;
+    g->hw_count = g->sw_count = 0;
+    int opened = 0;
+
+    for (int i = 0; i < PERF_EV_COUNT; i++) {
+        int *leader = g_perf_events[i].hardware ? &g->hw_leader : &g->sw_leader;
+        int fd = perf_open_in_group(g_perf_events[i].type, g_perf_events[i].config, *leader);
+        g->fds[i] = fd;
+        if (fd < 0) continue;
+        if (*leader < 0) *leader = fd;
+        if (g_perf_events[i].hardware) g->hw_count++;
+        else g->sw_count++;
+        opened++;
+    }
+    return opened;
+}
+
+void perf_group_close(perf_group_t *g) {
+    for (int i = 0; i < PERF_EV_COUNT; i++) {
+        if (g->fds[i] >= 0) close(g->fds[i]);
+        g->fds[i] = -1;
+    }
+    g->hw_leader = g->sw_leader = -1;
+}
+
+/* One read() per group; values come back in the order members were added */
+static void perf_read_group(const perf_group_t *g, int leader, int hardware, uint64_t *values) {
+    uint64_t buf[1 + PERF_EV_COUNT];
+    if (leader < 0) return;
+    if (read(leader, buf, sizeof(buf)) < (ssize_t)sizeof(uint64_t)) return;
+
+    int n = 0;
+    for (int i = 0; i < PERF_EV_COUNT && n < (int)buf[0]; i++) {
+        if (g->fds[i] < 0 || g_perf_events[i].hardware != hardware) continue;
+        values[i] = buf[1 + n++];
+    }
+}
+
+void perf_group_read(const perf_group_t *g, uint64_t *values) {
+    memset(values, 0, sizeof(uint64_t) * PERF_EV_COUNT);
+    perf_read_group(g, g->hw_leader, 1, values);
+    perf_read_group(g, g->sw_leader, 0, values);
+}
+
+void perf_region_reset(perf_region_t *r) {
+    memset(r, 0, sizeof(*r));
+}
+
+static uint64_t perf_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void perf_region_begin(const perf_group_t *g, perf_region_t *r) {
+    perf_group_read(g, r->start);
+    r->start_ns = perf_now_ns();
+}
+
+void perf_region_end(const perf_group_t *g, perf_region_t *r) {
+    uint64_t end_ns = perf_now_ns();
+    uint64_t now[PERF_EV_COUNT];
+    perf_group_read(g, now);
+    r->calls++;
+    r->ns += end_ns - r->start_ns;
+    for (int i = 0; i < PERF_EV_COUNT; i++) r->values[i] += now[i] - r->start[i];
+}
+
+void perf_region_print_json(const perf_group_t *g, const perf_region_t *r, double units, const char *unit_name) {
+    printf("\"counters\":{");
+    int first = 1;
+    for (int i = 0; i < PERF_EV_COUNT; i++) {
+        if (g->fds[i] < 0) continue;
+        printf("%s\"%s\":%llu", first ? "" : ",", g_perf_events[i].name, (unsigned long long)r->values[i]);
+        if (units > 0 && g_perf_events[i].hardware) {
+            printf(",\"%s_per_%s\":%.3f", g_perf_events[i].name, unit_name, r->values[i] / units);
+        }
+        first = 0;
+    }
+    if (g->fds[PERF_EV_CYCLES] >= 0 && g->fds[PERF_EV_INSTRUCTIONS] >= 0 && r->values[PERF_EV_CYCLES]) {
+        printf(",\"ipc\":%.3f", (double)r->values[PERF_EV_INSTRUCTIONS] / r->values[PERF_EV_CYCLES]);
+    }
+    printf("%s\"unavailable\":[", first ? "" : ",");
+    first = 1;
+    for (int i = 0; i < PERF_EV_COUNT; i++) {
+        if (g->fds[i] >= 0) continue;
+        printf("%s\"%s\"", first ? "" : ",", g_perf_events[i].name);
+        first = 0;
+    }
+    printf("]}");
+}
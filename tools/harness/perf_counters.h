@@ -0,0 +1,80 @@
+/*
+ * perf_counters.h - CPU cycle and hardware event counting for the harness
+ *
+ * Cycles come from perf_event_open when the kernel allows it, otherwise
+ * from the x86 TSC (reference cycles, not core cycles). With neither,
+ * cycles are derived from wall time and --ghz, or not reported at all.
+ *
+ * perf_group_t collects a fixed event set around measured regions (render
+ * blocks, DSP kernels). Events the kernel or CPU refuses are left out of
+ * the report rather than failing the run.
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+
+typedef struct {
+    int fd;                 /* perf_event fd, -1 when not in use */
+    const char *source;     /* "perf", "tsc", "ghz" or "none" */
+    double ghz;             /* For "ghz": cycles = ns * ghz */
+} cycle_counter_t;
+
+/* Pick the best available source. ghz <= 0 disables the wall-time estimate. */
+void cycle_counter_open(cycle_counter_t *c, double ghz);
+void cycle_counter_close(cycle_counter_t *c);
+
+/* Raw reading, only meaningful as a difference; 0 for "ghz" and "none" */
+uint64_t cycle_counter_read(const cycle_counter_t *c);
+
+/* Cycles between two readings that spanned elapsed_ns, -1 if unknown */
+double cycle_counter_cycles(const cycle_counter_t *c, uint64_t start, uint64_t end, uint64_t elapsed_ns);
+
+/* Event slots of perf_group_t */
+enum {
+    PERF_EV_CYCLES,
+    PERF_EV_INSTRUCTIONS,
+    PERF_EV_L1D_MISSES,
+    PERF_EV_BRANCH_MISSES,
+    PERF_EV_LLC_MISSES,
+    PERF_EV_PAGE_FAULTS,
+    PERF_EV_CONTEXT_SWITCHES,
+    PERF_EV_COUNT
+};
+
+typedef struct {
+    int hw_leader;              /* Hardware group leader fd, -1 if none */
+    int sw_leader;              /* Software group leader fd, -1 if none */
+    int fds[PERF_EV_COUNT];     /* -1 for events that could not be opened */
+    int hw_count, sw_count;     /* Members per group, in slot order */
+} perf_group_t;
+
+/* Accumulated counts of one measured region */
+typedef struct {
+    uint64_t calls;
+    uint64_t ns;
+    uint64_t values[PERF_EV_COUNT];
+    uint64_t start_ns;
+    uint64_t start[PERF_EV_COUNT];
+} perf_region_t;
+
+/* Returns the number of events opened (0 = counters unavailable) */
+int perf_group_open(perf_group_t *g);
+void perf_group_close(perf_group_t *g);
+
+/* Current counts, slots that are not open read as 0 */
+void perf_group_read(const perf_group_t *g, uint64_t *values);
+
+void perf_region_reset(perf_region_t *r);
+void perf_region_begin(const perf_group_t *g, perf_region_t *r);
+void perf_region_end(const perf_group_t *g, perf_region_t *r);
+
+/*
+ * Print `"counters":{...}` for a region: totals per open event, plus
+ * per-unit rates when units > 0 (e.g. samples), and IPC when both cycles
+ * and instructions were counted.
+ */
+void perf_region_print_json(const perf_group_t *g, const perf_region_t *r, double units, const char *unit_name);
+
+#endif /* PERF_COUNTERS_H */
@@ -0,0 +1,511 @@
+/*
+ * preview.cpp - Offline preset preview renderer
+ *
+ * Renders a short phrase through every preset of every bank and writes one
+ * IMA ADPCM WAV per preset plus manifest.json, so a preset browser can play
+ * a preview while the user scrolls instead of loading and synthesizing each
+ * preset live.
+ *
+ * Work is spread over --jobs worker threads (default: every online core).
+ * Each worker owns one instance, kept on the bank it is working through and
+ * never played; every preset renders on a clone of it, so no preview picks
+ * up the previous one's release tail, filter state or LFO phase.
+ *
+ * The phrase is a chord held for --hold seconds, then released. Rendering
+ * stops once the tail has decayed below -72 dBFS (or at --seconds), and the
+ * last 20 ms are faded out. Levels go into the manifest rather than being
+ * normalized away, so the browser can match loudness or leave it honest.
+ */
+
+#include "harness_host.h"
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#define PREVIEW_MAX_JOBS 64
+#define PREVIEW_FADE_FRAMES (MOVE_SAMPLE_RATE / 50)
+#define PREVIEW_TAIL_FLOOR 8            /* Peak below this is -72 dBFS */
+#define PREVIEW_TAIL_BLOCKS 32          /* Quiet blocks after release before stopping */
+#define ADPCM_SAMPLES_PER_BLOCK 1017    /* 512 bytes per channel per block */
+
+typedef struct {
+    int bank;
+    int preset;
+    /* Filled by the worker */
+    std::string name;
+    std::string file;
+    double seconds;
+    double peak_db;
+    double rms_db;
+    long bytes;
+    int ok;
+} preview_job_t;
+
+typedef struct {
+    std::string name;
+    std::string dir;
+    int preset_count;
+} preview_bank_t;
+
+typedef struct {
+    harness_t *h;
+    std::vector<preview_job_t> *jobs;
+    const std::vector<preview_bank_t> *banks;
+    std::string out_dir;
+    int next;                   /* Next job index, shared by the workers */
+    double max_seconds;
+    double hold_seconds;
+    int root;
+    int channels;
+} preview_ctx_t;
+
+typedef struct {
+    preview_ctx_t *ctx;
+    int rendered;
+    double busy_s;
+} preview_worker_t;
+
+/* =====================================================================
+ * IMA ADPCM WAV writer
+ * ===================================================================== */
+
+static const int g_ima_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int g_ima_index_step[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+typedef struct {
+    int predictor;
+    int index;
+} ima_state_t;
+
+static int ima_encode(ima_state_t *s, int sample) {
+    int step = g_ima_steps[s->index];
+    int diff = sample - s->predictor;
+    int nibble = 0;
+    if (diff < 0) {
+        nibble = 8;
+        diff = -diff;
+    }
+    int delta = step >> 3;
+    if (diff >= step) { nibble |= 4; diff -= step; delta += step; }
+    step >>= 1;
+    if (diff >= step) { nibble |= 2; diff -= step; delta += step; }
+    step >>= 1;
+    if (diff >= step) { nibble |= 1; delta += step; }
+
+    s->predictor += (nibble & 8) ? -delta : delta;
+    if (s->predictor > 32767) s->predictor = 32767;
+    if (s->predictor < -32768) s->predictor = -32768;
+    s->index += g_ima_index_step[nibble & 7];
+    if (s->index < 0) s->index = 0;
+    if (s->index > 88) s->index = 88;
+    return nibble;
+}
+
+static void put_le(std::vector<uint8_t> *out, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) out->push_back((uint8_t)(v >> (8 * i)));
+}
+
+/* Encode interleaved 16-bit frames as a WAVE_FORMAT_IMA_ADPCM file image */
+static void adpcm_wav(const int16_t *pcm, long frames, int channels, std::vector<uint8_t> *out) {
+    const int block_align = 512 * channels;
+    long blocks = (frames + ADPCM_SAMPLES_PER_BLOCK - 1) / ADPCM_SAMPLES_PER_BLOCK;
+    uint32_t data_bytes = (uint32_t)(blocks * block_align);
+
+    out->clear();
+    out->reserve(60 + data_bytes);
+    out->insert(out->end(), {'R', 'I', 'F', 'F'});
+    put_le(out, 4 + (8 + 20) + (8 + 4) + (8 + data_bytes), 4);
+    out->insert(out->end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    put_le(out, 20, 4);
+    put_le(out, 0x11, 2);
+    put_le(out, channels, 2);
+    put_le(out, MOVE_SAMPLE_RATE, 4);
+    put_le(out, (uint32_t)((uint64_t)MOVE_SAMPLE_RATE * block_align / ADPCM_SAMPLES_PER_BLOCK), 4);
+    put_le(out, block_align, 2);
+    put_le(out, 4, 2);
+    put_le(out, 2, 2);
+    put_le(out, ADPCM_SAMPLES_PER_BLOCK, 2);
+    out->insert(out->end(), {'f', 'a', 'c', 't'});
+    put_le(out, 4, 4);
+    put_le(out, (uint32_t)frames, 4);
+    out->insert(out->end(), {'d', 'a', 't', 'a'});
+    put_le(out, data_bytes, 4);
+
+    /* Past the end the block is padded with silence; the fact chunk has the real length */
+    #define PCM_AT(f, c) ((f) < frames ? pcm[(f) * channels + (c)] : 0)
+    ima_state_t state[2] = {{0, 0}, {0, 0}};
+    for (long b = 0; b < blocks; b++) {
+        long base = b * ADPCM_SAMPLES_PER_BLOCK;
+        /* Header: the first frame verbatim, then the step index each channel continues from */
+        for (int c = 0; c < channels; c++) {
+            state[c].predictor = PCM_AT(base, c);
+            put_le(out, (uint16_t)(int16_t)state[c].predictor, 2);
+            out->push_back((uint8_t)state[c].index);
+            out->push_back(0);
+        }
+        /* Then 8 frames at a time, 4 bytes per channel, low nibble first */
+        for (long f = base + 1; f < base + ADPCM_SAMPLES_PER_BLOCK; f += 8) {
+            for (int c = 0; c < channels; c++) {
+                for (int k = 0; k < 8; k += 2) {
+                    int lo = ima_encode(&state[c], PCM_AT(f + k, c));
+                    int hi = ima_encode(&state[c], PCM_AT(f + k + 1, c));
+                    out->push_back((uint8_t)(lo | (hi << 4)));
+                }
+            }
+        }
+    }
+    #undef PCM_AT
+}
+
+/* =====================================================================
+ * Rendering
+ * ===================================================================== */
+
+#define PREVIEW_CHORD_NOTES 4
+static const int g_chord_offsets[PREVIEW_CHORD_NOTES] = {0, 7, 12, 16};
+
+/* Play the phrase on inst; pcm gets the rendered frames in the output channel count */
+static void preview_render(preview_ctx_t *ctx, void *inst, std::vector<int16_t> *pcm) {
+    harness_t *h = ctx->h;
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    int max_blocks = (int)(ctx->max_seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    int release_block = (int)(ctx->hold_seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    int quiet = 0;
+
+    pcm->clear();
+    for (int i = 0; i < PREVIEW_CHORD_NOTES; i++) harness_note(h, inst, 1, ctx->root + g_chord_offsets[i], 100);
+    for (int b = 0; b < max_blocks; b++) {
+        if (b == release_block) {
+            for (int i = 0; i < PREVIEW_CHORD_NOTES; i++) harness_note(h, inst, 0, ctx->root + g_chord_offsets[i], 0);
+        }
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+
+        int peak = 0;
+        for (int i = 0; i < MOVE_FRAMES_PER_BLOCK; i++) {
+            int l = audio[i * 2], r = audio[i * 2 + 1];
+            if (abs(l) > peak) peak = abs(l);
+            if (abs(r) > peak) peak = abs(r);
+            if (ctx->channels == 2) {
+                pcm->push_back((int16_t)l);
+                pcm->push_back((int16_t)r);
+            } else {
+                pcm->push_back((int16_t)((l + r) / 2));
+            }
+        }
+        if (b < release_block) continue;
+        quiet = peak < PREVIEW_TAIL_FLOOR ? quiet + 1 : 0;
+        if (quiet >= PREVIEW_TAIL_BLOCKS) {
+            pcm->resize(pcm->size() - (size_t)quiet * MOVE_FRAMES_PER_BLOCK * ctx->channels);
+            break;
+        }
+    }
+
+    long frames = (long)pcm->size() / ctx->channels;
+    long fade = frames < PREVIEW_FADE_FRAMES ? frames : PREVIEW_FADE_FRAMES;
+    for (long f = frames - fade; f < frames; f++) {
+        float g = (float)(frames - f) / (float)fade;
+        for (int c = 0; c < ctx->channels; c++) {
+            (*pcm)[f * ctx->channels + c] = (int16_t)((*pcm)[f * ctx->channels + c] * g);
+        }
+    }
+}
+
+static void preview_levels(const std::vector<int16_t> &pcm, preview_job_t *job) {
+    int peak = 0;
+    double sum_sq = 0;
+    for (size_t i = 0; i < pcm.size(); i++) {
+        if (abs(pcm[i]) > peak) peak = abs(pcm[i]);
+        sum_sq += (double)pcm[i] * pcm[i];
+    }
+    double rms = pcm.empty() ? 0 : sqrt(sum_sq / pcm.size()) / 32768.0;
+    job->peak_db = peak > 0 ? 20.0 * log10(peak / 32768.0) : -120.0;
+    job->rms_db = rms > 0 ? 20.0 * log10(rms) : -120.0;
+}
+
+static int preview_one(preview_ctx_t *ctx, void *bank_inst, preview_job_t *job,
+                       std::vector<int16_t> *pcm, std::vector<uint8_t> *wav) {
+    harness_t *h = ctx->h;
+    char buf[256];
+
+    void *inst = h->ext->clone_instance(bank_inst);
+    if (!inst) {
+        fprintf(stderr, "preview: clone_instance failed for bank %d preset %d\n", job->bank, job->preset);
+        return -1;
+    }
+    snprintf(buf, sizeof(buf), "%d", job->preset);
+    h->api->set_param(inst, "preset", buf);
+    if (h->api->get_param(inst, "preset_name", buf, sizeof(buf)) > 0) job->name = buf;
+    preview_render(ctx, inst, pcm);
+    h->api->destroy_instance(inst);
+
+    long frames = (long)pcm->size() / ctx->channels;
+    job->seconds = (double)frames / MOVE_SAMPLE_RATE;
+    preview_levels(*pcm, job);
+    adpcm_wav(pcm->data(), frames, ctx->channels, wav);
+
+    snprintf(buf, sizeof(buf), "%s/%03d.wav", (*ctx->banks)[job->bank].dir.c_str(), job->preset);
+    job->file = buf;
+    std::string path = ctx->out_dir + "/" + job->file;
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        perror(path.c_str());
+        return -1;
+    }
+    size_t written = fwrite(wav->data(), 1, wav->size(), f);
+    if (fclose(f) != 0 || written != wav->size()) {
+        fprintf(stderr, "preview: short write to %s\n", path.c_str());
+        return -1;
+    }
+    job->bytes = (long)wav->size();
+    return 0;
+}
+
+static void *preview_worker(void *arg) {
+    preview_worker_t *w = (preview_worker_t*)arg;
+    preview_ctx_t *ctx = w->ctx;
+    harness_t *h = ctx->h;
+    std::vector<int16_t> pcm;
+    std::vector<uint8_t> wav;
+    char buf[32];
+
+    void *bank_inst = h->api->create_instance(h->module_dir, NULL);
+    if (!bank_inst) {
+        fprintf(stderr, "preview: create_instance failed\n");
+        return NULL;
+    }
+    int current_bank = -1;
+    for (;;) {
+        int j = __atomic_fetch_add(&ctx->next, 1, __ATOMIC_RELAXED);
+        if (j >= (int)ctx->jobs->size()) break;
+        preview_job_t *job = &(*ctx->jobs)[j];
+        if (job->bank != current_bank) {
+            snprintf(buf, sizeof(buf), "%d", job->bank);
+            h->api->set_param(bank_inst, "bank_index", buf);
+            current_bank = job->bank;
+        }
+        uint64_t t0 = harness_now_ns();
+        job->ok = preview_one(ctx, bank_inst, job, &pcm, &wav) == 0;
+        w->busy_s += (harness_now_ns() - t0) / 1e9;
+        w->rendered++;
+        if (g_harness_verbose) {
+            fprintf(stderr, "%s: %.2f s, peak %.1f dB, %ld bytes\n", job->file.c_str(), job->seconds,
+                    job->peak_db, job->bytes);
+        }
+    }
+    h->api->destroy_instance(bank_inst);
+    return NULL;
+}
+
+/* =====================================================================
+ * Command
+ * ===================================================================== */
+
+static void json_string(FILE *f, const std::string &s) {
+    fputc('"', f);
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+/* Bank names become directory names: keep them to a portable character set */
+static std::string preview_dir_name(const std::string &name, int index) {
+    std::string dir;
+    for (size_t i = 0; i < name.size(); i++) {
+        char c = name[i];
+        int keep = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                   c == '-' || c == '_' || c == '.';
+        dir += keep ? c : '_';
+    }
+    if (dir.empty() || dir[0] == '.') {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "bank%d", index);
+        dir = buf + dir;
+    }
+    return dir;
+}
+
+static int preview_mkdir(const std::string &path) {
+    if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        perror(path.c_str());
+        return -1;
+    }
+    return 0;
+}
+
+static int preview_manifest(preview_ctx_t *ctx, int jobs_run) {
+    std::string path = ctx->out_dir + "/manifest.json";
+    FILE *f = fopen(path.c_str(), "w");
+    if (!f) {
+        perror(path.c_str());
+        return -1;
+    }
+    fprintf(f, "{\"version\":1,\"format\":\"ima-adpcm-wav\",\"sample_rate\":%d,\"channels\":%d,",
+            MOVE_SAMPLE_RATE, ctx->channels);
+    fprintf(f, "\"phrase\":{\"notes\":[");
+    for (int i = 0; i < PREVIEW_CHORD_NOTES; i++) fprintf(f, "%s%d", i ? "," : "", ctx->root + g_chord_offsets[i]);
+    fprintf(f, "],\"velocity\":100,\"hold_s\":%.2f,\"max_s\":%.2f},\"jobs\":%d,\n\"banks\":[",
+            ctx->hold_seconds, ctx->max_seconds, jobs_run);
+
+    const std::vector<preview_job_t> &jobs = *ctx->jobs;
+    size_t j = 0;
+    for (size_t b = 0; b < ctx->banks->size(); b++) {
+        const preview_bank_t *bank = &(*ctx->banks)[b];
+        if (bank->preset_count == 0) continue;
+        fprintf(f, "%s\n{\"index\":%d,\"name\":", j ? "," : "", (int)b);
+        json_string(f, bank->name);
+        fprintf(f, ",\"presets\":[");
+        int first = 1;
+        for (; j < jobs.size() && jobs[j].bank == (int)b; j++) {
+            const preview_job_t *job = &jobs[j];
+            if (!job->ok) continue;
+            fprintf(f, "%s\n {\"index\":%d,\"name\":", first ? "" : ",", job->preset);
+            json_string(f, job->name);
+            fprintf(f, ",\"file\":");
+            json_string(f, job->file);
+            fprintf(f, ",\"seconds\":%.3f,\"bytes\":%ld,\"peak_db\":%.1f,\"rms_db\":%.1f,\"silent\":%s}",
+                    job->seconds, job->bytes, job->peak_db, job->rms_db, job->peak_db <= -120.0 ? "true" : "false");
+            first = 0;
+        }
+        fprintf(f, "]}");
+    }
+    fprintf(f, "\n]}\n");
+    if (fclose(f) != 0) {
+        perror(path.c_str());
+        return -1;
+    }
+    return 0;
+}
+
+/* preview [--out DIR] [--jobs N] [--bank N] [--seconds N] [--hold N] [--note N] [--mono] */
+int cmd_preview(harness_t *h, int argc, char **argv) {
+    preview_ctx_t ctx;
+    ctx.h = h;
+    ctx.out_dir = std::string(h->module_dir) + "/presets/previews";
+    ctx.next = 0;
+    ctx.max_seconds = 3.0;
+    ctx.hold_seconds = 1.5;
+    ctx.root = 48;
+    ctx.channels = 2;
+    int jobs_req = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int only_bank = -1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) ctx.out_dir = argv[++i];
+        else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) jobs_req = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--bank") == 0 && i + 1 < argc) only_bank = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) ctx.max_seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--hold") == 0 && i + 1 < argc) ctx.hold_seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--note") == 0 && i + 1 < argc) ctx.root = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--mono") == 0) ctx.channels = 1;
+    }
+    if (jobs_req < 1) jobs_req = 1;
+    if (jobs_req > PREVIEW_MAX_JOBS) jobs_req = PREVIEW_MAX_JOBS;
+    if (ctx.max_seconds < 0.1) ctx.max_seconds = 0.1;
+    if (ctx.hold_seconds > ctx.max_seconds) ctx.hold_seconds = ctx.max_seconds;
+    if (ctx.root < 0) ctx.root = 0;
+    if (ctx.root > 127 - 16) ctx.root = 127 - 16;
+    if (!h->ext || !h->ext->clone_instance) {
+        fprintf(stderr, "preview: dsp.so has no clone_instance\n");
+        return 1;
+    }
+
+    /* Enumerate banks and presets up front; the workers take them in order */
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "preview: create_instance failed\n");
+        return 1;
+    }
+    char buf[256];
+    int bank_count = 1;
+    if (h->api->get_param(inst, "bank_count", buf, sizeof(buf)) > 0) bank_count = atoi(buf);
+    std::vector<preview_bank_t> banks(bank_count);
+    std::vector<preview_job_t> jobs;
+    for (int b = 0; b < bank_count; b++) {
+        snprintf(buf, sizeof(buf), "%d", b);
+        h->api->set_param(inst, "bank_index", buf);
+        banks[b].name = h->api->get_param(inst, "bank_name", buf, sizeof(buf)) > 0 ? buf : "";
+        banks[b].dir = preview_dir_name(banks[b].name, b);
+        banks[b].preset_count = 0;
+        if (only_bank >= 0 && b != only_bank) continue;
+        if (h->api->get_param(inst, "preset_count", buf, sizeof(buf)) > 0) banks[b].preset_count = atoi(buf);
+        for (int p = 0; p < banks[b].preset_count; p++) {
+            preview_job_t job;
+            job.bank = b;
+            job.preset = p;
+            job.seconds = job.peak_db = job.rms_db = 0;
+            job.bytes = 0;
+            job.ok = 0;
+            jobs.push_back(job);
+        }
+    }
+    h->api->destroy_instance(inst);
+    if (jobs.empty()) {
+        fprintf(stderr, "preview: no presets to render\n");
+        return 1;
+    }
+    ctx.jobs = &jobs;
+    ctx.banks = &banks;
+
+    if (preview_mkdir(ctx.out_dir) != 0) return 1;
+    for (int b = 0; b < bank_count; b++) {
+        if (banks[b].preset_count && preview_mkdir(ctx.out_dir + "/" + banks[b].dir) != 0) return 1;
+    }
+
+    int nworkers = jobs_req < (int)jobs.size() ? jobs_req : (int)jobs.size();
+    preview_worker_t workers[PREVIEW_MAX_JOBS];
+    pthread_t threads[PREVIEW_MAX_JOBS];
+    uint64_t t0 = harness_now_ns();
+    int started = 0;
+    for (int i = 0; i < nworkers; i++) {
+        workers[i].ctx = &ctx;
+        workers[i].rendered = 0;
+        workers[i].busy_s = 0;
+        if (pthread_create(&threads[i], NULL, preview_worker, &workers[i]) != 0) break;
+        started++;
+    }
+    for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+    /* No thread could be started: render everything on this one */
+    if (started == 0) {
+        preview_worker(&workers[0]);
+        started = 1;
+    }
+    double wall_s = (harness_now_ns() - t0) / 1e9;
+
+    int ok = 0, silent = 0;
+    long bytes = 0;
+    double audio_s = 0;
+    for (size_t j = 0; j < jobs.size(); j++) {
+        if (!jobs[j].ok) continue;
+        ok++;
+        bytes += jobs[j].bytes;
+        audio_s += jobs[j].seconds;
+        if (jobs[j].peak_db <= -120.0) silent++;
+    }
+    int manifest_ok = preview_manifest(&ctx, started) == 0;
+
+    printf("{\"preview\":{\"out\":\"%s\",\"jobs\":%d,\"presets\":%d,\"written\":%d,\"silent\":%d,"
+           "\"audio_s\":%.1f,\"wall_s\":%.2f,\"x_realtime\":%.1f,\"bytes\":%ld,\"kbytes_per_s\":%.1f,\"workers\":[",
+           ctx.out_dir.c_str(), started, (int)jobs.size(), ok, silent, audio_s, wall_s,
+           wall_s > 0 ? audio_s / wall_s : 0, bytes, audio_s > 0 ? bytes / 1024.0 / audio_s : 0);
+    for (int i = 0; i < started; i++) {
+        printf("%s{\"presets\":%d,\"busy_s\":%.2f}", i ? "," : "", workers[i].rendered, workers[i].busy_s);
+    }
+    printf("]}}\n");
+    return ok == (int)jobs.size() && manifest_ok ? 0 : 1;
+}
@@ -0,0 +1,365 @@
+/*
+ * rtcheck.cpp - Real-time safety checker for render_block and on_midi
+ *
+ * The harness executable interposes the allocator, file/directory calls and
+ * blocking synchronization. The interposers forward to libc and cost one
+ * thread-local test, except between rtcheck_enter() and rtcheck_leave(),
+ * where each call is reported once per call site with its stack.
+ *
+ * Linked into every harness build (-rdynamic so dsp.so binds to these).
+ */
+
+#include "harness_host.h"
+#include "patch_sysex.h"
+#include "Engine/SynthEngine.h"
+#include "Engine/ParamsEnum.h"
+
+#include <stddef.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <execinfo.h>
+#include <unistd.h>
+#include <new>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void *__libc_memalign(size_t align, size_t size);
+void __libc_free(void *p);
+}
+
+#define RTCHECK_MAX_SITES 64
+#define RTCHECK_STACK_DEPTH 16
+
+static __thread const char *t_rt_context = NULL;  /* Non-NULL inside a checked call */
+static __thread int t_reporting = 0;
+
+static uint64_t g_site_hashes[RTCHECK_MAX_SITES];
+static int g_site_count = 0;
+static uint64_t g_violations = 0;
+
+void rtcheck_enter(const char *context) { t_rt_context = context; }
+void rtcheck_leave(void) { t_rt_context = NULL; }
+uint64_t rtcheck_violations(void) { return g_violations; }
+
+static void rtcheck_report(const char *what) {
+    if (!t_rt_context || t_reporting) return;
+    t_reporting = 1;
+    g_violations++;
+
+    void *stack[RTCHECK_STACK_DEPTH];
+    int depth = backtrace(stack, RTCHECK_STACK_DEPTH);
+
+    /* One report per distinct call site */
+    uint64_t hash = 1469598103934665603ull;
+    for (int i = 1; i < depth && i < 8; i++) hash = (hash ^ (uint64_t)(uintptr_t)stack[i]) * 1099511628211ull;
+    for (int i = 0; i < g_site_count; i++) {
+        if (g_site_hashes[i] == hash) {
+            t_reporting = 0;
+            return;
+        }
+    }
+    if (g_site_count < RTCHECK_MAX_SITES) g_site_hashes[g_site_count++] = hash;
+
+    char line[256];
+    int len = snprintf(line, sizeof(line), "RT violation: %s inside %s\n", what, t_rt_context);
+    if (write(STDERR_FILENO, line, len) < 0) {}
+    backtrace_symbols_fd(stack + 1, depth - 1, STDERR_FILENO);
+    if (write(STDERR_FILENO, "\n", 1) < 0) {}
+    t_reporting = 0;
+}
+
+template <typename Fn>
+static Fn rtcheck_next(const char *name) {
+    return (Fn)dlsym(RTLD_NEXT, name);
+}
+
+/* ---- Allocator ---- */
+
+extern "C" void *malloc(size_t size) {
+    rtcheck_report("malloc");
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+    rtcheck_report("calloc");
+    return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *p, size_t size) {
+    rtcheck_report("realloc");
+    return __libc_realloc(p, size);
+}
+
+extern "C" void free(void *p) {
+    if (p) rtcheck_report("free");
+    __libc_free(p);
+}
+
+extern "C" int posix_memalign(void **out, size_t align, size_t size) {
+    rtcheck_report("posix_memalign");
+    *out = __libc_memalign(align, size);
+    return *out ? 0 : 12;  /* ENOMEM */
+}
+
+extern "C" void *aligned_alloc(size_t align, size_t size) {
+    rtcheck_report("aligned_alloc");
+    return __libc_memalign(align, size);
+}
+
+void *operator new(size_t size) {
+    rtcheck_report("operator new");
+    void *p = __libc_malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size) {
+    rtcheck_report("operator new[]");
+    void *p = __libc_malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    rtcheck_report("operator new");
+    return __libc_malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    rtcheck_report("operator new[]");
+    return __libc_malloc(size ? size : 1);
+}
+
+void operator delete(void *p) noexcept {
+    if (p) rtcheck_report("operator delete");
+    __libc_free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    if (p) rtcheck_report("operator delete[]");
+    __libc_free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    if (p) rtcheck_report("operator delete");
+    __libc_free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+    if (p) rtcheck_report("operator delete[]");
+    __libc_free(p);
+}
+
+/* ---- Files and directories ---- */
+
+extern "C" FILE *fopen(const char *path, const char *mode) {
+    rtcheck_report("fopen");
+    static FILE *(*next)(const char *, const char *) = rtcheck_next<FILE *(*)(const char *, const char *)>("fopen");
+    return next(path, mode);
+}
+
+extern "C" int fclose(FILE *f) {
+    rtcheck_report("fclose");
+    static int (*next)(FILE *) = rtcheck_next<int (*)(FILE *)>("fclose");
+    return next(f);
+}
+
+extern "C" size_t fread(void *p, size_t size, size_t n, FILE *f) {
+    rtcheck_report("fread");
+    static size_t (*next)(void *, size_t, size_t, FILE *) =
+        rtcheck_next<size_t (*)(void *, size_t, size_t, FILE *)>("fread");
+    return next(p, size, n, f);
+}
+
+extern "C" size_t fwrite(const void *p, size_t size, size_t n, FILE *f) {
+    rtcheck_report("fwrite");
+    static size_t (*next)(const void *, size_t, size_t, FILE *) =
+        rtcheck_next<size_t (*)(const void *, size_t, size_t, FILE *)>("fwrite");
+    return next(p, size, n, f);
+}
+
+extern "C" int open(const char *path, int flags, ...) {
+    rtcheck_report("open");
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = (mode_t)va_arg(ap, int);
+        va_end(ap);
+    }
+    static int (*next)(const char *, int, ...) = rtcheck_next<int (*)(const char *, int, ...)>("open");
+    return next(path, flags, mode);
+}
+
+extern "C" ssize_t read(int fd, void *buf, size_t n) {
+    rtcheck_report("read");
+    static ssize_t (*next)(int, void *, size_t) = rtcheck_next<ssize_t (*)(int, void *, size_t)>("read");
+    return next(fd, buf, n);
+}
+
+extern "C" DIR *opendir(const char *path) {
+    rtcheck_report("opendir");
+    static DIR *(*next)(const char *) = rtcheck_next<DIR *(*)(const char *)>("opendir");
+    return next(path);
+}
+
+extern "C" struct dirent *readdir(DIR *dir) {
+    rtcheck_report("readdir");
+    static struct dirent *(*next)(DIR *) = rtcheck_next<struct dirent *(*)(DIR *)>("readdir");
+    return next(dir);
+}
+
+/* ---- Blocking synchronization and sleeps ---- */
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t *m) {
+    rtcheck_report("pthread_mutex_lock");
+    static int (*next)(pthread_mutex_t *) = rtcheck_next<int (*)(pthread_mutex_t *)>("pthread_mutex_lock");
+    return next(m);
+}
+
+extern "C" int pthread_cond_wait(pthread_cond_t *c, pthread_mutex_t *m) {
+    rtcheck_report("pthread_cond_wait");
+    static int (*next)(pthread_cond_t *, pthread_mutex_t *) =
+        rtcheck_next<int (*)(pthread_cond_t *, pthread_mutex_t *)>("pthread_cond_wait");
+    return next(c, m);
+}
+
+extern "C" int usleep(useconds_t us) {
+    rtcheck_report("usleep");
+    static int (*next)(useconds_t) = rtcheck_next<int (*)(useconds_t)>("usleep");
+    return next(us);
+}
+
+extern "C" int nanosleep(const struct timespec *req, struct timespec *rem) {
+    rtcheck_report("nanosleep");
+    static int (*next)(const struct timespec *, struct timespec *) =
+        rtcheck_next<int (*)(const struct timespec *, struct timespec *)>("nanosleep");
+    return next(req, rem);
+}
+
+/* ---- Checked plugin calls ---- */
+
+static void checked_midi(harness_t *h, void *inst, const uint8_t *msg, int len) {
+    rtcheck_enter("on_midi");
+    h->api->on_midi(inst, msg, len, MOVE_MIDI_SOURCE_EXTERNAL);
+    rtcheck_leave();
+}
+
+static void checked_render(harness_t *h, void *inst, int16_t *out, int frames) {
+    rtcheck_enter("render_block");
+    h->api->render_block(inst, out, frames);
+    rtcheck_leave();
+}
+
+/*
+ * rtcheck [--seconds N]
+ * Plays notes, controllers, bends, sustain, SysEx patch dumps and batched
+ * MIDI against every preset of every bank, with param writes, params_batch
+ * and bank switches landing between blocks. Exit status 1 on any violation.
+ */
+int cmd_rtcheck(harness_t *h, int argc, char **argv) {
+    double seconds_per_preset = 0.25;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds_per_preset = atof(argv[++i]);
+    }
+
+    /* Load libgcc's unwinder now, backtrace() allocates on first use */
+    void *warm[2];
+    backtrace(warm, 2);
+
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "rtcheck: create_instance failed\n");
+        return 1;
+    }
+
+    char buf[256];
+    int bank_count = 1;
+    if (h->api->get_param(inst, "bank_count", buf, sizeof(buf)) > 0) bank_count = atoi(buf);
+
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    uint32_t seed = 777;
+    int blocks_per_preset = (int)(seconds_per_preset * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    if (blocks_per_preset < 4) blocks_per_preset = 4;
+    long presets_checked = 0;
+
+    /* A patch dump message to send through on_midi */
+    float patch[PARAM_COUNT];
+    for (int i = 0; i < PARAM_COUNT; i++) patch[i] = (harness_rand(&seed) % 1000) / 1000.0f;
+    uint8_t sysex[1024];
+    int sysex_len = patch_sysex_encode(patch, PARAM_COUNT, "rtcheck", sysex, sizeof(sysex));
+
+    for (int bank = 0; bank < bank_count; bank++) {
+        snprintf(buf, sizeof(buf), "%d", bank);
+        h->api->set_param(inst, "bank_index", buf);
+        int preset_count = 1;
+        if (h->api->get_param(inst, "preset_count", buf, sizeof(buf)) > 0) preset_count = atoi(buf);
+
+        for (int preset = 0; preset < preset_count; preset++) {
+            snprintf(buf, sizeof(buf), "%d", preset);
+            h->api->set_param(inst, "preset", buf);
+            presets_checked++;
+
+            for (int b = 0; b < blocks_per_preset; b++) {
+                uint32_t r = harness_rand(&seed);
+                uint8_t msg[3];
+                switch (r % 8) {
+                    case 0: case 1: case 2:
+                        msg[0] = 0x90; msg[1] = 36 + r % 60; msg[2] = 1 + (r >> 8) % 127;
+                        checked_midi(h, inst, msg, 3);
+                        break;
+                    case 3: case 4:
+                        msg[0] = 0x80; msg[1] = 36 + (r >> 4) % 60; msg[2] = 0;
+                        checked_midi(h, inst, msg, 3);
+                        break;
+                    case 5:
+                        msg[0] = 0xB0; msg[1] = (r >> 8) % 128; msg[2] = (r >> 16) % 128;
+                        checked_midi(h, inst, msg, 3);
+                        break;
+                    case 6:
+                        msg[0] = 0xE0; msg[1] = r & 0x7F; msg[2] = (r >> 7) & 0x7F;
+                        checked_midi(h, inst, msg, 3);
+                        break;
+                    case 7:
+                        if (((r >> 8) & 15) == 0 && sysex_len > 0) {
+                            checked_midi(h, inst, sysex, sysex_len);
+                        } else {
+                            snprintf(buf, sizeof(buf), "cutoff=%.3f,resonance=%.3f",
+                                     (r % 1000) / 1000.0f, ((r >> 10) % 1000) / 1000.0f);
+                            h->api->set_param(inst, "params_batch", buf);
+                        }
+                        break;
+                }
+                if (h->ext && h->ext->struct_size > offsetof(obxd_ext_api_t, on_midi_batch) && (r & 0x300) == 0) {
+                    obxd_midi_event_t ev[2];
+                    memset(ev, 0, sizeof(ev));
+                    ev[0].frame = r % MOVE_FRAMES_PER_BLOCK;
+                    ev[0].len = 3;
+                    ev[0].data[0] = 0x90; ev[0].data[1] = 60 + r % 12; ev[0].data[2] = 90;
+                    ev[1].frame = MOVE_FRAMES_PER_BLOCK + r % 64;
+                    ev[1].len = 3;
+                    ev[1].data[0] = 0x80; ev[1].data[1] = ev[0].data[1];
+                    rtcheck_enter("on_midi_batch");
+                    h->ext->on_midi_batch(inst, ev, 2);
+                    rtcheck_leave();
+                }
+                checked_render(h, inst, audio, MOVE_FRAMES_PER_BLOCK);
+            }
+
+            /* All notes off before the next preset */
+            uint8_t all_off[3] = {0xB0, 123, 0};
+            checked_midi(h, inst, all_off, 3);
+            checked_render(h, inst, audio, MOVE_FRAMES_PER_BLOCK);
+        }
+    }
+
+    h->api->destroy_instance(inst);
+
+    printf("{\"rtcheck\":{\"banks\":%d,\"presets\":%ld,\"violations\":%llu,\"sites\":%d}}\n",
+           bank_count, presets_checked, (unsigned long long)g_violations, g_site_count);
+    return g_violations ? 1 : 0;
+}
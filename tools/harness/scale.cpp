@@ -0,0 +1,158 @@
+/*
+ * scale.cpp - Multi-instance scaling benchmark
+ *
+ * Grows a set of instances from 1 to --max, each on its own preset and
+ * note stream, and renders them interleaved block by block as the host
+ * does. For each instance count it reports the host's block time, the
+ * resident memory added per instance (overall, and marginal beyond the
+ * first, which also pays for code pages and one-time tables), and, where
+ * perf_event_open is allowed, cache misses per instance-block, so the effect of shared state
+ * (bank data, engine tables) and per-instance footprint shows up as the
+ * set grows. --clone builds instances 2..N with clone_instance, which
+ * shares bank presets, instead of create_instance.
+ */
+
+#include "harness_host.h"
+#include "perf_counters.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#define SCALE_MAX_INSTANCES 64
+
+/* Resident set size in KiB, from /proc/self/statm */
+static long scale_rss_kb(void) {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return -1;
+    long size = 0, resident = 0;
+    if (fscanf(f, "%ld %ld", &size, &resident) != 2) resident = -1;
+    fclose(f);
+    return resident < 0 ? -1 : resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+typedef struct {
+    void *inst;
+    uint32_t seed;
+    int held[4];
+    int next_step;  /* Block of the next chord change */
+} scale_voice_t;
+
+/* Independent chord stream: each instance changes chord at its own pace */
+static void scale_drive(harness_t *h, scale_voice_t *s, int block) {
+    if (block < s->next_step) return;
+    for (int i = 0; i < 4; i++) {
+        if (s->held[i] >= 0) harness_note(h, s->inst, 0, s->held[i], 0);
+    }
+    int root = 36 + harness_rand(&s->seed) % 36;
+    static const int shape[4] = {0, 4, 7, 11};
+    for (int i = 0; i < 4; i++) {
+        s->held[i] = root + shape[i];
+        harness_note(h, s->inst, 1, s->held[i], 80 + harness_rand(&s->seed) % 40);
+    }
+    s->next_step = block + 40 + harness_rand(&s->seed) % 160;
+}
+
+/* scale [--max N] [--seconds N] [--clone] [--counters] */
+int cmd_scale(harness_t *h, int argc, char **argv) {
+    int max_n = 16, clone = 0, counters = 0;
+    double seconds = 2.0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max") == 0 && i + 1 < argc) max_n = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--clone") == 0) clone = 1;
+        else if (strcmp(argv[i], "--counters") == 0) counters = 1;
+    }
+    if (max_n < 1) max_n = 1;
+    if (max_n > SCALE_MAX_INSTANCES) max_n = SCALE_MAX_INSTANCES;
+    if (clone && (!h->ext || !h->ext->clone_instance)) {
+        fprintf(stderr, "scale: dsp.so has no clone_instance\n");
+        return 1;
+    }
+
+    perf_group_t group;
+    if (counters && perf_group_open(&group) == 0) {
+        fprintf(stderr, "scale: perf_event_open refused, counters unavailable\n");
+    }
+
+    scale_voice_t set[SCALE_MAX_INSTANCES];
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    int blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    double budget_us = MOVE_FRAMES_PER_BLOCK * 1e6 / MOVE_SAMPLE_RATE;
+    long rss_base = scale_rss_kb();
+    long rss_first = -1;    /* RSS with one instance, for the marginal cost of the rest */
+    int preset_count = 0;
+    int n = 0;
+
+    printf("{\"scale\":{\"clone\":%s,\"seconds\":%.1f,\"rss_base_kb\":%ld,\"runs\":[",
+           clone ? "true" : "false", seconds, rss_base);
+    for (int target = 1; target <= max_n; target++) {
+        /* Grow the set by one */
+        scale_voice_t *s = &set[n];
+        s->inst = (clone && n > 0) ? h->ext->clone_instance(set[0].inst)
+                                   : h->api->create_instance(h->module_dir, NULL);
+        if (!s->inst) {
+            fprintf(stderr, "scale: instance %d could not be created\n", n);
+            break;
+        }
+        char buf[32];
+        if (n == 0 && h->api->get_param(s->inst, "preset_count", buf, sizeof(buf)) > 0) preset_count = atoi(buf);
+        if (preset_count > 0) {
+            snprintf(buf, sizeof(buf), "%d", (n * 7) % preset_count);
+            h->api->set_param(s->inst, "preset", buf);
+        }
+        s->seed = 1000 + n * 7919;
+        for (int i = 0; i < 4; i++) s->held[i] = -1;
+        s->next_step = 0;
+        n++;
+
+        if (target != 1 && target != 2 && target % 4 != 0 && target != max_n) continue;
+
+        /* Warm-up touches every instance's working set before RSS is read */
+        for (int b = 0; b < 64; b++) {
+            for (int i = 0; i < n; i++) {
+                scale_drive(h, &set[i], b);
+                h->api->render_block(set[i].inst, audio, MOVE_FRAMES_PER_BLOCK);
+            }
+        }
+        long rss = scale_rss_kb();
+        if (n == 1) rss_first = rss;
+
+        perf_region_t region;
+        perf_region_reset(&region);
+        std::vector<double> block_us(blocks);
+        for (int b = 0; b < blocks; b++) {
+            if (counters) perf_region_begin(&group, &region);
+            uint64_t t0 = harness_now_ns();
+            for (int i = 0; i < n; i++) {
+                scale_drive(h, &set[i], 64 + b);
+                h->api->render_block(set[i].inst, audio, MOVE_FRAMES_PER_BLOCK);
+            }
+            block_us[b] = (harness_now_ns() - t0) / 1000.0;
+            if (counters) perf_region_end(&group, &region);
+        }
+
+        double total = 0;
+        for (int b = 0; b < blocks; b++) total += block_us[b];
+        std::sort(block_us.begin(), block_us.end());
+        double avg = total / blocks;
+        printf("%s\n  {\"instances\":%d,\"block_us\":{\"avg\":%.2f,\"p99\":%.2f,\"max\":%.2f},"
+               "\"per_instance_us\":%.2f,\"load_pct\":%.2f,\"rss_kb\":%ld,\"rss_per_instance_kb\":%.1f,"
+               "\"rss_marginal_kb\":%.1f",
+               target == 1 ? "" : ",", n, avg, block_us[(blocks * 99) / 100], block_us[blocks - 1],
+               avg / n, avg * 100.0 / budget_us, rss, (double)(rss - rss_base) / n,
+               n > 1 ? (double)(rss - rss_first) / (n - 1) : (double)(rss - rss_base));
+        if (counters) {
+            printf(",");
+            perf_region_print_json(&group, &region, (double)blocks * n, "instance_block");
+        }
+        printf("}");
+        fflush(stdout);
+    }
+    printf("\n]}}\n");
+
+    for (int i = 0; i < n; i++) h->api->destroy_instance(set[i].inst);
+    if (counters) perf_group_close(&group);
+    return 0;
+}
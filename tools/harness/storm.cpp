@@ -0,0 +1,237 @@
+/*
+ * storm.cpp - MIDI storm stress test for the note allocator
+ *
+ * Feeds dense chords, glissandi, sustain-pedal toggling and rapid
+ * retriggers at a fixed event rate through on_midi, under each allocation
+ * mode (poly at the preset's voice count, poly at the engine maximum,
+ * as-played allocation, unison, mono legato). Every on_midi call and every
+ * render_block is timed separately, and the report gives the tail (p99,
+ * max) next to the average so allocator changes can be judged on worst
+ * case rather than throughput.
+ *
+ * The burst pattern ignores the rate: it strikes a 10-note chord at once
+ * every STORM_BURST_PERIOD blocks, long enough apart that most voices have
+ * gone idle, and reports the blocks the chords land in on their own, as a
+ * strummed pad would load the note-on path.
+ */
+
+#include "harness_host.h"
+
+#include <algorithm>
+#include <vector>
+
+typedef struct {
+    const char *name;
+    const char *params;     /* params_batch applied after loading the preset */
+    int as_played;          /* Sent as external CC 21 (ASPLAYEDALLOCATION in the default map) */
+} storm_mode_t;
+
+static const storm_mode_t g_modes[] = {
+    {"poly",      "unison=0",                       0},
+    {"poly_max",  "unison=0,voice_count=1",         0},
+    {"as_played", "unison=0,voice_count=1",         1},
+    {"unison",    "unison=1,voice_count=1",         0},
+    {"mono",      "unison=0,voice_count=0,legato=1", 0},
+};
+
+enum { PAT_CHORDS, PAT_GLISS, PAT_SUSTAIN, PAT_RETRIGGER, PAT_BURST, PAT_COUNT };
+static const char *g_pattern_names[PAT_COUNT] = {"chords", "glissando", "sustain", "retrigger", "burst"};
+
+#define STORM_BURST_NOTES 10
+#define STORM_BURST_PERIOD 128  /* Blocks between chords, ~370 ms */
+#define STORM_BURST_HOLD 32     /* Blocks each chord is held */
+
+typedef struct {
+    std::vector<double> event_ns;
+    std::vector<double> block_us;   /* MIDI plus render time of each block */
+    std::vector<double> burst_us;   /* The blocks burst chords were struck in */
+    uint64_t notes_on;
+} storm_result_t;
+
+typedef struct {
+    int held[128];
+    int gliss_note;
+    int gliss_dir;
+    int sustain;
+    int chord_root;
+    uint32_t seed;
+} storm_state_t;
+
+static void storm_send(harness_t *h, void *inst, storm_result_t *res, uint8_t s, uint8_t d1, uint8_t d2) {
+    uint8_t msg[3] = {s, d1, d2};
+    uint64_t t0 = harness_now_ns();
+    h->api->on_midi(inst, msg, 3, MOVE_MIDI_SOURCE_EXTERNAL);
+    res->event_ns.push_back((double)(harness_now_ns() - t0));
+    if (s == 0x90 && d2) res->notes_on++;
+}
+
+static void storm_note(harness_t *h, void *inst, storm_result_t *res, storm_state_t *st, int note, int on) {
+    storm_send(h, inst, res, on ? 0x90 : 0x80, (uint8_t)note, on ? (uint8_t)(64 + harness_rand(&st->seed) % 63) : 0);
+    st->held[note] = on;
+}
+
+/* One event (or one chord step) of the pattern; returns events sent */
+static int storm_step(harness_t *h, void *inst, storm_result_t *res, storm_state_t *st, int pattern) {
+    size_t before = res->event_ns.size();
+    switch (pattern) {
+        case PAT_CHORDS: {
+            /* Release the previous chord and strike a new 8-note one */
+            for (int n = 0; n < 128; n++) {
+                if (st->held[n]) storm_note(h, inst, res, st, n, 0);
+            }
+            st->chord_root = 30 + harness_rand(&st->seed) % 40;
+            for (int c = 0; c < 8; c++) storm_note(h, inst, res, st, st->chord_root + c * 3 + (c / 4) * 5, 1);
+            break;
+        }
+        case PAT_GLISS: {
+            /* Overlapping sweep: each note is released four steps later */
+            int off = st->gliss_note - 4 * st->gliss_dir;
+            if (off >= 0 && off < 128 && st->held[off]) storm_note(h, inst, res, st, off, 0);
+            storm_note(h, inst, res, st, st->gliss_note, 1);
+            st->gliss_note += st->gliss_dir;
+            if (st->gliss_note >= 120 || st->gliss_note <= 12) st->gliss_dir = -st->gliss_dir;
+            break;
+        }
+        case PAT_SUSTAIN: {
+            /* Short notes under a pedal that toggles every 16 steps */
+            int n = 36 + harness_rand(&st->seed) % 60;
+            if (st->held[n]) storm_note(h, inst, res, st, n, 0);
+            else storm_note(h, inst, res, st, n, 1);
+            if ((harness_rand(&st->seed) & 15) == 0) {
+                st->sustain = !st->sustain;
+                storm_send(h, inst, res, 0xB0, 64, st->sustain ? 127 : 0);
+            }
+            break;
+        }
+        case PAT_BURST: {
+            /* Release the last chord, or strike a new one all at once */
+            int held = 0;
+            for (int n = 0; n < 128; n++) {
+                if (st->held[n]) {
+                    storm_note(h, inst, res, st, n, 0);
+                    held = 1;
+                }
+            }
+            if (held) break;
+            st->chord_root = 30 + harness_rand(&st->seed) % 40;
+            for (int c = 0; c < STORM_BURST_NOTES; c++) storm_note(h, inst, res, st, st->chord_root + c * 4 + c % 3, 1);
+            break;
+        }
+        case PAT_RETRIGGER: {
+            /* The same few notes struck again while still held, then released */
+            int n = 60 + harness_rand(&st->seed) % 4;
+            storm_note(h, inst, res, st, n, 1);
+            if ((harness_rand(&st->seed) & 3) == 0) storm_note(h, inst, res, st, n, 0);
+            break;
+        }
+    }
+    return (int)(res->event_ns.size() - before);
+}
+
+static void storm_run(harness_t *h, void *inst, int pattern, double seconds, int rate, storm_result_t *res) {
+    storm_state_t st;
+    memset(&st, 0, sizeof(st));
+    st.gliss_note = 12;
+    st.gliss_dir = 1;
+    st.seed = 9001 + pattern;
+
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    int total_blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    double events_per_block = (double)rate * MOVE_FRAMES_PER_BLOCK / MOVE_SAMPLE_RATE;
+    double owed = 0;
+    res->event_ns.reserve((size_t)(events_per_block * total_blocks * 2) + 64);
+    res->block_us.reserve(total_blocks);
+
+    for (int b = 0; b < total_blocks; b++) {
+        uint64_t t0 = harness_now_ns();
+        int burst = 0;
+        if (pattern == PAT_BURST) {
+            burst = b % STORM_BURST_PERIOD == 0;
+            if (burst || b % STORM_BURST_PERIOD == STORM_BURST_HOLD) storm_step(h, inst, res, &st, pattern);
+        } else {
+            owed += events_per_block;
+            while (owed >= 1.0) owed -= storm_step(h, inst, res, &st, pattern);
+        }
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        double us = (harness_now_ns() - t0) / 1000.0;
+        res->block_us.push_back(us);
+        if (burst) res->burst_us.push_back(us);
+    }
+
+    /* Clean slate for the next pattern; these events are not part of the storm */
+    size_t storm_events = res->event_ns.size();
+    storm_send(h, inst, res, 0xB0, 64, 0);
+    for (int n = 0; n < 128; n++) {
+        if (st.held[n]) storm_note(h, inst, res, &st, n, 0);
+    }
+    res->event_ns.resize(storm_events);
+    for (int b = 0; b < 200; b++) h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+}
+
+static void print_tail(const char *name, std::vector<double> v, const char *unit) {
+    std::sort(v.begin(), v.end());
+    size_t n = v.size();
+    double total = 0;
+    for (size_t i = 0; i < n; i++) total += v[i];
+    printf("\"%s_%s\":{\"avg\":%.2f,\"p50\":%.2f,\"p99\":%.2f,\"p999\":%.2f,\"max\":%.2f}", name, unit,
+           n ? total / n : 0, n ? v[n / 2] : 0, n ? v[(n * 99) / 100] : 0, n ? v[(n * 999) / 1000] : 0,
+           n ? v[n - 1] : 0);
+}
+
+/* storm [--seconds N] [--rate EVENTS_PER_SEC] [--preset N] [--mode NAME] */
+int cmd_storm(harness_t *h, int argc, char **argv) {
+    double seconds = 2.0;
+    int rate = 4000, preset = -1;
+    const char *only_mode = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc) rate = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--preset") == 0 && i + 1 < argc) preset = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--mode") == 0 && i + 1 < argc) only_mode = argv[++i];
+    }
+
+    double budget_us = MOVE_FRAMES_PER_BLOCK * 1e6 / MOVE_SAMPLE_RATE;
+    printf("{\"storm\":{\"rate\":%d,\"seconds\":%.1f,\"budget_us\":%.1f,\"runs\":[", rate, seconds, budget_us);
+    int first = 1;
+    for (size_t m = 0; m < sizeof(g_modes) / sizeof(g_modes[0]); m++) {
+        if (only_mode && strcmp(only_mode, g_modes[m].name) != 0) continue;
+
+        void *inst = h->api->create_instance(h->module_dir, NULL);
+        if (!inst) {
+            fprintf(stderr, "storm: create_instance failed\n");
+            return 1;
+        }
+        char buf[32];
+        if (preset >= 0) {
+            snprintf(buf, sizeof(buf), "%d", preset);
+            h->api->set_param(inst, "preset", buf);
+        }
+        h->api->set_param(inst, "params_batch", g_modes[m].params);
+        uint8_t as_played[3] = {0xB0, 21, (uint8_t)(g_modes[m].as_played ? 127 : 0)};
+        h->api->on_midi(inst, as_played, 3, MOVE_MIDI_SOURCE_EXTERNAL);
+
+        for (int p = 0; p < PAT_COUNT; p++) {
+            storm_result_t res;
+            res.notes_on = 0;
+            storm_run(h, inst, p, seconds, rate, &res);
+
+            int over = 0;
+            for (size_t i = 0; i < res.block_us.size(); i++) over += res.block_us[i] > budget_us;
+            printf("%s\n  {\"mode\":\"%s\",\"pattern\":\"%s\",\"events\":%zu,\"notes_on\":%llu,\"over_budget\":%d,",
+                   first ? "" : ",", g_modes[m].name, g_pattern_names[p], res.event_ns.size(),
+                   (unsigned long long)res.notes_on, over);
+            print_tail("event", res.event_ns, "ns");
+            printf(",");
+            print_tail("block", res.block_us, "us");
+            if (!res.burst_us.empty()) {
+                printf(",");
+                print_tail("burst_block", res.burst_us, "us");
+            }
+            printf("}");
+            first = 0;
+        }
+        h->api->destroy_instance(inst);
+    }
+    printf("\n]}}\n");
+    return 0;
+}
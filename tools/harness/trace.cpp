@@ -0,0 +1,291 @@
+/*
+ * trace.cpp - Voice trace capture and Chrome trace conversion
+ *
+ * Decodes get_param("trace") dumps (see v2_dump_trace in obxd_plugin.cpp)
+ * and writes Chrome trace JSON: one track per voice, a slice per note the
+ * voice played, instant events for releases, steals and queued notes.
+ * Open the output in chrome://tracing or https://ui.perfetto.dev.
+ */
+
+#include "harness_host.h"
+
+#include <vector>
+#include <string>
+
+/* Mirrors Engine/VoiceTrace.h */
+enum {
+    TR_NOTE_ON = 1, TR_NOTE_OFF, TR_STEAL, TR_RETRIGGER, TR_QUEUED, TR_REALLOC, TR_IDLE, TR_ORPHAN_OFF,
+    TR_TYPE_COUNT
+};
+#define TR_NO_VOICE 0xFF
+#define TR_ALLOCATOR_TID 1000
+
+static const char *g_type_names[TR_TYPE_COUNT] = {
+    "?", "note_on", "note_off", "steal", "retrigger", "queued", "realloc", "idle", "orphan_off"
+};
+
+typedef struct {
+    uint64_t time;      /* Unwrapped sample clock */
+    int type;
+    int voice;
+    int note;
+    int aux;
+} trace_event_t;
+
+typedef struct {
+    std::vector<trace_event_t> events;
+    int sample_rate;
+    uint64_t lost;
+    uint64_t last_raw;  /* For unwrapping the 32-bit clock */
+    uint64_t wraps;
+} trace_log_t;
+
+static int hex_val(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/* Append every dump found in text (dumps may be concatenated). Returns dumps parsed. */
+static int trace_parse(trace_log_t *log, const char *text) {
+    int dumps = 0;
+    const char *p = text;
+    while ((p = strstr(p, "obxd-trace ")) != NULL) {
+        int version = 0, sr = 0;
+        unsigned lost = 0;
+        if (sscanf(p, "obxd-trace %d %d %u", &version, &sr, &lost) != 3 || version != 1) {
+            p++;
+            continue;
+        }
+        log->sample_rate = sr;
+        log->lost += lost;
+        p = strchr(p, '\n');
+        if (!p) break;
+        p++;
+
+        for (;;) {
+            uint32_t word[2] = {0, 0};
+            int ok = 1;
+            for (int w = 0; w < 2 && ok; w++) {
+                for (int i = 0; i < 8; i++) {
+                    int v = hex_val(p[w * 8 + i]);
+                    if (v < 0) { ok = 0; break; }
+                    word[w] = (word[w] << 4) | (uint32_t)v;
+                }
+            }
+            if (!ok) break;
+            p += 16;
+
+            if (word[0] < log->last_raw) log->wraps++;
+            log->last_raw = word[0];
+
+            trace_event_t e;
+            e.time = (log->wraps << 32) | word[0];
+            e.type = (word[1] >> 24) & 0xFF;
+            e.voice = (word[1] >> 16) & 0xFF;
+            e.note = (word[1] >> 8) & 0xFF;
+            e.aux = word[1] & 0xFF;
+            log->events.push_back(e);
+        }
+        dumps++;
+    }
+    return dumps;
+}
+
+static double to_us(const trace_log_t *log, uint64_t t) {
+    return (double)t * 1e6 / (log->sample_rate > 0 ? log->sample_rate : MOVE_SAMPLE_RATE);
+}
+
+/* Write Chrome trace JSON. Returns 0 on success. */
+static int trace_write_json(const trace_log_t *log, const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    /* Open slice per voice: start time, note, and what started it */
+    struct open_slice { int open; uint64_t start; int note; int how; int aux; };
+    open_slice slices[256];
+    memset(slices, 0, sizeof(slices));
+    int used_voice[256] = {0};
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"OB-Xd\"}}");
+    fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"allocator\"}}",
+            TR_ALLOCATOR_TID);
+
+    for (size_t i = 0; i < log->events.size(); i++) {
+        const trace_event_t *e = &log->events[i];
+        double ts = to_us(log, e->time);
+        const char *name = e->type < TR_TYPE_COUNT ? g_type_names[e->type] : "?";
+
+        if (e->voice == TR_NO_VOICE) {
+            fprintf(f, ",\n{\"name\":\"%s %d\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.1f}",
+                    name, e->note, TR_ALLOCATOR_TID, ts);
+            continue;
+        }
+
+        if (!used_voice[e->voice]) {
+            used_voice[e->voice] = 1;
+            fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"voice %d\"}}",
+                    e->voice, e->voice);
+        }
+
+        open_slice *s = &slices[e->voice];
+        int starts = e->type == TR_NOTE_ON || e->type == TR_STEAL ||
+                     e->type == TR_RETRIGGER || e->type == TR_REALLOC;
+        if (s->open && (starts || e->type == TR_IDLE)) {
+            fprintf(f, ",\n{\"name\":\"note %d\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.1f,\"dur\":%.1f,"
+                       "\"args\":{\"start\":\"%s\",\"aux\":%d}}",
+                    s->note, e->voice, to_us(log, s->start), ts - to_us(log, s->start),
+                    g_type_names[s->how], s->aux);
+            s->open = 0;
+        }
+        if (starts) {
+            s->open = 1;
+            s->start = e->time;
+            s->note = e->note;
+            s->how = e->type;
+            s->aux = e->aux;
+        }
+        if (e->type != TR_NOTE_ON && e->type != TR_IDLE) {
+            fprintf(f, ",\n{\"name\":\"%s %d\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.1f,"
+                       "\"args\":{\"aux\":%d}}",
+                    name, e->note, e->voice, ts, e->aux);
+        }
+    }
+
+    /* Voices still sounding at the end of the capture */
+    uint64_t end = log->events.empty() ? 0 : log->events.back().time;
+    for (int v = 0; v < 256; v++) {
+        if (!slices[v].open) continue;
+        fprintf(f, ",\n{\"name\":\"note %d\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.1f,\"dur\":%.1f,"
+                   "\"args\":{\"start\":\"%s\",\"aux\":%d}}",
+                slices[v].note, v, to_us(log, slices[v].start),
+                to_us(log, end) - to_us(log, slices[v].start), g_type_names[slices[v].how], slices[v].aux);
+    }
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    return 0;
+}
+
+static void trace_print_summary(const trace_log_t *log, const char *out) {
+    uint64_t counts[TR_TYPE_COUNT] = {0};
+    for (size_t i = 0; i < log->events.size(); i++) {
+        if (log->events[i].type < TR_TYPE_COUNT) counts[log->events[i].type]++;
+    }
+    printf("{\"trace\":\"%s\",\"events\":%zu,\"lost\":%llu", out, log->events.size(),
+           (unsigned long long)log->lost);
+    for (int t = 1; t < TR_TYPE_COUNT; t++) {
+        printf(",\"%s\":%llu", g_type_names[t], (unsigned long long)counts[t]);
+    }
+    printf("}\n");
+}
+
+/* trace [--seconds N] [--out FILE] [--dump FILE] */
+int cmd_trace(harness_t *h, int argc, char **argv) {
+    double seconds = 10.0;
+    const char *out = "trace.json";
+    const char *dump_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) out = argv[++i];
+        else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dump_path = argv[++i];
+    }
+
+    void *inst = h->api->create_instance(h->module_dir, NULL);
+    if (!inst) {
+        fprintf(stderr, "trace: create_instance failed\n");
+        return 1;
+    }
+
+    FILE *dump = dump_path ? fopen(dump_path, "w") : NULL;
+    trace_log_t log;
+    log.sample_rate = MOVE_SAMPLE_RATE;
+    log.lost = 0;
+    log.last_raw = 0;
+    log.wraps = 0;
+
+    /* Arpeggio storm: fast steps, overlapping gates, occasional chords */
+    const int step_frames = 2900;
+    int note_off_at[128];
+    for (int n = 0; n < 128; n++) note_off_at[n] = -1;
+    uint32_t seed = 12345;
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    std::vector<char> buf(65536);
+
+    int total_blocks = (int)(seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    int frame = 0;
+    for (int b = 0; b < total_blocks; b++) {
+        for (int n = 0; n < 128; n++) {
+            if (note_off_at[n] >= 0 && note_off_at[n] <= frame) {
+                harness_note(h, inst, 0, n, 0);
+                note_off_at[n] = -1;
+            }
+        }
+        if (frame / step_frames != (frame + MOVE_FRAMES_PER_BLOCK) / step_frames) {
+            int chord = (harness_rand(&seed) % 5 == 0) ? 3 : 1;
+            int root = 48 + harness_rand(&seed) % 36;
+            for (int c = 0; c < chord; c++) {
+                int n = root + c * 4;
+                if (note_off_at[n] >= 0) harness_note(h, inst, 0, n, 0);
+                harness_note(h, inst, 1, n, 60 + harness_rand(&seed) % 60);
+                note_off_at[n] = frame + step_frames * (1 + harness_rand(&seed) % 8);
+            }
+        }
+
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        frame += MOVE_FRAMES_PER_BLOCK;
+
+        /* Poll like a UI would */
+        if (h->api->get_param(inst, "trace", buf.data(), (int)buf.size()) > 0) {
+            trace_parse(&log, buf.data());
+            if (dump) fputs(buf.data(), dump);
+        }
+    }
+
+    if (dump) fclose(dump);
+    if (h->api->get_param(inst, "stats", buf.data(), (int)buf.size()) <= 0) buf[0] = '\0';
+    h->api->destroy_instance(inst);
+
+    if (trace_write_json(&log, out) != 0) return 1;
+    trace_print_summary(&log, out);
+    if (buf[0]) printf("%s\n", buf.data());
+    return 0;
+}
+
+/* trace2json DUMP OUT - convert dumps captured on a device */
+int cmd_trace2json(harness_t *h, int argc, char **argv) {
+    (void)h;
+    if (argc < 3) {
+        fprintf(stderr, "usage: trace2json DUMP OUT\n");
+        return 2;
+    }
+
+    FILE *f = fopen(argv[1], "r");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    std::string text;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) text.append(chunk, n);
+    fclose(f);
+
+    trace_log_t log;
+    log.sample_rate = MOVE_SAMPLE_RATE;
+    log.lost = 0;
+    log.last_raw = 0;
+    log.wraps = 0;
+    if (trace_parse(&log, text.c_str()) == 0) {
+        fprintf(stderr, "trace2json: no obxd-trace dumps in %s\n", argv[1]);
+        return 1;
+    }
+
+    if (trace_write_json(&log, argv[2]) != 0) return 1;
+    trace_print_summary(&log, argv[2]);
+    return 0;
+}
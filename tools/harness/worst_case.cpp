@@ -0,0 +1,371 @@
+/*
+ * worst_case.cpp - Search the parameter space for the most expensive patches
+ *
+ * Each candidate is a full set of values for every parameter listed by
+ * get_param("chain_params"), applied with params_batch to a fresh clone of
+ * an instance on preset 0, then played with the same note pattern: a
+ * --voices note chord from bass to high treble, held for 60% of the run
+ * and released for the tail (where self-oscillating filters and long
+ * releases decay toward denormals). Block times give the score, p99 as the
+ * search objective because a single max is at the mercy of the scheduler,
+ * with max and average reported next to it.
+ *
+ * The search starts from known cliffs (self-oscillating 4-pole filter,
+ * hard sync at high pitch, full cross-modulation, 32-voice unison, top
+ * oversampling rung) and random patches, then mutates the most expensive
+ * ones found so far, pushing a few parameters at a time to their extremes
+ * or nudging them. The top cases are re-measured and printed, and with
+ * --out written as a file that --replay FILE measures again, so a cliff
+ * found once stays a reproducible test case.
+ */
+
+#include "harness_host.h"
+
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define WC_MAX_PARAMS 96
+#define WC_REMEASURE 3      /* Runs per top case, the median is reported */
+
+typedef struct {
+    char key[32];
+    int is_int;
+} wc_param_t;
+
+typedef struct {
+    float values[WC_MAX_PARAMS];
+    double p99_us;
+    double max_us;
+    double avg_us;
+    std::string origin;     /* "random", "guided:NAME", "mutation" */
+} wc_case_t;
+
+typedef struct {
+    harness_t *h;
+    void *base;             /* Preset 0, cloned for every candidate */
+    wc_param_t params[WC_MAX_PARAMS];
+    int param_count;
+    int voices;
+    double seconds;
+    const char *limit;      /* oversampling_limit for every candidate */
+    uint32_t seed;
+} wc_search_t;
+
+/* Known expensive corners, applied over a random patch */
+static const struct {
+    const char *name;
+    const char *params;
+} g_wc_guided[] = {
+    {"self_osc_4pole", "fourpole=1,self_osc=1,resonance=1,cutoff=1,sustain=1,release=1,f_release=1"},
+    {"sync_high",      "osc2_sync=1,osc1_pitch=1,osc2_pitch=1,osc2_saw=1,osc2_pulse=1,octave=1"},
+    {"xmod_max",       "xmod=1,osc2_pitch=1,osc1_saw=1,osc2_saw=1,env_pitch=1"},
+    {"unison_32",      "unison=1,voice_count=1,unison_det=1"},
+    {"oversampled",    "oversampling=4x,fourpole=1,resonance=1"},
+};
+
+/* Keys of every shadow param, in chain_params order */
+static int wc_load_params(wc_search_t *s) {
+    static char buf[8192];
+    if (s->h->api->get_param(s->base, "chain_params", buf, sizeof(buf)) <= 0) return 0;
+    s->param_count = 0;
+    const char *p = buf;
+    while ((p = strstr(p, "\"key\":\"")) != NULL && s->param_count < WC_MAX_PARAMS) {
+        p += 7;
+        const char *end = strchr(p, '"');
+        if (!end) break;
+        size_t len = (size_t)(end - p);
+        if (len < sizeof(s->params[0].key) && strncmp(p, "preset", len) != 0 && strncmp(p, "octave_transpose", len) != 0) {
+            wc_param_t *w = &s->params[s->param_count++];
+            memcpy(w->key, p, len);
+            w->key[len] = '\0';
+            const char *type = strstr(end, "\"type\":\"");
+            w->is_int = type && strncmp(type + 8, "int", 3) == 0;
+        }
+        p = end;
+    }
+    return s->param_count;
+}
+
+static float wc_unit(uint32_t *seed) {
+    return (harness_rand(seed) % 10001) / 10000.0f;
+}
+
+/* A random value, at one of the extremes about a third of the time */
+static float wc_random_value(wc_search_t *s, int i) {
+    if (s->params[i].is_int || harness_rand(&s->seed) % 3 == 0) return (float)(harness_rand(&s->seed) % 2);
+    return wc_unit(&s->seed);
+}
+
+/* Apply "key=value,..." over a case's values */
+static void wc_overlay(wc_search_t *s, wc_case_t *c, const char *batch) {
+    const char *p = batch;
+    while (p && *p) {
+        while (*p == ',' || *p == ' ') p++;
+        const char *eq = strchr(p, '=');
+        if (!eq) break;
+        for (int i = 0; i < s->param_count; i++) {
+            if (strlen(s->params[i].key) == (size_t)(eq - p) && strncmp(s->params[i].key, p, eq - p) == 0) {
+                c->values[i] = strtof(eq + 1, NULL);
+                break;
+            }
+        }
+        p = strchr(eq, ',');
+    }
+}
+
+static std::string wc_format(wc_search_t *s, const wc_case_t *c) {
+    std::string out;
+    char item[64];
+    for (int i = 0; i < s->param_count; i++) {
+        snprintf(item, sizeof(item), "%s%s=%.3f", i ? "," : "", s->params[i].key, c->values[i]);
+        out += item;
+    }
+    return out;
+}
+
+/* Play the note pattern on a fresh clone with the case's params; fills the scores */
+static int wc_measure(wc_search_t *s, wc_case_t *c) {
+    harness_t *h = s->h;
+    void *inst = h->ext && h->ext->clone_instance ? h->ext->clone_instance(s->base)
+                                                  : h->api->create_instance(h->module_dir, NULL);
+    if (!inst) return 0;
+    int16_t audio[MOVE_FRAMES_PER_BLOCK * 2];
+    h->api->set_param(inst, "oversampling_limit", s->limit);
+    h->api->set_param(inst, "params_batch", wc_format(s, c).c_str());
+    h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+
+    int notes[32];
+    for (int k = 0; k < s->voices; k++) {
+        notes[k] = 36 + (k * 61 / (s->voices > 1 ? s->voices - 1 : 1)) % 62;
+        harness_note(h, inst, 1, notes[k], 100);
+    }
+    int total = (int)(s->seconds * MOVE_SAMPLE_RATE / MOVE_FRAMES_PER_BLOCK);
+    int release = total * 6 / 10;
+    std::vector<double> us;
+    us.reserve(total);
+    for (int b = 0; b < total; b++) {
+        if (b == release) {
+            for (int k = 0; k < s->voices; k++) harness_note(h, inst, 0, notes[k], 0);
+        }
+        uint64_t t0 = harness_now_ns();
+        h->api->render_block(inst, audio, MOVE_FRAMES_PER_BLOCK);
+        us.push_back((harness_now_ns() - t0) / 1000.0);
+    }
+    h->api->destroy_instance(inst);
+
+    double sum = 0;
+    for (size_t i = 0; i < us.size(); i++) sum += us[i];
+    std::sort(us.begin(), us.end());
+    c->avg_us = us.empty() ? 0 : sum / us.size();
+    c->p99_us = us.empty() ? 0 : us[(us.size() * 99) / 100];
+    c->max_us = us.empty() ? 0 : us.back();
+    return 1;
+}
+
+/* Median of WC_REMEASURE runs, so the reported numbers are not one lucky block */
+static void wc_remeasure(wc_search_t *s, wc_case_t *c) {
+    double p99[WC_REMEASURE], mx[WC_REMEASURE], avg[WC_REMEASURE];
+    for (int r = 0; r < WC_REMEASURE; r++) {
+        wc_measure(s, c);
+        p99[r] = c->p99_us;
+        mx[r] = c->max_us;
+        avg[r] = c->avg_us;
+    }
+    std::sort(p99, p99 + WC_REMEASURE);
+    std::sort(mx, mx + WC_REMEASURE);
+    std::sort(avg, avg + WC_REMEASURE);
+    c->p99_us = p99[WC_REMEASURE / 2];
+    c->max_us = mx[WC_REMEASURE / 2];
+    c->avg_us = avg[WC_REMEASURE / 2];
+}
+
+static bool wc_by_score(const wc_case_t &a, const wc_case_t &b) {
+    return a.p99_us > b.p99_us;
+}
+
+/* Parameters two cases disagree on */
+static int wc_distance(const wc_search_t *s, const wc_case_t *a, const wc_case_t *b) {
+    int d = 0;
+    for (int i = 0; i < s->param_count; i++) d += fabsf(a->values[i] - b->values[i]) > 0.05f;
+    return d;
+}
+
+/*
+ * Keep the top n, most expensive first. A case within a mutation's reach
+ * of one already kept replaces it only if it scores higher, so the list
+ * holds distinct cliffs rather than n copies of the first one found.
+ */
+static void wc_keep(const wc_search_t *s, std::vector<wc_case_t> &top, const wc_case_t &c, int n) {
+    for (size_t i = 0; i < top.size(); i++) {
+        if (wc_distance(s, &top[i], &c) <= 3) {
+            if (c.p99_us > top[i].p99_us) top[i] = c;
+            std::sort(top.begin(), top.end(), wc_by_score);
+            return;
+        }
+    }
+    top.push_back(c);
+    std::sort(top.begin(), top.end(), wc_by_score);
+    if ((int)top.size() > n) top.resize(n);
+}
+
+static void wc_print_case(wc_search_t *s, const wc_case_t *c, int rank, double baseline_p99, int first) {
+    printf("%s\n  {\"rank\":%d,\"p99_us\":%.1f,\"max_us\":%.1f,\"avg_us\":%.1f,\"x_baseline\":%.2f,\"origin\":\"%s\",\"params\":\"%s\"}",
+           first ? "" : ",", rank, c->p99_us, c->max_us, c->avg_us,
+           baseline_p99 > 0 ? c->p99_us / baseline_p99 : 0, c->origin.c_str(), wc_format(s, c).c_str());
+}
+
+/*
+ * Cases from a --out file: tab-separated, params_batch in the last column,
+ * over the baseline values for any key a line leaves out. The header line
+ * restores the voices, length and oversampling limit the file was made with.
+ */
+static int wc_read_cases(wc_search_t *s, const char *path, const wc_case_t *base, std::vector<wc_case_t> &cases) {
+    FILE *f = fopen(path, "r");
+    if (!f) return -1;
+    static char line[8192];
+    static char limit[16];
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "# obxd worst-case: voices=%d seconds=%lf oversampling_limit=%15[^,]",
+                   &s->voices, &s->seconds, limit) == 3) {
+            s->limit = limit;
+            continue;
+        }
+        if (line[0] == '#' || line[0] == '\n') continue;
+        line[strcspn(line, "\r\n")] = '\0';
+        const char *batch = strrchr(line, '\t');
+        batch = batch ? batch + 1 : line;
+        wc_case_t c;
+        memcpy(c.values, base->values, sizeof(c.values));
+        wc_overlay(s, &c, batch);
+        c.origin = "replay";
+        cases.push_back(c);
+    }
+    fclose(f);
+    return (int)cases.size();
+}
+
+/* worst-case [--iterations N] [--seconds N] [--voices N] [--top N] [--seed N] [--limit RUNG] [--out FILE] [--replay FILE] */
+int cmd_worst_case(harness_t *h, int argc, char **argv) {
+    int iterations = 48, top_n = 5;
+    const char *out_path = NULL, *replay = NULL;
+    wc_search_t s;
+    memset(&s, 0, sizeof(s));
+    s.h = h;
+    s.voices = 8;
+    s.seconds = 0.5;
+    s.limit = "1x";
+    s.seed = 1234;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) iterations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) s.seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--voices") == 0 && i + 1 < argc) s.voices = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) top_n = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) s.seed = (uint32_t)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc) s.limit = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) out_path = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) replay = argv[++i];
+    }
+    if (s.voices < 1) s.voices = 1;
+    if (s.voices > 32) s.voices = 32;
+    if (top_n < 1) top_n = 1;
+    if (s.seed == 0) s.seed = 1;
+    uint32_t seed = s.seed;
+
+    s.base = h->api->create_instance(h->module_dir, NULL);
+    if (!s.base) {
+        fprintf(stderr, "worst-case: create_instance failed\n");
+        return 1;
+    }
+    h->api->set_param(s.base, "preset", "0");
+    if (wc_load_params(&s) == 0) {
+        fprintf(stderr, "worst-case: no chain_params from dsp.so\n");
+        h->api->destroy_instance(s.base);
+        return 1;
+    }
+
+    /* Preset 0 as the reference point: its current values, read back per key */
+    wc_case_t baseline;
+    char val[64];
+    for (int i = 0; i < s.param_count; i++) {
+        baseline.values[i] = h->api->get_param(s.base, s.params[i].key, val, sizeof(val)) > 0 ? (float)atof(val) : 0.0f;
+    }
+    baseline.origin = "preset0";
+
+    std::vector<wc_case_t> cases;
+    if (replay && wc_read_cases(&s, replay, &baseline, cases) <= 0) {
+        fprintf(stderr, "worst-case: no cases in %s\n", replay);
+        h->api->destroy_instance(s.base);
+        return 1;
+    }
+    wc_remeasure(&s, &baseline);
+
+    std::vector<wc_case_t> top;
+    if (replay) {
+        for (size_t i = 0; i < cases.size(); i++) {
+            wc_remeasure(&s, &cases[i]);
+            top.push_back(cases[i]);
+        }
+        iterations = 0;
+    }
+
+    /* Guided corners first, then random patches, then mutations of the best */
+    int guided = (int)(sizeof(g_wc_guided) / sizeof(g_wc_guided[0]));
+    for (int it = 0; it < iterations; it++) {
+        wc_case_t c;
+        for (int i = 0; i < s.param_count; i++) c.values[i] = wc_random_value(&s, i);
+        if (it < guided) {
+            wc_overlay(&s, &c, g_wc_guided[it].params);
+            c.origin = std::string("guided:") + g_wc_guided[it].name;
+        } else if (it < guided + iterations / 4 || top.empty()) {
+            c.origin = "random";
+        } else {
+            const wc_case_t &parent = top[harness_rand(&s.seed) % top.size()];
+            memcpy(c.values, parent.values, sizeof(c.values));
+            int changes = 1 + harness_rand(&s.seed) % 3;
+            for (int k = 0; k < changes; k++) {
+                int i = harness_rand(&s.seed) % s.param_count;
+                if (s.params[i].is_int || harness_rand(&s.seed) % 2) {
+                    c.values[i] = wc_random_value(&s, i);
+                } else {
+                    float v = c.values[i] + (wc_unit(&s.seed) - 0.5f) * 0.4f;
+                    c.values[i] = v < 0 ? 0 : v > 1 ? 1 : v;
+                }
+            }
+            c.origin = "mutation";
+        }
+        if (!wc_measure(&s, &c)) continue;
+        if (g_harness_verbose) fprintf(stderr, "worst-case: %d/%d %s p99 %.1f us\n", it + 1, iterations, c.origin.c_str(), c.p99_us);
+        wc_keep(&s, top, c, top_n);
+    }
+    if (!replay) {
+        for (size_t i = 0; i < top.size(); i++) wc_remeasure(&s, &top[i]);
+        std::sort(top.begin(), top.end(), wc_by_score);
+    }
+
+    double budget_us = MOVE_FRAMES_PER_BLOCK * 1e6 / MOVE_SAMPLE_RATE;
+    printf("{\"worst_case\":{\"iterations\":%d,\"voices\":%d,\"seconds\":%.2f,\"oversampling_limit\":\"%s\",\"seed\":%u,"
+           "\"budget_us\":%.1f,\"baseline\":{\"p99_us\":%.1f,\"max_us\":%.1f,\"avg_us\":%.1f},\"top\":[",
+           iterations, s.voices, s.seconds, s.limit, seed, budget_us, baseline.p99_us, baseline.max_us, baseline.avg_us);
+    for (size_t i = 0; i < top.size(); i++) wc_print_case(&s, &top[i], (int)i + 1, baseline.p99_us, i == 0);
+    printf("\n]}}\n");
+
+    if (out_path) {
+        FILE *f = fopen(out_path, "w");
+        if (!f) {
+            fprintf(stderr, "worst-case: cannot write %s\n", out_path);
+        } else {
+            fprintf(f, "# obxd worst-case: voices=%d seconds=%.2f oversampling_limit=%s, replay with worst-case --replay FILE\n",
+                    s.voices, s.seconds, s.limit);
+            fprintf(f, "# rank\tp99_us\tmax_us\tavg_us\torigin\tparams_batch\n");
+            for (size_t i = 0; i < top.size(); i++) {
+                fprintf(f, "%d\t%.1f\t%.1f\t%.1f\t%s\t%s\n", (int)i + 1, top[i].p99_us, top[i].max_us, top[i].avg_us,
+                        top[i].origin.c_str(), wc_format(&s, &top[i]).c_str());
+            }
+            fclose(f);
+        }
+    }
+    h->api->destroy_instance(s.base);
+    return 0;
+}